@@ -13,9 +13,10 @@ import subprocess
 matplotlib.use("Agg")
 import matplotlib.pyplot as plt  # noqa: E402
 
-# This script executes a Hyrise benchmark multiple times over a specified range of cores, and produces a plot
-# of the results. You'll have to provide the path to the benchmark executable (e.g., hyriseBenchmarkTPCH)
-# as argument, as well as all parameters you want to be passed to the executable, like --scale, --chunk_size, etc.
+# This script executes a Hyrise benchmark multiple times over a specified range of cores, and produces plots
+# of the throughput and of the scaling (i.e., the speedup relative to the lowest core count) of each item. You'll
+# have to provide the path to the benchmark executable (e.g., hyriseBenchmarkTPCH) as argument, as well as all
+# parameters you want to be passed to the executable, like --scale, --chunk_size, etc.
 # You'll also have to specify the number of query runs as either a fixed number for all cores (--fixed-runs),
 # or a number of runs per core (--runs-per-core).
 # You can also specify the cores to be benchmarked, otherwise a default range will be used.
@@ -283,6 +284,63 @@ def plot(args, result_dir):
         # Always print out where the plot was saved, independent of verbosity
         verbose_print(True, "Plot saved as: " + result_plot_file)
 
+    plot_scaling(results, numa_borders, max_cores, result_dir)
+
+
+def plot_scaling(results, numa_borders, max_cores, result_dir):
+    # Plots the speedup of each item relative to its throughput with the lowest benchmarked core count. Items whose
+    # operators do not split their work into enough tasks fall behind the ideal (linear) speedup.
+    num_plots = len(results)
+    n_rows_and_cols = get_subplot_row_and_column_count(num_plots)
+    plot_pos = 0
+    legend_plots = None
+
+    plt.close("all")
+    fig = plt.figure(figsize=(n_rows_and_cols * 3, n_rows_and_cols * 2))
+    for name, data in results.items():
+        plot_pos += 1
+        ax = fig.add_subplot(n_rows_and_cols, n_rows_and_cols, plot_pos)
+        ax.set_title(name)
+
+        if not data["cores"] or data["items_per_second"][0] == 0:
+            continue
+
+        base_cores = data["cores"][0]
+        base_items_per_second = data["items_per_second"][0]
+        speedups = [items_per_second / base_items_per_second for items_per_second in data["items_per_second"]]
+        ideal_speedups = [cores / base_cores for cores in data["cores"]]
+
+        measured_plot = ax.plot(data["cores"], speedups, label="measured", marker=".")
+        ideal_plot = ax.plot(
+            data["cores"],
+            ideal_speedups,
+            color=measured_plot[0].get_color(),
+            linestyle="dashed",
+            linewidth=1.0,
+            label="ideal",
+        )
+        legend_plots = (measured_plot[0], ideal_plot[0])
+        ax.set_ylim(ymin=0)
+        ax.set_xlim(xmin=0, xmax=max_cores)
+
+        for numa_border in numa_borders:
+            ax.axvline(numa_border, color="gray", linestyle="dashed", linewidth=1.0)
+
+    if legend_plots:
+        plt.figlegend(legend_plots, ("measured", "ideal"), "lower right")
+
+    plt.tight_layout()
+
+    ax_legend = fig.add_subplot(111, frameon=False)
+    plt.tick_params(labelcolor="none", top=False, bottom=False, left=False, right=False)
+    ax_legend.set_xlabel("Utilized cores", labelpad=10)
+    ax_legend.set_ylabel("Speedup", labelpad=20)
+
+    for extension in ["png", "pdf"]:
+        scaling_plot_file = os.path.join(result_dir, "scaling_plots." + extension)
+        plt.savefig(scaling_plot_file, bbox_inches="tight")
+        verbose_print(True, "Plot saved as: " + scaling_plot_file)
+
 
 if __name__ == "__main__":
     parser = get_parser()
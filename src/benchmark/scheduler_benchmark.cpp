@@ -0,0 +1,93 @@
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace hyrise {
+
+namespace {
+
+constexpr auto TASKS_PER_ITERATION = size_t{10'000};
+
+void start_node_queue_scheduler(const benchmark::State& state) {
+  Hyrise::get().topology.use_default_topology(static_cast<uint32_t>(state.range(0)));
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+}
+
+void stop_node_queue_scheduler(benchmark::State& state, const size_t tasks_per_iteration) {
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * tasks_per_iteration));
+  state.counters["workers"] = static_cast<double>(Hyrise::get().topology.num_cpus());
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+}  // namespace
+
+/**
+ * Measures the throughput of tiny tasks that are scheduled from outside the scheduler (e.g., by the benchmark runner or
+ * the server), which places them in the nodes' TaskQueues. The argument is the number of workers.
+ */
+static void BM_SchedulerExternalTasks(benchmark::State& state) {  // NOLINT
+  start_node_queue_scheduler(state);
+  auto counter = std::atomic_uint64_t{0};
+
+  for (auto _ : state) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    tasks.reserve(TASKS_PER_ITERATION);
+    for (auto task_id = size_t{0}; task_id < TASKS_PER_ITERATION; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([&counter]() {
+        counter.fetch_add(1, std::memory_order_relaxed);
+      }));
+    }
+    AbstractScheduler::schedule_tasks(tasks);
+    Hyrise::get().scheduler()->wait_for_tasks(tasks);
+  }
+
+  benchmark::DoNotOptimize(counter.load());
+  stop_node_queue_scheduler(state, TASKS_PER_ITERATION);
+}
+
+/**
+ * Measures the throughput of tiny tasks that are spawned by other tasks, as operators do when they split their work
+ * into JobTasks. One parent task per worker spawns its share of the tasks, which are pushed to the worker's deque and
+ * partly stolen by other workers. The argument is the number of workers.
+ */
+static void BM_SchedulerSpawnedTasks(benchmark::State& state) {  // NOLINT
+  start_node_queue_scheduler(state);
+  const auto worker_count = Hyrise::get().topology.num_cpus();
+  const auto tasks_per_parent = TASKS_PER_ITERATION / worker_count;
+  auto counter = std::atomic_uint64_t{0};
+
+  for (auto _ : state) {
+    auto parent_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    parent_tasks.reserve(worker_count);
+    for (auto parent_id = size_t{0}; parent_id < worker_count; ++parent_id) {
+      parent_tasks.emplace_back(std::make_shared<JobTask>([&]() {
+        auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+        tasks.reserve(tasks_per_parent);
+        for (auto task_id = size_t{0}; task_id < tasks_per_parent; ++task_id) {
+          tasks.emplace_back(std::make_shared<JobTask>([&counter]() {
+            counter.fetch_add(1, std::memory_order_relaxed);
+          }));
+        }
+        AbstractScheduler::schedule_tasks(tasks);
+        Hyrise::get().scheduler()->wait_for_tasks(tasks);
+      }));
+    }
+    AbstractScheduler::schedule_tasks(parent_tasks);
+    Hyrise::get().scheduler()->wait_for_tasks(parent_tasks);
+  }
+
+  benchmark::DoNotOptimize(counter.load());
+  stop_node_queue_scheduler(state, tasks_per_parent * worker_count);
+}
+
+BENCHMARK(BM_SchedulerExternalTasks)->RangeMultiplier(2)->Range(1, 128)->UseRealTime();
+BENCHMARK(BM_SchedulerSpawnedTasks)->RangeMultiplier(2)->Range(1, 128)->UseRealTime();
+
+}  // namespace hyrise
@@ -40,12 +40,16 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("10"))
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false"));  // NOLINT(whitespace/line_length)
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("point_operations", "Execute single-row primary key SELECTs and UPDATEs without the SQL pipeline (use with --table_indexes)", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("insert_chunks", "Number of mutable chunks per table that concurrent clients insert into, see Table::set_insert_chunk_count()", cxxopts::value<uint32_t>()->default_value("1"));  // NOLINT(whitespace/line_length)
   // clang-format on
 
   auto config = std::shared_ptr<BenchmarkConfig>{};
   auto num_warehouses = size_t{0};
   auto consistency_checks = false;
+  auto point_operations = false;
+  auto insert_chunk_count = uint32_t{1};
 
   // Parse command line args
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -56,22 +60,37 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  point_operations = cli_parse_result["point_operations"].as<bool>();
+  insert_chunk_count = cli_parse_result["insert_chunks"].as<uint32_t>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
   // As TPC-C procedures may run into conflicts on both the Hyrise and the SQLite side, we cannot guarantee that the
   // two databases stay in sync.
   Assert(!config->verify || config->clients == 1, "Cannot run verification with more than one client.");
+  // Point operations bypass the SQL pipeline and, thus, SQLite.
+  Assert(!config->verify || !point_operations, "Cannot run verification with point operations.");
+  Assert(insert_chunk_count > 0, "Tables need at least one insert chunk.");
 
   auto context = BenchmarkRunner::create_context(*config);
 
   std::cout << "- TPC-C scale factor (number of warehouses) is " << num_warehouses << '\n';
+  if (point_operations) {
+    std::cout << "- Executing single-row primary key accesses without the SQL pipeline\n";
+  }
+  if (insert_chunk_count > 1) {
+    std::cout << "- Inserting into " << insert_chunk_count << " chunks per table\n";
+  }
 
-  // Add TPC-C-specific information
+  // Add TPC-C-specific information. As the per-item latencies are reported in the result JSON, the effect of point
+  // operations and insert chunks can be compared using scripts/compare_benchmarks.py.
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("point_operations", point_operations);
+  context.emplace("insert_chunks", insert_chunk_count);
 
   // Run the benchmark
-  auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
+  auto item_runner =
+      std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses, point_operations, insert_chunk_count);
   BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
                   context)
       .run();
@@ -0,0 +1,46 @@
+#include "benchmark/benchmark.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "hyrise.hpp"
+
+namespace hyrise {
+
+/**
+ * Measures the throughput of short transactions (such as most TPC-C transactions) that only begin and commit. Each
+ * thread simulates one client. Beginning and ending transactions registers and deregisters their snapshot commit IDs
+ * and thus shows how well the TransactionManager scales with the number of clients.
+ */
+static void BM_TransactionManagerBeginCommit(benchmark::State& state) {  // NOLINT
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Same as above, but with the lowest active snapshot commit ID being requested in each iteration of the first thread
+ * (as done by the MvccDeletePlugin, albeit much more often).
+ */
+static void BM_TransactionManagerBeginCommitWithLowestSnapshot(benchmark::State& state) {  // NOLINT
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  for (auto _ : state) {
+    const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+    if (state.thread_index() == 0) {
+      benchmark::DoNotOptimize(transaction_manager.get_lowest_active_snapshot_commit_id());
+    }
+    transaction_context->commit();
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_TransactionManagerBeginCommit)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(BM_TransactionManagerBeginCommitWithLowestSnapshot)->ThreadRange(1, 128)->UseRealTime();
+
+}  // namespace hyrise
@@ -32,6 +32,7 @@
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/list_directory.hpp"
+#include "utils/numa_placement.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -40,6 +41,7 @@ void to_json(nlohmann::json& json, const TableGenerationMetrics& metrics) {
   json = {{"generation_duration", metrics.generation_duration.count()},
           {"encoding_duration", metrics.encoding_duration.count()},
           {"binary_caching_duration", metrics.binary_caching_duration.count()},
+          {"numa_placement_duration", metrics.numa_placement_duration.count()},
           {"sort_duration", metrics.sort_duration.count()},
           {"store_duration", metrics.store_duration.count()},
           {"chunk_index_duration", metrics.chunk_index_duration.count()},
@@ -283,7 +285,7 @@ void AbstractTableGenerator::generate_and_store() {
 
       std::cout << "-  Writing '" << table_name << "' into binary file " << binary_file_path << " " << std::flush;
       auto per_table_timer = Timer{};
-      BinaryWriter::write(*table_info.table, binary_file_path);
+      BinaryWriter::write(*table_info.table, binary_file_path, true);
       std::cout << "(" << per_table_timer.lap_formatted() << ")\n" << std::flush;
     }
     metrics.binary_caching_duration = timer.lap();
@@ -292,6 +294,24 @@ void AbstractTableGenerator::generate_and_store() {
               << std::flush;
   }
 
+  /**
+   * Partition the tables across the NUMA nodes if the scheduler runs workers on multiple nodes. This has to happen
+   * before the tables are added to the StorageManager, as the migration must not run concurrently with queries.
+   */
+  if (Hyrise::get().is_multi_threaded()) {
+    auto migrated_chunk_count = size_t{0};
+    for (auto& [table_name, table_info] : table_info_by_name) {
+      migrated_chunk_count += place_table_on_numa_nodes(*table_info.table);
+    }
+
+    if (migrated_chunk_count > 0) {
+      metrics.numa_placement_duration = timer.lap();
+      std::cout << "- Placing " << migrated_chunk_count << " chunks on NUMA nodes done ("
+                << format_duration(metrics.numa_placement_duration) << ")\n"
+                << std::flush;
+    }
+  }
+
   /**
    * Add the Tables to the StorageManager
    */
@@ -19,7 +19,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                                  const bool init_enable_visualization, const bool init_verify,
                                  const bool init_cache_binary_tables, const bool init_system_metrics,
-                                 const bool init_pipeline_metrics, const std::vector<std::string>& init_plugins)
+                                 const bool init_pipeline_metrics,
+                                 const std::optional<std::string>& init_trace_directory,
+                                 const std::vector<std::string>& init_plugins)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -38,6 +40,7 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       cache_binary_tables(init_cache_binary_tables),
       system_metrics(init_system_metrics),
       pipeline_metrics(init_pipeline_metrics),
+      trace_directory(init_trace_directory),
       plugins(init_plugins) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -29,7 +30,7 @@ class BenchmarkConfig {
                   const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                   const bool init_enable_visualization, const bool init_verify, const bool init_cache_binary_tables,
                   const bool init_system_metrics, const bool init_pipeline_metrics,
-                  const std::vector<std::string>& init_plugins);
+                  const std::optional<std::string>& init_trace_directory, const std::vector<std::string>& init_plugins);
 
   static BenchmarkConfig get_default_config();
 
@@ -51,6 +52,8 @@ class BenchmarkConfig {
   bool cache_binary_tables{false};  // Defaults to false for internal use, but the CLI sets it to true by default.
   bool system_metrics{false};
   bool pipeline_metrics{false};
+  // Directory for the Chrome traces of the tasks executed for each item (see TaskTracer). Requires the scheduler.
+  std::optional<std::string> trace_directory{};
   std::vector<std::string> plugins{};
 
  private:
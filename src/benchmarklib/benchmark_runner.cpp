@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -92,6 +94,10 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
     Hyrise::get().set_scheduler(scheduler);
   }
 
+  if (_config.trace_directory) {
+    std::filesystem::create_directories(*_config.trace_directory);
+  }
+
   _table_generator->generate_and_store();
 
   _benchmark_item_runner->on_tables_loaded();
@@ -280,6 +286,8 @@ void BenchmarkRunner::_benchmark_shuffled() {
 
   Assert(_currently_running_clients == 0, "Did not expect any clients to run at this time.");
 
+  // As the execution of benchmark items is intermingled, we record a single trace for all items.
+  _begin_task_trace();
   _state = BenchmarkState{_config.max_duration};
   while (_state.keep_running() && (_config.max_runs < 0 || _total_finished_runs.load(std::memory_order_relaxed) <
                                                                static_cast<size_t>(_config.max_runs))) {
@@ -302,6 +310,7 @@ void BenchmarkRunner::_benchmark_shuffled() {
   // Wait for the rest of the tasks that didn't make it in time - they will not count towards the results.
   Hyrise::get().scheduler()->wait_for_all_tasks();
   Assert(_currently_running_clients == 0, "All runs must be finished at this point.");
+  _end_task_trace("Shuffled");
 
   _snapshot_segment_access_counters("End of Benchmark");
 }
@@ -327,6 +336,7 @@ void BenchmarkRunner::_benchmark_ordered() {
       _running_clients_semaphore.signal(_config.clients);
     }
 
+    _begin_task_trace();
     _state = BenchmarkState{_config.max_duration};
     while (_state.keep_running() &&
            (_config.max_runs < 0 || (result.successful_runs.size() + result.unsuccessful_runs.size()) <
@@ -342,6 +352,7 @@ void BenchmarkRunner::_benchmark_ordered() {
     Hyrise::get().scheduler()->wait_for_all_tasks();
 
     Assert(_currently_running_clients == 0, "All runs must be finished at this point.");
+    _end_task_trace(name);
 
     result.duration = _state.benchmark_duration;
     // chrono::seconds uses an integer precision duration type, but we need a floating-point value.
@@ -375,6 +386,38 @@ void BenchmarkRunner::_benchmark_ordered() {
   }
 }
 
+void BenchmarkRunner::_begin_task_trace() {
+  if (!_config.trace_directory) {
+    return;
+  }
+
+  auto& task_tracer = Hyrise::get().task_tracer;
+  task_tracer.clear();
+  task_tracer.set_enabled(true);
+}
+
+void BenchmarkRunner::_end_task_trace(const std::string& name) {
+  if (!_config.trace_directory) {
+    return;
+  }
+
+  auto& task_tracer = Hyrise::get().task_tracer;
+  task_tracer.set_enabled(false);
+
+  // Item names might contain characters that are not suitable for file names (e.g., "TPC-H 01").
+  auto file_name = name;
+  std::replace_if(
+      file_name.begin(), file_name.end(),
+      [](const auto character) {
+        return !std::isalnum(static_cast<unsigned char>(character)) && character != '-';
+      },
+      '_');
+
+  const auto trace_file = (std::filesystem::path{*_config.trace_directory} / (file_name + ".json")).string();
+  task_tracer.export_chrome_trace(trace_file);
+  std::cout << "  -> Wrote task trace to '" << trace_file << "'\n" << std::flush;
+}
+
 void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id) {
   _running_clients_semaphore.wait();
 
@@ -591,6 +634,7 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     ("system_metrics", "Track system metrics (system utilization, segment accesses, etc.) and add them to the output JSON (see -o).", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
+    ("trace", "Record the tasks executed by the scheduler's workers and write a Chrome trace (viewable with chrome://tracing or Perfetto) per item to the given directory. Requires the scheduler.", cxxopts::value<std::string>()->default_value(""))  // NOLINT(whitespace/line_length)
     ("pipeline_metrics", "Track SQL pipeline metrics (runtime of steps in SQL pipeline, optimizer rule durations) and add them to the output JSON (see -o). Tracking pipeline metrics switches off plan caching.", cxxopts::value<bool>()->default_value("false"))  // NOLINT(whitespace/line_length)
     // This option is only advised when the underlying system's memory capacity is overleaded by the preparation phase.
     ("data_preparation_cores", "Specify the number of cores used by the scheduler for data preparation, i.e., sorting and encoding tables and generating table statistics. 0 means all available cores.", cxxopts::value<uint32_t>()->default_value("0"));  // NOLINT(whitespace/line_length)
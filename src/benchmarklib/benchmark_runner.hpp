@@ -83,6 +83,11 @@ class BenchmarkRunner : public Noncopyable {
   // to identify a certain point in the benchmark, e.g., when an item is finished in the ordered mode.
   void _snapshot_segment_access_counters(const std::string& moment = "");
 
+  // If a trace directory is configured, starts recording the executed tasks. _end_task_trace() stops the recording and
+  // writes a Chrome trace (see TaskTracer) named after the @param name to the trace directory.
+  void _begin_task_trace();
+  void _end_task_trace(const std::string& name);
+
   const BenchmarkConfig _config;
 
   std::unique_ptr<AbstractBenchmarkItemRunner> _benchmark_item_runner;
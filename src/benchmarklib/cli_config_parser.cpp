@@ -168,6 +168,14 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL pipeline metrics.\n";
   }
 
+  auto trace_directory = std::optional<std::string>{};
+  const auto trace_directory_string = parse_result["trace"].as<std::string>();
+  if (!trace_directory_string.empty()) {
+    Assert(enable_scheduler, "--trace only makes sense when the scheduler is active.");
+    trace_directory = trace_directory_string;
+    std::cout << "- Writing task traces to '" << *trace_directory << "'\n";
+  }
+
   auto plugins = std::vector<std::string>{};
   auto comma_separated_plugins = parse_result["plugins"].as<std::string>();
   if (!comma_separated_plugins.empty()) {
@@ -193,6 +201,7 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
                          cache_binary_tables,
                          system_metrics,
                          pipeline_metrics,
+                         trace_directory,
                          plugins};
 }
 
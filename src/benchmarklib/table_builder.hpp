@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <span>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <boost/container/vector.hpp>
 #include <boost/hana/assert.hpp>
 #include <boost/hana/for_each.hpp>
 #include <boost/hana/size.hpp>
@@ -14,6 +16,8 @@
 #include <boost/hana/zip_with.hpp>
 
 #include "resolve_type.hpp"
+#include "storage/column_span.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -103,7 +107,8 @@ get_value_type<T>& get_value(T& optional_or_value) {
 /**
  * Helper to build a table with a static column layout, specified by constructor arguments types and names. Keeps a
  * value vector for each column and appends values to them in append_row(). For nullable columns an additional
- * null_values vector is kept. Automatically creates chunks in accordance with the specified chunk size.
+ * null_values vector is kept. Whenever a chunk's worth of rows is buffered, the vectors are appended to the table via
+ * Table::append_columns() and reused for the next rows.
  */
 template <typename... DataTypes>
 class TableBuilder {
@@ -209,8 +214,12 @@ class TableBuilder {
   // _table->row_count() only counts completed chunks but we want the total number of rows added to this table builder
   size_t _row_count;
 
-  boost::hana::tuple<pmr_vector<table_builder::get_value_type<DataTypes>>...> _value_vectors;
-  boost::hana::tuple<table_builder::OptionalConstexpr<pmr_vector<bool>, (table_builder::is_optional<DataTypes>())>...>
+  boost::hana::tuple<std::vector<table_builder::get_value_type<DataTypes>>...> _value_vectors;
+
+  // The NULL flags are stored as contiguous bools (in contrast to std::vector<bool>), so that they can be passed as a
+  // ColumnSpan.
+  boost::hana::tuple<
+      table_builder::OptionalConstexpr<boost::container::vector<bool>, (table_builder::is_optional<DataTypes>())>...>
       _null_value_vectors;
 
   size_t _current_chunk_row_count() const {
@@ -218,7 +227,7 @@ class TableBuilder {
   }
 
   void _emit_chunk() {
-    auto segments = Segments{};
+    auto column_spans = std::vector<ColumnSpan>{};
 
     auto _value_vectors_and_null_value_vectors = boost::hana::zip_with(
         [](auto& values, auto& null_values) {
@@ -226,28 +235,30 @@ class TableBuilder {
         },
         _value_vectors, _null_value_vectors);
 
-    // Create a segment from each value vector and add it to the Chunk, then re-initialize the vector
+    // Create a ColumnSpan from each value vector.
     boost::hana::for_each(_value_vectors_and_null_value_vectors, [&](auto& values_and_null_values) {
       auto& values = values_and_null_values[boost::hana::llong_c<0>].get();
       auto& null_values = values_and_null_values[boost::hana::llong_c<1>].get();
 
-      using T = typename std::decay_t<decltype(values)>::value_type;
       if constexpr (std::decay_t<decltype(null_values)>::has_value) {  // column is nullable
-        segments.emplace_back(std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values.value())));
-
-        null_values.value() = pmr_vector<bool>{};
-        null_values.value().reserve(_estimated_rows_per_chunk);
+        column_spans.emplace_back(values,
+                                  std::span<const bool>{null_values.value().data(), null_values.value().size()});
       } else {
-        segments.emplace_back(std::make_shared<ValueSegment<T>>(std::move(values)));
+        column_spans.emplace_back(values);
       }
-
-      values = std::decay_t<decltype(values)>{};
-      values.reserve(_estimated_rows_per_chunk);
     });
 
-    auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    _table->append_columns(column_spans);
 
-    _table->append_chunk(segments, mvcc_data);
+    // Clear the vectors, keeping their capacity for the next chunk.
+    boost::hana::for_each(_value_vectors, [](auto& values) {
+      values.clear();
+    });
+    boost::hana::for_each(_null_value_vectors, [](auto& null_values) {
+      if constexpr (std::decay_t<decltype(null_values)>::has_value) {
+        null_values.value().clear();
+      }
+    });
   }
 };
 
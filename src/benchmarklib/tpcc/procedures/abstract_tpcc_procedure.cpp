@@ -3,9 +3,11 @@
 #include "benchmark_sql_executor.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "operators/point_update.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/point_lookup.hpp"
 
 namespace hyrise {
 
@@ -33,6 +35,30 @@ bool AbstractTPCCProcedure::execute() {
   return success;
 }
 
+std::optional<std::vector<AllTypeVariant>> AbstractTPCCProcedure::_select_row(const std::string& table_name,
+                                                                             const PointLookupKey& key) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto row_id = find_visible_row(*table, key, *_sql_executor.transaction_context);
+  if (!row_id) {
+    return std::nullopt;
+  }
+  return materialize_row(*table, *row_id);
+}
+
+bool AbstractTPCCProcedure::_update_row(const std::string& table_name, const PointLookupKey& key,
+                                        const std::vector<std::pair<ColumnID, AllTypeVariant>>& values) {
+  const auto point_update = std::make_shared<PointUpdate>(table_name, key, values);
+  point_update->set_transaction_context(_sql_executor.transaction_context);
+  point_update->execute();
+  if (point_update->execute_failed()) {
+    // Like a failed SQLPipeline, roll back the transaction.
+    _sql_executor.transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+  Assert(point_update->updated_row_count() == 1, "Did not find the row to update.");
+  return true;
+}
+
 // NOLINTNEXTLINE(cert-oop54-cpp): We know that this is not a proper assignment.
 AbstractTPCCProcedure& AbstractTPCCProcedure::operator=(const AbstractTPCCProcedure& other) {
   DebugAssert(&_sql_executor == &other._sql_executor,
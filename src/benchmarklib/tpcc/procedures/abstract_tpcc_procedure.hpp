@@ -1,12 +1,17 @@
 #pragma once
 
+#include <optional>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "benchmark_sql_executor.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/table.hpp"
 #include "tpcc/tpcc_random_generator.hpp"
+#include "utils/point_lookup.hpp"
 
 namespace hyrise {
 
@@ -24,6 +29,13 @@ class AbstractTPCCProcedure {
  protected:
   [[nodiscard]] virtual bool _on_execute() = 0;
 
+  // Single-row accesses by primary key that bypass the SQL pipeline (see find_visible_row() and PointUpdate). They are
+  // executed in the transaction of the procedure, but they are neither recorded in the SQL executor's metrics nor
+  // verified with SQLite. _update_row() returns false if a transaction conflict occurred.
+  std::optional<std::vector<AllTypeVariant>> _select_row(const std::string& table_name, const PointLookupKey& key);
+  [[nodiscard]] bool _update_row(const std::string& table_name, const PointLookupKey& key,
+                                 const std::vector<std::pair<ColumnID, AllTypeVariant>>& values);
+
   // As random values are generate during creation of the procedure, this is mostly done in a single thread, not in the
   // database worker's. As such, having a fixed seed for all thread-local random engines should not be an issue.
   inline static thread_local std::minstd_rand _random_engine{42};
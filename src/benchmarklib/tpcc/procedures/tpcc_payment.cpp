@@ -11,16 +11,19 @@
 #include <tuple>
 
 #include "benchmark_sql_executor.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/table.hpp"
 #include "tpcc/procedures/abstract_tpcc_procedure.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/point_lookup.hpp"
 
 namespace hyrise {
 
-TPCCPayment::TPCCPayment(const int num_warehouses, BenchmarkSQLExecutor& sql_executor)
-    : AbstractTPCCProcedure(sql_executor) {
+TPCCPayment::TPCCPayment(const int num_warehouses, BenchmarkSQLExecutor& sql_executor,
+                         const bool init_use_point_operations)
+    : AbstractTPCCProcedure(sql_executor), use_point_operations(init_use_point_operations) {
   auto warehouse_dist = std::uniform_int_distribution<>{1, num_warehouses};
   w_id = warehouse_dist(_random_engine);
 
@@ -57,41 +60,50 @@ TPCCPayment::TPCCPayment(const int num_warehouses, BenchmarkSQLExecutor& sql_exe
 }
 
 bool TPCCPayment::_on_execute() {
-  auto pipeline_status = SQLPipelineStatus::NotExecuted;
-
-  // Retrieve information about the warehouse
-  const auto warehouse_select_pair = _sql_executor.execute(
-      std::string{"SELECT W_NAME, W_STREET_1, W_STREET_2, W_CITY, W_STATE, W_ZIP, W_YTD FROM WAREHOUSE WHERE W_ID = "} +
-      std::to_string(w_id));
-  const auto& warehouse_table = warehouse_select_pair.second;
-  Assert(warehouse_table && warehouse_table->row_count() == 1, "Did not find warehouse (or found more than one).");
-  const auto w_name = *warehouse_table->get_value<pmr_string>(ColumnID{0}, 0);
-  const auto w_ytd = *warehouse_table->get_value<float>(ColumnID{6}, 0);
-
-  // Update warehouse YTD
-  std::tie(pipeline_status, std::ignore) =
-      _sql_executor.execute(std::string{"UPDATE WAREHOUSE SET W_YTD = "} + std::to_string(w_ytd + h_amount) +
-                            " WHERE W_ID = " + std::to_string(w_id));
-  if (pipeline_status != SQLPipelineStatus::Success) {
-    return false;
-  }
+  auto w_name = pmr_string{};
+  auto d_name = pmr_string{};
+  if (use_point_operations) {
+    if (!_update_warehouse_and_district_with_point_operations(w_name, d_name)) {
+      return false;
+    }
+  } else {
+    auto pipeline_status = SQLPipelineStatus::NotExecuted;
+
+    // Retrieve information about the warehouse
+    const auto warehouse_select_pair = _sql_executor.execute(
+        std::string{
+            "SELECT W_NAME, W_STREET_1, W_STREET_2, W_CITY, W_STATE, W_ZIP, W_YTD FROM WAREHOUSE WHERE W_ID = "} +
+        std::to_string(w_id));
+    const auto& warehouse_table = warehouse_select_pair.second;
+    Assert(warehouse_table && warehouse_table->row_count() == 1, "Did not find warehouse (or found more than one).");
+    w_name = *warehouse_table->get_value<pmr_string>(ColumnID{0}, 0);
+    const auto w_ytd = *warehouse_table->get_value<float>(ColumnID{6}, 0);
+
+    // Update warehouse YTD
+    std::tie(pipeline_status, std::ignore) =
+        _sql_executor.execute(std::string{"UPDATE WAREHOUSE SET W_YTD = "} + std::to_string(w_ytd + h_amount) +
+                              " WHERE W_ID = " + std::to_string(w_id));
+    if (pipeline_status != SQLPipelineStatus::Success) {
+      return false;
+    }
 
-  // Retrieve information about the district
-  const auto district_select_pair = _sql_executor.execute(
-      std::string{
-          "SELECT D_NAME, D_STREET_1, D_STREET_2, D_CITY, D_STATE, D_ZIP, D_YTD FROM DISTRICT WHERE D_W_ID = "} +
-      std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
-  const auto& district_table = district_select_pair.second;
-  Assert(district_table && district_table->row_count() == 1, "Did not find district (or found more than one).");
-  const auto d_name = *district_table->get_value<pmr_string>(ColumnID{0}, 0);
-  const auto d_ytd = *district_table->get_value<float>(ColumnID{6}, 0);
-
-  // Update district YTD
-  const auto district_update_pair =
-      _sql_executor.execute(std::string{"UPDATE DISTRICT SET D_YTD = "} + std::to_string(d_ytd + h_amount) +
-                            " WHERE D_W_ID = " + std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
-  if (district_update_pair.first != SQLPipelineStatus::Success) {
-    return false;
+    // Retrieve information about the district
+    const auto district_select_pair = _sql_executor.execute(
+        std::string{
+            "SELECT D_NAME, D_STREET_1, D_STREET_2, D_CITY, D_STATE, D_ZIP, D_YTD FROM DISTRICT WHERE D_W_ID = "} +
+        std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
+    const auto& district_table = district_select_pair.second;
+    Assert(district_table && district_table->row_count() == 1, "Did not find district (or found more than one).");
+    d_name = *district_table->get_value<pmr_string>(ColumnID{0}, 0);
+    const auto d_ytd = *district_table->get_value<float>(ColumnID{6}, 0);
+
+    // Update district YTD
+    const auto district_update_pair =
+        _sql_executor.execute(std::string{"UPDATE DISTRICT SET D_YTD = "} + std::to_string(d_ytd + h_amount) +
+                              " WHERE D_W_ID = " + std::to_string(w_id) + " AND D_ID = " + std::to_string(d_id));
+    if (district_update_pair.first != SQLPipelineStatus::Success) {
+      return false;
+    }
   }
 
   auto customer_table = std::shared_ptr<const Table>{};
@@ -168,4 +180,32 @@ bool TPCCPayment::_on_execute() {
   return true;
 }
 
+bool TPCCPayment::_update_warehouse_and_district_with_point_operations(pmr_string& w_name, pmr_string& d_name) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // Retrieve information about the warehouse and update its YTD
+  const auto& warehouse_table = *storage_manager.get_table("WAREHOUSE");
+  const auto warehouse_key = PointLookupKey{{warehouse_table.column_id_by_name("W_ID"), w_id}};
+  const auto warehouse_row = _select_row("WAREHOUSE", warehouse_key);
+  Assert(warehouse_row, "Did not find warehouse.");
+  w_name = boost::get<pmr_string>((*warehouse_row)[warehouse_table.column_id_by_name("W_NAME")]);
+  const auto w_ytd_column_id = warehouse_table.column_id_by_name("W_YTD");
+  const auto w_ytd = boost::get<float>((*warehouse_row)[w_ytd_column_id]);
+  if (!_update_row("WAREHOUSE", warehouse_key, {{w_ytd_column_id, w_ytd + h_amount}})) {
+    return false;
+  }
+
+  // Retrieve information about the district and update its YTD. We look up D_W_ID first as it is more selective than
+  // D_ID for more than ten warehouses.
+  const auto& district_table = *storage_manager.get_table("DISTRICT");
+  const auto district_key = PointLookupKey{{district_table.column_id_by_name("D_W_ID"), w_id},
+                                           {district_table.column_id_by_name("D_ID"), d_id}};
+  const auto district_row = _select_row("DISTRICT", district_key);
+  Assert(district_row, "Did not find district.");
+  d_name = boost::get<pmr_string>((*district_row)[district_table.column_id_by_name("D_NAME")]);
+  const auto d_ytd_column_id = district_table.column_id_by_name("D_YTD");
+  const auto d_ytd = boost::get<float>((*district_row)[d_ytd_column_id]);
+  return _update_row("DISTRICT", district_key, {{d_ytd_column_id, d_ytd + h_amount}});
+}
+
 }  // namespace hyrise
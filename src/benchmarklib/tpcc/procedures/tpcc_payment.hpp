@@ -8,7 +8,9 @@ namespace hyrise {
 
 class TPCCPayment : public AbstractTPCCProcedure {
  public:
-  TPCCPayment(const int num_warehouses, BenchmarkSQLExecutor& sql_executor);
+  // If use_point_operations is set, the single-row accesses to WAREHOUSE and DISTRICT by their primary keys bypass the
+  // SQL pipeline (see AbstractTPCCProcedure::_select_row() and _update_row()).
+  TPCCPayment(const int num_warehouses, BenchmarkSQLExecutor& sql_executor, const bool use_point_operations = false);
 
   [[nodiscard]] bool _on_execute() override;
 
@@ -24,8 +26,15 @@ class TPCCPayment : public AbstractTPCCProcedure {
   float h_amount;  // The payment amount      [1..5000]
   int32_t h_date;  // Current datetime
 
+  bool use_point_operations;
+
   // Values calculated WHILE the procedure is executed, exposed for facilitating the tests:
   int32_t c_id{-1};  // Customer ID, initialized with invalid value
+
+ protected:
+  // Retrieves the names of the warehouse and district and updates their YTD using point operations. Returns false if a
+  // transaction conflict occurred.
+  [[nodiscard]] bool _update_warehouse_and_district_with_point_operations(pmr_string& w_name, pmr_string& d_name);
 };
 
 }  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "tpcc_benchmark_item_runner.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -7,6 +8,8 @@
 #include "abstract_benchmark_item_runner.hpp"
 #include "benchmark_config.hpp"
 #include "benchmark_sql_executor.hpp"
+#include "hyrise.hpp"
+#include "storage/table.hpp"
 #include "tpcc/procedures/tpcc_delivery.hpp"
 #include "tpcc/procedures/tpcc_new_order.hpp"
 #include "tpcc/procedures/tpcc_order_status.hpp"
@@ -16,8 +19,24 @@
 
 namespace hyrise {
 
-TPCCBenchmarkItemRunner::TPCCBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses)
-    : AbstractBenchmarkItemRunner(config), _num_warehouses(num_warehouses) {}
+TPCCBenchmarkItemRunner::TPCCBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses,
+                                                 bool use_point_operations, uint32_t insert_chunk_count)
+    : AbstractBenchmarkItemRunner(config),
+      _num_warehouses(num_warehouses),
+      _use_point_operations(use_point_operations),
+      _insert_chunk_count(insert_chunk_count) {}
+
+void TPCCBenchmarkItemRunner::on_tables_loaded() {
+  if (_insert_chunk_count == 1) {
+    return;
+  }
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (table->uses_mvcc() == UseMvcc::Yes) {
+      table->set_insert_chunk_count(_insert_chunk_count);
+    }
+  }
+}
 
 const std::vector<BenchmarkItemID>& TPCCBenchmarkItemRunner::items() const {
   static const auto items = std::vector<BenchmarkItemID>{BenchmarkItemID{0}, BenchmarkItemID{1}, BenchmarkItemID{2},
@@ -38,7 +57,7 @@ bool TPCCBenchmarkItemRunner::_on_execute_item(const BenchmarkItemID item_id, Be
       successful = TPCCOrderStatus{_num_warehouses, sql_executor}.execute();
       break;
     case 3:
-      successful = TPCCPayment{_num_warehouses, sql_executor}.execute();
+      successful = TPCCPayment{_num_warehouses, sql_executor, _use_point_operations}.execute();
       break;
     case 4:
       successful = TPCCStockLevel{_num_warehouses, sql_executor}.execute();
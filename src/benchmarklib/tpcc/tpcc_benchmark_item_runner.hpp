@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,7 +12,14 @@ namespace hyrise {
 
 class TPCCBenchmarkItemRunner : public AbstractBenchmarkItemRunner {
  public:
-  TPCCBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses);
+  // See TPCCPayment for use_point_operations and on_tables_loaded() for insert_chunk_count.
+  TPCCBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses,
+                          bool use_point_operations = false, uint32_t insert_chunk_count = 1);
+
+  // Sets the number of insert chunks of the tables (see Table::set_insert_chunk_count()). With multiple clients, the
+  // NewOrder and Payment transactions (and the Inserts of all UPDATEs) otherwise contend for the append mutex and the
+  // last chunk of the modified tables.
+  void on_tables_loaded() override;
 
   std::string item_name(const BenchmarkItemID item_id) const override;
   const std::vector<BenchmarkItemID>& items() const override;
@@ -22,6 +30,8 @@ class TPCCBenchmarkItemRunner : public AbstractBenchmarkItemRunner {
   bool _on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) override;
 
   const int _num_warehouses;
+  const bool _use_point_operations;
+  const uint32_t _insert_chunk_count;
 };
 
 }  // namespace hyrise
@@ -19,7 +19,6 @@
 #include "constants.hpp"
 #include "storage/chunk.hpp"
 #include "storage/constraints/constraint_utils.hpp"
-#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "types.hpp"
@@ -32,35 +31,43 @@ TPCCTableGenerator::TPCCTableGenerator(size_t num_warehouses, const std::shared_
 TPCCTableGenerator::TPCCTableGenerator(size_t num_warehouses, ChunkOffset chunk_size)
     : AbstractTableGenerator(create_benchmark_config_with_chunk_size(chunk_size)), _num_warehouses(num_warehouses) {}
 
+std::shared_ptr<Table> TPCCTableGenerator::_create_table(const TableColumnDefinitions& column_definitions,
+                                                         const GeneratedColumns& columns) const {
+  auto table =
+      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
+  table->append_columns(columns.spans);
+  return table;
+}
+
 std::shared_ptr<Table> TPCCTableGenerator::generate_item_table() {
   auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NUM_ITEMS});
 
   /**
    * indices[0] = item
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
   auto original_ids = _random_gen.select_unique_ids(NUM_ITEMS / 10, NUM_ITEMS);
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "I_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "I_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "I_IM_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "I_IM_ID", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return _random_gen.random_number(1, 10'000);
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "I_NAME", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "I_NAME", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(14, 24)};
                           });
-  _add_column<float>(segments_by_chunk, column_definitions, "I_PRICE", cardinalities,
+  _add_column<float>(columns, column_definitions, "I_PRICE", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return static_cast<float>(_random_gen.random_number(100, 10'000)) / 100.f;
                      });
   _add_column<pmr_string>(
-      segments_by_chunk, column_definitions, "I_DATA", cardinalities, [&](const std::vector<size_t>& indices) {
+      columns, column_definitions, "I_DATA", cardinalities, [&](const std::vector<size_t>& indices) {
         auto data = _random_gen.astring(26, 50);
         const auto is_original = original_ids.find(indices[0]) != original_ids.end();
         if (is_original) {
@@ -71,14 +78,7 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_item_table() {
         return pmr_string{data};
       });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_warehouse_table() {
@@ -87,55 +87,48 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_warehouse_table() {
   /**
    * indices[0] = warehouse
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_NAME", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_NAME", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(6, 10)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_STREET_1", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_STREET_1", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_STREET_2", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_STREET_2", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_CITY", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_CITY", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_STATE", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_STATE", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(2, 2)};
                           });
 
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "W_ZIP", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "W_ZIP", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.zip_code()};
                           });
-  _add_column<float>(segments_by_chunk, column_definitions, "W_TAX", cardinalities,
+  _add_column<float>(columns, column_definitions, "W_TAX", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return static_cast<float>(_random_gen.random_number(0, 2'000)) / 10'000.f;
                      });
-  _add_column<float>(segments_by_chunk, column_definitions, "W_YTD", cardinalities,
+  _add_column<float>(columns, column_definitions, "W_YTD", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT * NUM_DISTRICTS_PER_WAREHOUSE;
                      });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_stock_table() {
@@ -146,45 +139,45 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_stock_table() {
    * indices[0] = warehouse
    * indices[1] = stock
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
   auto original_ids = _random_gen.select_unique_ids(NUM_ITEMS / 10, NUM_ITEMS);
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_I_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_I_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_QUANTITY", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_QUANTITY", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return _random_gen.random_number(10, 100);
                        });
   for (auto district_i = int32_t{1}; district_i <= 10; district_i++) {
     auto district_i_str = std::stringstream{};
     district_i_str << std::setw(2) << std::setfill('0') << district_i;
-    _add_column<pmr_string>(segments_by_chunk, column_definitions, "S_DIST_" + district_i_str.str(), cardinalities,
+    _add_column<pmr_string>(columns, column_definitions, "S_DIST_" + district_i_str.str(), cardinalities,
                             [&](const std::vector<size_t>& /*indices*/) {
                               return pmr_string{_random_gen.astring(24, 24)};
                             });
   }
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_YTD", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_YTD", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 0;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_ORDER_CNT", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_ORDER_CNT", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 0;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "S_REMOTE_CNT", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "S_REMOTE_CNT", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 0;
                        });
   _add_column<pmr_string>(
-      segments_by_chunk, column_definitions, "S_DATA", cardinalities, [&](const std::vector<size_t>& indices) {
+      columns, column_definitions, "S_DATA", cardinalities, [&](const std::vector<size_t>& indices) {
         auto data = _random_gen.astring(26, 50);
         const auto is_original = original_ids.find(indices[1]) != original_ids.end();
         if (is_original) {
@@ -195,14 +188,7 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_stock_table() {
         return pmr_string{data};
       });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_district_table() {
@@ -213,63 +199,56 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_district_table() {
    * indices[0] = warehouse
    * indices[1] = district
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "D_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "D_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_NAME", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_NAME", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(6, 10)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_STREET_1", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_STREET_1", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_STREET_2", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_STREET_2", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_CITY", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_CITY", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_STATE", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_STATE", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(2, 2)};
                           });
 
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "D_ZIP", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "D_ZIP", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.zip_code()};
                           });
-  _add_column<float>(segments_by_chunk, column_definitions, "D_TAX", cardinalities,
+  _add_column<float>(columns, column_definitions, "D_TAX", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return static_cast<float>(_random_gen.random_number(0, 2'000)) / 10'000.f;
                      });
-  _add_column<float>(segments_by_chunk, column_definitions, "D_YTD", cardinalities,
+  _add_column<float>(columns, column_definitions, "D_YTD", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT;
                      });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "D_NEXT_O_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "D_NEXT_O_ID", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return NUM_ORDERS_PER_DISTRICT + 1;
                        });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_customer_table() {
@@ -281,103 +260,98 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_customer_table() {
    * indices[1] = district
    * indices[2] = customer
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
   auto original_ids = _random_gen.select_unique_ids(NUM_ITEMS / 10, NUM_ITEMS);
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[2] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_FIRST", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_FIRST", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(8, 16)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_MIDDLE", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_MIDDLE", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{"OE"};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_LAST", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_LAST", cardinalities,
                           [&](const std::vector<size_t>& indices) {
                             return pmr_string{_random_gen.last_name(indices[2])};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_STREET_1", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_STREET_1", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_STREET_2", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_STREET_2", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_CITY", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_CITY", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(10, 20)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_STATE", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_STATE", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(2, 2)};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_ZIP", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_ZIP", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.zip_code()};
                           });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_PHONE", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_PHONE", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.nstring(16, 16)};
                           });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_SINCE", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_SINCE", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return _current_date;
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_CREDIT", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_CREDIT", cardinalities,
                           [&](const std::vector<size_t>& indices) {
                             const auto is_original = original_ids.find(indices[2]) != original_ids.end();
                             return pmr_string{is_original ? "BC" : "GC"};
                           });
-  _add_column<float>(segments_by_chunk, column_definitions, "C_CREDIT_LIM", cardinalities,
+  _add_column<float>(columns, column_definitions, "C_CREDIT_LIM", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return 50'000;
                      });
-  _add_column<float>(segments_by_chunk, column_definitions, "C_DISCOUNT", cardinalities,
+  _add_column<float>(columns, column_definitions, "C_DISCOUNT", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return static_cast<float>(_random_gen.random_number(0, 5'000)) / 10'000.f;
                      });
-  _add_column<float>(segments_by_chunk, column_definitions, "C_BALANCE", cardinalities,
+  _add_column<float>(columns, column_definitions, "C_BALANCE", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return -CUSTOMER_YTD;
                      });
-  _add_column<float>(segments_by_chunk, column_definitions, "C_YTD_PAYMENT", cardinalities,
+  _add_column<float>(columns, column_definitions, "C_YTD_PAYMENT", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return CUSTOMER_YTD;
                      });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_PAYMENT_CNT", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_PAYMENT_CNT", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "C_DELIVERY_CNT", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "C_DELIVERY_CNT", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 0;
                        });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "C_DATA", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "C_DATA", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(300, 500)};
                           });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
+  auto table = _create_table(column_definitions, columns);
 
   _random_gen.reset_c_for_c_last();
 
@@ -394,50 +368,43 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_history_table() {
    * indices[2] = customer
    * indices[3] = history
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_C_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_C_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[2] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_C_D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_C_D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_C_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_C_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "H_DATE", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "H_DATE", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return _current_date;
                        });
-  _add_column<float>(segments_by_chunk, column_definitions, "H_AMOUNT", cardinalities,
+  _add_column<float>(columns, column_definitions, "H_AMOUNT", cardinalities,
                      [&](const std::vector<size_t>& /*indices*/) {
                        return 10.f;
                      });
-  _add_column<pmr_string>(segments_by_chunk, column_definitions, "H_DATA", cardinalities,
+  _add_column<pmr_string>(columns, column_definitions, "H_DATA", cardinalities,
                           [&](const std::vector<size_t>& /*indices*/) {
                             return pmr_string{_random_gen.astring(12, 24)};
                           });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_order_table(
@@ -450,57 +417,50 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_order_table(
    * indices[1] = district
    * indices[2] = order
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
   // TODO(anyone): generate a new customer permutation for each district and warehouse. Currently they all have the
   // same permutation
   auto customer_permutation = _random_gen.permutation(0, NUM_CUSTOMERS_PER_DISTRICT);
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[2] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_C_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_C_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return customer_permutation[indices[2]] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_ENTRY_D", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_ENTRY_D", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return _current_date;
                        });
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_CARRIER_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_CARRIER_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[2] + 1 <= NUM_ORDERS_PER_DISTRICT - NUM_NEW_ORDERS_PER_DISTRICT
                                     ? std::optional<int32_t>{_random_gen.random_number(1, 10)}
                                     : std::nullopt;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_OL_CNT", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_OL_CNT", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return order_line_counts[indices[0]][indices[1]][indices[2]];
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "O_ALL_LOCAL", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "O_ALL_LOCAL", cardinalities,
                        [&](const std::vector<size_t>& /*indices*/) {
                          return 1;
                        });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 TPCCTableGenerator::OrderLineCounts TPCCTableGenerator::generate_order_line_counts() const {
@@ -541,14 +501,14 @@ std::vector<std::optional<T>> TPCCTableGenerator::_generate_inner_order_line_col
 
 template <typename T>
 void TPCCTableGenerator::_add_order_line_column(
-    std::vector<Segments>& segments_by_chunk, TableColumnDefinitions& column_definitions, std::string name,
+    GeneratedColumns& columns, TableColumnDefinitions& column_definitions, std::string name,
     std::shared_ptr<std::vector<size_t>> cardinalities, TPCCTableGenerator::OrderLineCounts order_line_counts,
     const std::function<std::optional<T>(const std::vector<size_t>&)>& generator_function) {
   const std::function<std::vector<std::optional<T>>(const std::vector<size_t>&)> wrapped_generator_function =
       [&](const std::vector<size_t>& indices) {
         return _generate_inner_order_line_column(indices, order_line_counts, generator_function);
       };
-  _add_column<T>(segments_by_chunk, column_definitions, name, cardinalities, wrapped_generator_function);
+  _add_column<T>(columns, column_definitions, name, cardinalities, wrapped_generator_function);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_order_line_table(
@@ -562,63 +522,56 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_order_line_table(
    * indices[2] = order
    * indices[3] = order_line_size
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_O_ID", cardinalities, order_line_counts,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_O_ID", cardinalities, order_line_counts,
                                   [&](const std::vector<size_t>& indices) {
                                     return indices[2] + 1;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_D_ID", cardinalities, order_line_counts,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_D_ID", cardinalities, order_line_counts,
                                   [&](const std::vector<size_t>& indices) {
                                     return indices[1] + 1;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_W_ID", cardinalities, order_line_counts,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_W_ID", cardinalities, order_line_counts,
                                   [&](const std::vector<size_t>& indices) {
                                     return indices[0] + 1;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_NUMBER", cardinalities, order_line_counts,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_NUMBER", cardinalities, order_line_counts,
                                   [&](const std::vector<size_t>& indices) {
                                     return indices[3] + 1;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_I_ID", cardinalities, order_line_counts,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_I_ID", cardinalities, order_line_counts,
                                   [&](const std::vector<size_t>& /*indices*/) {
                                     return _random_gen.random_number(1, NUM_ITEMS);
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_SUPPLY_W_ID", cardinalities,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_SUPPLY_W_ID", cardinalities,
                                   order_line_counts, [&](const std::vector<size_t>& indices) {
                                     return indices[0] + 1;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_DELIVERY_D", cardinalities,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_DELIVERY_D", cardinalities,
                                   order_line_counts, [&](const std::vector<size_t>& indices) {
                                     return indices[2] + 1 <= NUM_ORDERS_PER_DISTRICT - NUM_NEW_ORDERS_PER_DISTRICT
                                                ? std::optional<int32_t>{_current_date}
                                                : std::nullopt;
                                   });
-  _add_order_line_column<int32_t>(segments_by_chunk, column_definitions, "OL_QUANTITY", cardinalities,
+  _add_order_line_column<int32_t>(columns, column_definitions, "OL_QUANTITY", cardinalities,
                                   order_line_counts, [&](const std::vector<size_t>& /*indices*/) {
                                     return 5;
                                   });
 
-  _add_order_line_column<float>(segments_by_chunk, column_definitions, "OL_AMOUNT", cardinalities, order_line_counts,
+  _add_order_line_column<float>(columns, column_definitions, "OL_AMOUNT", cardinalities, order_line_counts,
                                 [&](const std::vector<size_t>& indices) {
                                   return indices[2] < NUM_ORDERS_PER_DISTRICT - NUM_NEW_ORDERS_PER_DISTRICT
                                              ? 0.f
                                              : static_cast<float>(_random_gen.random_number(1, 999999)) / 100.f;
                                 });
-  _add_order_line_column<pmr_string>(segments_by_chunk, column_definitions, "OL_DIST_INFO", cardinalities,
+  _add_order_line_column<pmr_string>(columns, column_definitions, "OL_DIST_INFO", cardinalities,
                                      order_line_counts, [&](const std::vector<size_t>& /*indices*/) {
                                        return pmr_string{_random_gen.astring(24, 24)};
                                      });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::shared_ptr<Table> TPCCTableGenerator::generate_new_order_table() {
@@ -630,30 +583,23 @@ std::shared_ptr<Table> TPCCTableGenerator::generate_new_order_table() {
    * indices[1] = district
    * indices[2] = new_order
    */
-  auto segments_by_chunk = std::vector<Segments>{};
+  auto columns = GeneratedColumns{};
   auto column_definitions = TableColumnDefinitions{};
 
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "NO_O_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "NO_O_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[2] + 1 + NUM_ORDERS_PER_DISTRICT - NUM_NEW_ORDERS_PER_DISTRICT;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "NO_D_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "NO_D_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[1] + 1;
                        });
-  _add_column<int32_t>(segments_by_chunk, column_definitions, "NO_W_ID", cardinalities,
+  _add_column<int32_t>(columns, column_definitions, "NO_W_ID", cardinalities,
                        [&](const std::vector<size_t>& indices) {
                          return indices[0] + 1;
                        });
 
-  auto table =
-      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
-  for (const auto& segments : segments_by_chunk) {
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  return table;
+  return _create_table(column_definitions, columns);
 }
 
 std::unordered_map<std::string, BenchmarkTableInfo> TPCCTableGenerator::generate() {
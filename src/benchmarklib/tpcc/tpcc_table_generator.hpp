@@ -4,14 +4,18 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <boost/container/vector.hpp>
+
 #include "abstract_table_generator.hpp"
 #include "benchmark_config.hpp"
 #include "resolve_type.hpp"
+#include "storage/column_span.hpp"
 #include "tpcc_random_generator.hpp"
 
 namespace hyrise {
@@ -59,13 +63,25 @@ class TPCCTableGenerator : public AbstractTableGenerator {
   IndexesByTable _indexes_by_table() const override;
   void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const override;
 
+  // Typed values of the generated columns of a table, which are appended to the table in bulk via
+  // Table::append_columns() (see _create_table()).
+  struct GeneratedColumns {
+    std::vector<ColumnSpan> spans;
+
+    // Own the values and NULL flags that the spans reference.
+    std::vector<std::shared_ptr<const void>> buffers;
+  };
+
+  std::shared_ptr<Table> _create_table(const TableColumnDefinitions& column_definitions,
+                                       const GeneratedColumns& columns) const;
+
   template <typename T>
   std::vector<std::optional<T>> _generate_inner_order_line_column(
       const std::vector<size_t>& indices, OrderLineCounts order_line_counts,
       const std::function<std::optional<T>(const std::vector<size_t>&)>& generator_function);
 
   template <typename T>
-  void _add_order_line_column(std::vector<Segments>& segments_by_chunk, TableColumnDefinitions& column_definitions,
+  void _add_order_line_column(GeneratedColumns& columns, TableColumnDefinitions& column_definitions,
                               std::string name, std::shared_ptr<std::vector<size_t>> cardinalities,
                               OrderLineCounts order_line_counts,
                               const std::function<std::optional<T>(const std::vector<size_t>&)>& generator_function);
@@ -82,8 +98,8 @@ class TPCCTableGenerator : public AbstractTableGenerator {
    * However, this makes it hard to take care of a certain chunk size. With nested loops
    * chunks only contain as many rows as there are iterations in the most inner loop.
    *
-   * In this method we basically generate the whole column in a single loop,
-   * so that we can easily split when a Chunk is full. To do that we have all the cardinalities of the influencing
+   * In this method we basically generate the whole column in a single loop. Table::append_columns() later splits the
+   * columns into chunks (see _create_table()). To do that we have all the cardinalities of the influencing
    * tables:
    * E.g. for the CUSTOMER table we have the following cardinalities:
    * indices[0] = warehouse_size = 1
@@ -96,20 +112,17 @@ class TPCCTableGenerator : public AbstractTableGenerator {
    * generator that returns optionals but no nullopts, the column will not be nullable. For TPC-C, this is fine.
    *
    * @tparam T                  the type of the column
-   * @param table               the column shall be added to this table as well as column metadata
+   * @param columns             the generated values are added to these columns
+   * @param column_definitions  the column's definition is added to these definitions
    * @param name                the name of the column
    * @param cardinalities       the cardinalities of the different 'nested loops',
    *                            e.g. 10 districts per warehouse results in {1, 10}
    * @param generator_function  a lambda function to generate a vector of values for this column
    */
   template <typename T>
-  void _add_column(std::vector<Segments>& segments_by_chunk, TableColumnDefinitions& column_definitions,
+  void _add_column(GeneratedColumns& columns, TableColumnDefinitions& column_definitions,
                    std::string name, std::shared_ptr<std::vector<size_t>> cardinalities,
                    const std::function<std::vector<std::optional<T>>(const std::vector<size_t>&)>& generator_function) {
-    const auto chunk_size = _benchmark_config->chunk_size;
-
-    auto is_first_column = column_definitions.size() == 0;
-
     auto has_null_value = false;
 
     /**
@@ -119,17 +132,17 @@ class TPCCTableGenerator : public AbstractTableGenerator {
     auto loop_count =
         std::accumulate(std::begin(*cardinalities), std::end(*cardinalities), 1u, std::multiplies<size_t>());
 
-    auto data = pmr_vector<T>{};
-    data.reserve(chunk_size);
+    // The NULL flags are stored as contiguous bools (in contrast to std::vector<bool>), so that they can be passed as a
+    // ColumnSpan.
+    auto data = std::make_shared<std::vector<T>>();
+    data->reserve(loop_count);
 
-    auto null_values = pmr_vector<bool>{};
-    null_values.reserve(chunk_size);
+    auto null_values = std::make_shared<boost::container::vector<bool>>();
+    null_values->reserve(loop_count);
 
     /**
      * The loop over all records that the final column of the table will contain, e.g. loop_count = 30 000 for CUSTOMER
      */
-    auto row_index = size_t{0};
-
     for (auto loop_index = size_t{0}; loop_index < loop_count; ++loop_index) {
       auto indices = std::vector<size_t>(cardinalities->size());
 
@@ -155,57 +168,29 @@ class TPCCTableGenerator : public AbstractTableGenerator {
        * Pass in the previously generated indices to use them in 'generator_function',
        * e.g. when generating IDs.
        * We generate a vector of values with variable length
-       * and iterate it to add to the output segment.
+       * and iterate it to add to the output column.
        */
       auto values = generator_function(indices);
-      for (const auto& value : values) {
+      for (auto& value : values) {
         if (value) {
-          data.emplace_back(std::move(*value));
+          data->emplace_back(std::move(*value));
         } else {
-          data.emplace_back(T{});
+          data->emplace_back();
           has_null_value = true;
         }
-        null_values.emplace_back(!value);
-
-        // write output chunks if segment size has reached chunk_size
-        if (row_index % chunk_size == chunk_size - 1) {
-          auto value_segment = has_null_value
-                                   ? std::make_shared<ValueSegment<T>>(std::move(data), std::move(null_values))
-                                   : std::make_shared<ValueSegment<T>>(std::move(data));
-
-          // add Chunk if it is the first column, e.g. WAREHOUSE_ID in the example above
-          if (is_first_column) {
-            segments_by_chunk.emplace_back();
-            segments_by_chunk.back().emplace_back(value_segment);
-          } else {
-            ChunkID chunk_id{static_cast<uint32_t>(row_index / chunk_size)};
-            segments_by_chunk[chunk_id].emplace_back(value_segment);
-          }
-
-          // reset data
-          data = {};
-          data.reserve(chunk_size);
-
-          null_values = {};
-          null_values.reserve(chunk_size);
-        }
-        ++row_index;
+        null_values->emplace_back(!value);
       }
     }
 
-    // write partially filled last chunk
-    if (row_index % chunk_size != 0) {
-      auto value_segment = has_null_value ? std::make_shared<ValueSegment<T>>(std::move(data), std::move(null_values))
-                                          : std::make_shared<ValueSegment<T>>(std::move(data));
-
-      if (is_first_column) {
-        segments_by_chunk.emplace_back();
-        segments_by_chunk.back().emplace_back(value_segment);
-      } else {
-        ChunkID chunk_id{static_cast<ChunkID::base_type>(row_index / chunk_size)};
-        segments_by_chunk[chunk_id].emplace_back(value_segment);
-      }
+    Assert(columns.spans.empty() || columns.spans.front().size() == data->size(),
+           "All columns of a table must have the same number of values.");
+    if (has_null_value) {
+      columns.spans.emplace_back(*data, std::span<const bool>{null_values->data(), null_values->size()});
+      columns.buffers.emplace_back(null_values);
+    } else {
+      columns.spans.emplace_back(*data);
     }
+    columns.buffers.emplace_back(data);
 
     // add column definition
     auto data_type = data_type_from_type<T>();
@@ -216,21 +201,22 @@ class TPCCTableGenerator : public AbstractTableGenerator {
    * This method simplifies the interface for columns where only a single element is added in the inner loop.
    *
    * @tparam T                  the type of the column
-   * @param table               the column shall be added to this table as well as column metadata
+   * @param columns             the generated values are added to these columns
+   * @param column_definitions  the column's definition is added to these definitions
    * @param name                the name of the column
    * @param cardinalities       the cardinalities of the different 'nested loops',
    *                            e.g. 10 districts per warehouse results in {1, 10}
    * @param generator_function  a lambda function to generate a value for this column
    */
   template <typename T>
-  void _add_column(std::vector<Segments>& segments_by_chunk, TableColumnDefinitions& column_definitions,
+  void _add_column(GeneratedColumns& columns, TableColumnDefinitions& column_definitions,
                    std::string name, std::shared_ptr<std::vector<size_t>> cardinalities,
                    const std::function<T(const std::vector<size_t>&)>& generator_function) {
     const std::function<std::vector<T>(const std::vector<size_t>&)> wrapped_generator_function =
         [generator_function](const std::vector<size_t>& indices) {
           return std::vector<T>({generator_function(indices)});
         };
-    _add_column(segments_by_chunk, column_definitions, name, cardinalities, wrapped_generator_function);
+    _add_column(columns, column_definitions, name, cardinalities, wrapped_generator_function);
   }
 
   /**
@@ -243,14 +229,14 @@ class TPCCTableGenerator : public AbstractTableGenerator {
    * generator that returns optionals but no nullopts, the column will not be nullable. For TPC-C, this is fine.
    */
   template <typename T>
-  void _add_column(std::vector<Segments>& segments_by_chunk, TableColumnDefinitions& column_definitions,
+  void _add_column(GeneratedColumns& columns, TableColumnDefinitions& column_definitions,
                    std::string name, std::shared_ptr<std::vector<size_t>> cardinalities,
                    const std::function<std::optional<T>(const std::vector<size_t>&)>& generator_function) {
     const std::function<std::vector<std::optional<T>>(const std::vector<size_t>&)> wrapped_generator_function =
         [generator_function](const std::vector<size_t>& indices) {
           return std::vector<std::optional<T>>({generator_function(indices)});
         };
-    _add_column(segments_by_chunk, column_definitions, name, cardinalities, wrapped_generator_function);
+    _add_column(columns, column_definitions, name, cardinalities, wrapped_generator_function);
   }
 };
 }  // namespace hyrise
@@ -0,0 +1,302 @@
+#include "result_cache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+ResultCache::TableVersion table_version(const std::shared_ptr<const Table>& table) {
+  auto table_version = ResultCache::TableVersion{};
+  table_version.table = table;
+
+  if (table->uses_mvcc() == UseMvcc::No) {
+    table_version.row_count = table->row_count();
+  } else {
+    table_version.last_commit_id = table->last_commit_id();
+  }
+
+  return table_version;
+}
+
+// Copies the values of reference tables into ValueSegments. Otherwise, cached results would keep the referenced stored
+// tables alive (even after they were dropped), and their memory usage would not account for the referenced data.
+std::shared_ptr<const Table> materialize_result(const std::shared_ptr<const Table>& result) {
+  if (result->type() == TableType::Data) {
+    return result;
+  }
+
+  const auto column_count = result->column_count();
+  const auto chunk_count = result->chunk_count();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = result->get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    const auto chunk_size = chunk->size();
+    auto segments = Segments{};
+    segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto column_is_nullable = result->column_is_nullable(column_id);
+      resolve_data_type(result->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        auto values = pmr_vector<ColumnDataType>(chunk_size);
+        auto null_values = pmr_vector<bool>(column_is_nullable ? chunk_size : 0);
+        auto chunk_offset = size_t{0};
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          if (position.is_null()) {
+            null_values[chunk_offset] = true;
+          } else {
+            values[chunk_offset] = position.value();
+          }
+          ++chunk_offset;
+        });
+
+        if (column_is_nullable) {
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    const auto output_chunk = std::make_shared<Chunk>(std::move(segments));
+    output_chunk->set_immutable();
+    output_chunks.emplace_back(output_chunk);
+  }
+
+  return std::make_shared<Table>(result->column_definitions(), TableType::Data, std::move(output_chunks));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+bool ResultCache::TableVersion::operator==(const TableVersion& other) const {
+  const auto same_table = !table.owner_before(other.table) && !other.table.owner_before(table);
+  return same_table && last_commit_id == other.last_commit_id && row_count == other.row_count;
+}
+
+bool ResultCache::GDFSCacheEntry::operator<(const GDFSCacheEntry& other) const {
+  return priority > other.priority;
+}
+
+ResultCache::ResultCache(const size_t capacity) : _capacity{capacity} {}
+
+std::optional<ResultCache::TableVersions> ResultCache::table_versions(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto table_versions = TableVersions{};
+  auto cacheable = true;
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::StoredTable: {
+          const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+          if (!storage_manager.has_table(table_name)) {
+            cacheable = false;
+            return LQPVisitation::DoNotVisitInputs;
+          }
+          table_versions.emplace_back(table_version(storage_manager.get_table(table_name)));
+        } break;
+
+        // Static tables hold data that does not belong to a stored table (e.g., meta tables, which reflect the current
+        // system state). Mock nodes are only used in tests and cannot be executed.
+        case LQPNodeType::StaticTable:
+        case LQPNodeType::Mock:
+          cacheable = false;
+          return LQPVisitation::DoNotVisitInputs;
+
+        default:
+          break;
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  if (!cacheable) {
+    return std::nullopt;
+  }
+  return table_versions;
+}
+
+std::shared_ptr<const Table> ResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                  const std::optional<CommitID> snapshot_commit_id) {
+  // Determine the current table versions before acquiring the lock, as this requires visiting the LQP.
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (!_map.contains(lqp)) {
+      return nullptr;
+    }
+  }
+
+  const auto current_table_versions = table_versions(lqp);
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto iter = _map.find(lqp);
+  if (iter == _map.end()) {
+    return nullptr;
+  }
+
+  const auto handle = iter->second;
+  auto& entry = *handle;
+  if (!current_table_versions || *current_table_versions != entry.table_versions) {
+    // A writer committed to one of the tables (or a table was replaced). The entry will never be valid again.
+    _erase(handle);
+    return nullptr;
+  }
+
+  // The result reflects commits that the transaction does not see yet.
+  if (snapshot_commit_id && entry.last_commit_id > *snapshot_commit_id) {
+    return nullptr;
+  }
+
+  ++entry.frequency;
+  _update_priority(handle);
+  return entry.result;
+}
+
+void ResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const TableVersions& table_versions,
+                      const std::shared_ptr<const Table>& result, const std::optional<CommitID> snapshot_commit_id,
+                      const std::chrono::nanoseconds execution_duration) {
+  DebugAssert(result, "Cannot cache empty result.");
+
+  // Tables might have been modified while the query was executed. We do not know whether the result includes these
+  // modifications.
+  const auto current_table_versions = ResultCache::table_versions(lqp);
+  if (!current_table_versions || *current_table_versions != table_versions) {
+    return;
+  }
+
+  // The result might lack commits that are already included in the table versions (i.e., commits that happened after
+  // the transaction started). In this case, we do not know which version the result reflects.
+  const auto last_commit_id = _last_commit_id(table_versions);
+  if (snapshot_commit_id && last_commit_id > *snapshot_commit_id) {
+    return;
+  }
+
+  const auto materialized_result = materialize_result(result);
+  const auto size = std::max(materialized_result->memory_usage(MemoryUsageCalculationMode::Sampled), size_t{1});
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (size > _capacity) {
+    return;
+  }
+
+  // Entries of dropped tables can never be used again. Remove them so that they do not occupy the capacity.
+  for (auto iter = _map.begin(); iter != _map.end();) {
+    const auto handle = iter->second;
+    ++iter;
+    const auto& entry_table_versions = (*handle).table_versions;
+    if (std::any_of(entry_table_versions.cbegin(), entry_table_versions.cend(), [](const auto& table_version) {
+          return table_version.table.expired();
+        })) {
+      _erase(handle);
+    }
+  }
+
+  const auto iter = _map.find(lqp);
+  if (iter != _map.end()) {
+    _erase(iter->second);
+  }
+
+  while (_memory_usage + size > _capacity) {
+    _evict();
+  }
+
+  auto entry = GDFSCacheEntry{};
+  // The LQPTranslator might modify mutable fields of the query's LQP. Thus, we store a copy as the key.
+  entry.lqp = lqp->deep_copy();
+  entry.result = materialized_result;
+  entry.table_versions = table_versions;
+  entry.last_commit_id = last_commit_id;
+  entry.size = size;
+  entry.cost = std::max(static_cast<double>(execution_duration.count()), 1.0);
+  entry.priority = _inflation + static_cast<double>(entry.frequency) * entry.cost / static_cast<double>(entry.size);
+
+  const auto handle = _queue.push(entry);
+  _map.emplace((*handle).lqp, handle);
+  _memory_usage += size;
+}
+
+size_t ResultCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _map.size();
+}
+
+size_t ResultCache::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_usage;
+}
+
+size_t ResultCache::capacity() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _capacity;
+}
+
+void ResultCache::resize(const size_t capacity) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  while (_memory_usage > capacity) {
+    _evict();
+  }
+  _capacity = capacity;
+}
+
+void ResultCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _map.clear();
+  _queue.clear();
+  _memory_usage = 0;
+}
+
+CommitID ResultCache::_last_commit_id(const TableVersions& table_versions) {
+  auto last_commit_id = CommitID{0};
+  for (const auto& table_version : table_versions) {
+    last_commit_id = std::max(last_commit_id, table_version.last_commit_id);
+  }
+  return last_commit_id;
+}
+
+void ResultCache::_update_priority(const Handle& handle) {
+  auto& entry = *handle;
+  entry.priority = _inflation + static_cast<double>(entry.frequency) * entry.cost / static_cast<double>(entry.size);
+  _queue.update(handle);
+}
+
+void ResultCache::_erase(const Handle& handle) {
+  _memory_usage -= (*handle).size;
+  _map.erase((*handle).lqp);
+  _queue.erase(handle);
+}
+
+void ResultCache::_evict() {
+  DebugAssert(!_queue.empty(), "Cannot evict from empty cache.");
+  _inflation = _queue.top().priority;
+  _erase(_queue.s_handle_from_iterator(_queue.begin()));
+}
+
+}  // namespace hyrise
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/heap/fibonacci_heap.hpp>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Caches the results of read-only queries so that identical queries over unchanged tables are not executed again,
+ * e.g., when BI tools re-issue the same aggregations every few seconds. Results are keyed by the optimized LQP, which
+ * normalizes the query text. The SQLPipelineStatement uses the cache for SELECT statements if a cache is set (see
+ * SQLPipelineBuilder::with_result_cache() and Hyrise::default_result_cache).
+ *
+ * Invalidation: Each entry stores the versions of the stored tables that the plan reads (see TableVersion). A writer
+ * that commits to one of these tables changes the table's version, so that try_get() drops the entry instead of
+ * returning it. With MVCC, an entry is only returned to transactions whose snapshot includes the commits that the
+ * result reflects. Entries are not used within explicit transactions, as these might read their own uncommitted
+ * changes.
+ *
+ * Eviction: The capacity is the memory (in bytes) that the cached results may occupy. When the cache is full, entries
+ * are evicted following the GDFS policy (see GDFSCache). Different from the plan caches, the priority of an entry also
+ * accounts for the execution time of the query, so that expensive results are kept longer.
+ */
+class ResultCache : public Noncopyable {
+ public:
+  /**
+   * The version of a stored table is its last commit ID of an insert or delete (see Table::last_commit_id()). For
+   * tables without MVCC data, we use the row count instead, as rows can only be appended to these tables. As tables
+   * that are dropped and re-created get a new version, the version also identifies the table itself.
+   */
+  struct TableVersion {
+    std::weak_ptr<const Table> table;
+    CommitID last_commit_id{0};
+    uint64_t row_count{0};
+
+    bool operator==(const TableVersion& other) const;
+  };
+
+  using TableVersions = std::vector<TableVersion>;
+
+  static constexpr auto DEFAULT_CAPACITY = size_t{256} * 1024 * 1024;
+
+  explicit ResultCache(const size_t capacity = DEFAULT_CAPACITY);
+
+  /**
+   * Returns the versions of the stored tables that the LQP (including its subqueries) reads or std::nullopt if the
+   * result of the LQP must not be cached, e.g., because it reads meta tables. The versions have to be taken before the
+   * query is executed and passed to set() afterwards, so that modifications during the execution are noticed.
+   */
+  static std::optional<TableVersions> table_versions(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  /**
+   * Returns the cached result of the LQP if it reflects the current versions of the tables and, with MVCC, is visible
+   * for the given snapshot. Returns nullptr otherwise. Entries of modified tables are removed.
+   */
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                       const std::optional<CommitID> snapshot_commit_id);
+
+  /**
+   * Caches the result of the LQP. The result is not cached if the tables were modified since @param table_versions
+   * were taken or if it includes commits that are not visible for the snapshot of the executing transaction. Reference
+   * tables are materialized, so that cached results do not keep stored tables alive and their size is accounted for.
+   */
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const TableVersions& table_versions,
+           const std::shared_ptr<const Table>& result, const std::optional<CommitID> snapshot_commit_id,
+           const std::chrono::nanoseconds execution_duration);
+
+  // Number of cached results.
+  size_t size() const;
+
+  // Memory usage of the cached results in bytes.
+  size_t memory_usage() const;
+
+  size_t capacity() const;
+  void resize(const size_t capacity);
+
+  void clear();
+
+ protected:
+  struct GDFSCacheEntry {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    std::shared_ptr<const Table> result;
+    TableVersions table_versions;
+
+    // Highest commit ID of the table versions. With MVCC, only transactions that see this commit can use the result.
+    CommitID last_commit_id{0};
+
+    size_t frequency{1};
+    size_t size{1};
+    double cost{1.0};
+    double priority{0.0};
+
+    // The underlying heap is a max-heap. To have the item with lowest priority at the top, we invert the comparison.
+    bool operator<(const GDFSCacheEntry& other) const;
+  };
+
+  using Handle = boost::heap::fibonacci_heap<GDFSCacheEntry>::handle_type;
+
+  static CommitID _last_commit_id(const TableVersions& table_versions);
+
+  void _update_priority(const Handle& handle);
+  void _erase(const Handle& handle);
+  void _evict();
+
+  mutable std::mutex _mutex;
+
+  boost::heap::fibonacci_heap<GDFSCacheEntry> _queue;
+  LQPNodeUnorderedMap<Handle> _map;
+
+  size_t _capacity;
+  size_t _memory_usage{0};
+
+  // Inflation value that is updated whenever an item is evicted.
+  double _inflation{0.0};
+};
+
+}  // namespace hyrise
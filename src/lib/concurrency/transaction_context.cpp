@@ -19,10 +19,9 @@ TransactionContext::TransactionContext(const TransactionID transaction_id, const
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
       _is_auto_commit{is_auto_commit},
+      _snapshot_slot{Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id)},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {
-  Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
-}
+      _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
   DebugAssert(([this]() {
@@ -55,7 +54,7 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_slot, _snapshot_commit_id);
 }
 
 TransactionID TransactionContext::transaction_id() const {
@@ -98,6 +97,7 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
   }
 
   _mark_as_rolled_back(rollback_reason);
+  _finalize_read_write_operators();
 }
 
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
@@ -108,6 +108,7 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
   }
 
   _mark_as_pending_and_try_commit(callback);
+  _finalize_read_write_operators();
 }
 
 void TransactionContext::commit() {
@@ -119,15 +120,42 @@ void TransactionContext::commit() {
     return;
   }
 
+  if (Hyrise::get().transaction_manager.commit_mode() == CommitMode::Asynchronous) {
+    _prepare_commit();
+
+    for (const auto& op : _read_write_operators) {
+      op->commit_records(commit_id());
+    }
+
+    // The commit is ordered and cannot fail anymore. Do not wait until the preceding transactions have been committed.
+    _transition(TransactionPhase::Committing, TransactionPhase::Committed);
+    _mark_as_pending_and_try_commit(nullptr, CommitMode::Asynchronous);
+    _finalize_read_write_operators();
+    return;
+  }
+
   auto committed = std::promise<void>{};
   const auto committed_future = committed.get_future();
   const auto callback = [&committed](TransactionID /*unused*/) {
     committed.set_value();
   };
 
-  commit_async(callback);
+  _prepare_commit();
+
+  for (const auto& op : _read_write_operators) {
+    op->commit_records(commit_id());
+  }
+
+  _mark_as_pending_and_try_commit(callback);
 
   committed_future.wait();
+  _finalize_read_write_operators();
+}
+
+void TransactionContext::_finalize_read_write_operators() {
+  for (const auto& op : _read_write_operators) {
+    op->finalize_records();
+  }
 }
 
 void TransactionContext::_mark_as_conflicted() {
@@ -173,7 +201,8 @@ void TransactionContext::_prepare_commit() {
   _commit_context = Hyrise::get().transaction_manager._new_commit_context();
 }
 
-void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback) {
+void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback,
+                                                         const CommitMode commit_mode) {
   DebugAssert(([this]() {
                 for (const auto& op : _read_write_operators) {
                   if (op->state() != ReadWriteOperatorState::Committed) {
@@ -185,9 +214,9 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
               "All read/write operators need to have been committed.");
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
-    // If the transaction context still exists, set its phase to Committed.
-    if (auto context_ptr = context_weak_ptr.lock()) {
+  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback, commit_mode](auto transaction_id) {
+    // If the transaction context still exists and it is not committed asynchronously, set its phase to Committed.
+    if (auto context_ptr = context_weak_ptr.lock(); context_ptr && commit_mode == CommitMode::Synchronous) {
       context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
     }
 
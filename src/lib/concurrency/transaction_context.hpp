@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
 #include "types.hpp"
 
 namespace hyrise {
@@ -116,7 +117,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * With CommitMode::Synchronous (see TransactionManager::set_commit_mode()), blocks until the transaction is actually
+   * committed. With CommitMode::Asynchronous, returns once the commit is ordered.
    */
   void commit();
 
@@ -183,11 +185,18 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    * will be committed after those.
    *
    * @param callback called when transaction is committed
+   * @param commit_mode if CommitMode::Asynchronous, the phase has already been set to Committed
    */
-  void _mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback);
+  void _mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback,
+                                       const CommitMode commit_mode = CommitMode::Synchronous);
 
   /**@}*/
 
+  /**
+   * Calls finalize_records() on all read-write operators once the transaction left the commit window.
+   */
+  void _finalize_read_write_operators();
+
   void _wait_for_active_operators_to_finish() const;
 
   /**
@@ -200,6 +209,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const CommitID _snapshot_commit_id;
   const AutoCommit _is_auto_commit;
 
+  // Slot in which the TransactionManager tracks the snapshot commit ID while the transaction is active.
+  const size_t _snapshot_slot;
+
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
 
   std::atomic<TransactionPhase> _phase;
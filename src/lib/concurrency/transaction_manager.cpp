@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -19,7 +20,9 @@ TransactionManager::TransactionManager()
       _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(std::all_of(_snapshot_slots.cbegin(), _snapshot_slots.cend(),
+                     [](const auto& slot) { return slot.snapshot_commit_id == UNUSED_SNAPSHOT_COMMIT_ID; }) &&
+             _overflow_snapshot_commit_ids.empty(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
@@ -27,7 +30,11 @@ TransactionManager& TransactionManager::operator=(TransactionManager&& transacti
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
   _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _commit_mode = transaction_manager._commit_mode.load();
+  for (auto slot = size_t{0}; slot < SNAPSHOT_SLOT_COUNT; ++slot) {
+    _snapshot_slots[slot].snapshot_commit_id = transaction_manager._snapshot_slots[slot].snapshot_commit_id.load();
+  }
+  _overflow_snapshot_commit_ids = transaction_manager._overflow_snapshot_commit_ids;
   return *this;
 }
 
@@ -35,41 +42,96 @@ CommitID TransactionManager::last_commit_id() const {
   return _last_commit_id;
 }
 
+CommitID TransactionManager::last_assigned_commit_id() const {
+  return std::atomic_load(&_last_commit_context)->commit_id();
+}
+
+void TransactionManager::wait_for_commit(const CommitID commit_id) const {
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id) {
+    _last_commit_id.wait(last_commit_id);
+    last_commit_id = _last_commit_id.load();
+  }
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(const AutoCommit auto_commit) {
   const CommitID snapshot_commit_id = _last_commit_id;
   return std::make_shared<TransactionContext>(TransactionID{_next_transaction_id++}, snapshot_commit_id, auto_commit);
 }
 
-void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
-}
-
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+size_t TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  // Threads are assigned consecutive start positions. As long as there are fewer threads than slots and each thread
+  // has a single active transaction, every thread claims its own slot on the first attempt.
+  static auto next_first_slot = std::atomic<size_t>{0};
+  thread_local const auto first_slot = next_first_slot++ % SNAPSHOT_SLOT_COUNT;
+
+  for (auto offset = size_t{0}; offset < SNAPSHOT_SLOT_COUNT; ++offset) {
+    const auto slot = (first_slot + offset) % SNAPSHOT_SLOT_COUNT;
+    auto& slot_commit_id = _snapshot_slots[slot].snapshot_commit_id;
+
+    // Check the slot before trying to claim it to avoid acquiring the cache line exclusively for occupied slots.
+    auto expected_commit_id = UNUSED_SNAPSHOT_COMMIT_ID;
+    if (slot_commit_id.load(std::memory_order_relaxed) == UNUSED_SNAPSHOT_COMMIT_ID &&
+        slot_commit_id.compare_exchange_strong(expected_commit_id, snapshot_commit_id)) {
+      return slot;
+    }
+  }
 
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+  const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+  _overflow_snapshot_commit_ids.insert(snapshot_commit_id);
+  return OVERFLOW_SNAPSHOT_SLOT;
+}
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
+void TransactionManager::_deregister_transaction(const size_t snapshot_slot, const CommitID snapshot_commit_id) {
+  if (snapshot_slot != OVERFLOW_SNAPSHOT_SLOT) {
+    Assert(snapshot_slot < SNAPSHOT_SLOT_COUNT, "Invalid snapshot slot.");
+    auto expected_commit_id = snapshot_commit_id;
+    const auto success =
+        _snapshot_slots[snapshot_slot].snapshot_commit_id.compare_exchange_strong(expected_commit_id,
+                                                                                  UNUSED_SNAPSHOT_COMMIT_ID);
+    Assert(success,
+           "Snapshot slot does not hold the snapshot_commit_id. Therefore, the removal failed and the function should "
+           "not have been called.");
     return;
   }
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+  const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+
+  const auto it = _overflow_snapshot_commit_ids.find(snapshot_commit_id);
+  Assert(it != _overflow_snapshot_commit_ids.end(),
+         "Could not find snapshot_commit_id in TransactionManager's _overflow_snapshot_commit_ids. Therefore, the "
+         "removal failed and the function should not have been called.");
+  _overflow_snapshot_commit_ids.erase(it);
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  auto lowest_snapshot_commit_id = UNUSED_SNAPSHOT_COMMIT_ID;
+  for (const auto& slot : _snapshot_slots) {
+    lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+    if (!_overflow_snapshot_commit_ids.empty()) {
+      lowest_snapshot_commit_id =
+          std::min(lowest_snapshot_commit_id,
+                   *std::min_element(_overflow_snapshot_commit_ids.cbegin(), _overflow_snapshot_commit_ids.cend()));
+    }
+  }
+
+  if (lowest_snapshot_commit_id == UNUSED_SNAPSHOT_COMMIT_ID) {
     return std::nullopt;
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return lowest_snapshot_commit_id;
+}
+
+CommitMode TransactionManager::commit_mode() const {
+  return _commit_mode;
+}
+
+void TransactionManager::set_commit_mode(const CommitMode commit_mode) {
+  _commit_mode = commit_mode;
 }
 
 /**
@@ -114,17 +176,46 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+/**
+ * Group commit
+ *
+ * A commit ID can only be published once all smaller commit IDs have been published. Thus, committing transactions
+ * queue up behind the oldest pending one. Instead of publishing each commit ID with a separate compare-and-swap, the
+ * thread that finds the commit context directly following the last published one to be pending becomes the leader of
+ * a group: It collects the following consecutive pending commit contexts and publishes the commit ID of the last one
+ * with a single compare-and-swap. Only afterwards, it fires the callbacks of the group, which wake up the committing
+ * threads. As the records of each transaction have already been committed by its own thread (see
+ * TransactionContext::commit_async()), the leader only publishes the commit IDs.
+ *
+ * If the compare-and-swap fails, another thread published (parts of) the group or the preceding commit ID has not been
+ * published yet. In both cases, the other thread or the one publishing the preceding commit ID continues. After
+ * publishing a group, the leader checks if the next commit context became pending in the meantime. Its committing
+ * thread might have failed to publish it as the group had not been published yet.
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
   auto current_context = context;
 
   while (current_context->is_pending()) {
-    auto expected_last_commit_id = CommitID{current_context->commit_id() - 1};
+    auto last_context = current_context;
+    while (last_context->has_next() && last_context->next()->is_pending()) {
+      last_context = last_context->next();
+    }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) {
+    auto expected_last_commit_id = CommitID{current_context->commit_id() - 1};
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, last_context->commit_id())) {
       return;
     }
 
-    current_context->fire_callback();
+    // Wake up threads that wait for the published commit IDs (see wait_for_commit()).
+    _last_commit_id.notify_all();
+
+    while (true) {
+      current_context->fire_callback();
+      if (current_context == last_context) {
+        break;
+      }
+      current_context = current_context->next();
+    }
 
     if (!current_context->has_next()) {
       return;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -42,6 +44,16 @@ namespace hyrise {
 class CommitContext;
 class TransactionContext;
 
+/**
+ * With CommitMode::Synchronous, TransactionContext::commit() blocks until the transaction's changes are visible to
+ * new transactions, i.e., until all transactions with smaller commit IDs have been committed as well. With
+ * CommitMode::Asynchronous, commit() returns as soon as the commit is ordered, i.e., the transaction has a commit ID
+ * and its records have been committed. The transaction is then considered committed, as it cannot be rolled back
+ * anymore, but its changes only become visible once all preceding transactions have been committed. Thus, a
+ * subsequent transaction of the same client is not guaranteed to see them.
+ */
+enum class CommitMode { Synchronous, Asynchronous };
+
 /**
  * The TransactionManager is responsible for a consistent assignment of
  * transaction and commit ids. It also keeps track of the last commit id
@@ -54,6 +66,13 @@ class TransactionManager : public Noncopyable {
  public:
   CommitID last_commit_id() const;
 
+  // Returns the commit ID that was handed out last. Transactions up to this commit ID might still be committing.
+  CommitID last_assigned_commit_id() const;
+
+  // Blocks until the transactions up to @param commit_id are committed and their changes are visible, i.e., until
+  // last_commit_id() reaches the commit ID. Woken up whenever commit IDs are published.
+  void wait_for_commit(const CommitID commit_id) const;
+
   /**
    * Creates a new transaction context
    * @param is_auto_commit declares whether the transaction is created (and will also commit) automatically. The
@@ -63,10 +82,14 @@ class TransactionManager : public Noncopyable {
   std::shared_ptr<TransactionContext> new_transaction_context(const AutoCommit auto_commit);
 
   /**
-   * Returns the lowest snapshot-commit-id currently used by a transaction.
+   * Returns the lowest snapshot-commit-id currently used by a transaction. The minimum is not maintained but computed
+   * on each call by scanning all snapshot slots (see _register_transaction()).
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
+  CommitMode commit_mode() const;
+  void set_commit_mode(const CommitMode commit_mode);
+
  private:
   TransactionManager();
   ~TransactionManager();
@@ -77,16 +100,25 @@ class TransactionManager : public Noncopyable {
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
   std::shared_ptr<CommitContext> _new_commit_context();
+
+  /**
+   * Publishes the commit IDs of pending commit contexts, starting with the given one (see the implementation for
+   * details). Consecutive pending commit contexts are published as a group by a single thread.
+   */
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
   /**
-   * The TransactionManager keeps track of issued snapshot-commit-ids,
-   * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * The TransactionManager keeps track of issued snapshot-commit-ids, which are in use by unfinished transactions.
+   * Since every transaction registers and deregisters its snapshot-commit-id, a single mutex-protected set would
+   * serialize all transactions. Instead, each active snapshot-commit-id occupies one of SNAPSHOT_SLOT_COUNT slots,
+   * which is claimed with a compare-and-swap. Each thread starts its search for an unused slot at a different position
+   * so that threads usually neither contend for the same slot nor for the same cache line. Only if all slots are in
+   * use, the snapshot-commit-id is stored in a mutex-protected multiset.
+   *
+   * _register_transaction() returns the slot that has to be passed to _deregister_transaction().
    */
-  void _register_transaction(CommitID snapshot_commit_id);
-  void _deregister_transaction(CommitID snapshot_commit_id);
+  size_t _register_transaction(CommitID snapshot_commit_id);
+  void _deregister_transaction(size_t snapshot_slot, CommitID snapshot_commit_id);
 
   // We use the base type here, as `_next_transaction_id` is not passed further around and atomic operations such as
   // `++_next_transactions_id` are not directly possible with an `std::atomic<TransactionID>`.
@@ -99,7 +131,21 @@ class TransactionManager : public Noncopyable {
 
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _active_snapshot_commit_ids_mutex;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  std::atomic<CommitMode> _commit_mode{CommitMode::Synchronous};
+
+  static constexpr auto SNAPSHOT_SLOT_COUNT = size_t{1024};
+  // Returned by _register_transaction() if the snapshot-commit-id is stored in _overflow_snapshot_commit_ids.
+  static constexpr auto OVERFLOW_SNAPSHOT_SLOT = SNAPSHOT_SLOT_COUNT;
+  static constexpr auto UNUSED_SNAPSHOT_COMMIT_ID = CommitID{std::numeric_limits<CommitID::base_type>::max()};
+
+  // Each slot is padded to a cache line to avoid false sharing between threads.
+  struct alignas(64) SnapshotSlot {
+    std::atomic<CommitID> snapshot_commit_id{UNUSED_SNAPSHOT_COMMIT_ID};
+  };
+
+  std::array<SnapshotSlot, SNAPSHOT_SLOT_COUNT> _snapshot_slots;
+
+  mutable std::mutex _overflow_snapshot_commit_ids_mutex;
+  std::unordered_multiset<CommitID> _overflow_snapshot_commit_ids;
 };
 }  // namespace hyrise
@@ -7,7 +7,10 @@
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/task_tracer.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/workload_manager.hpp"
+#include "storage/cooperative_scan_registry.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/meta_table_manager.hpp"
@@ -31,6 +34,9 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  workload_manager = WorkloadManager{};
+  task_tracer = TaskTracer{};
+  cooperative_scan_registry = CooperativeScanRegistry{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
@@ -2,10 +2,14 @@
 
 #include <memory>
 
+#include "cache/result_cache.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/task_tracer.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/workload_manager.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/cooperative_scan_registry.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/log_manager.hpp"
 #include "utils/meta_table_manager.hpp"
@@ -46,12 +50,19 @@ class Hyrise : public Singleton<Hyrise> {
   SettingsManager settings_manager;
   LogManager log_manager;
   Topology topology;
+  WorkloadManager workload_manager;
+  TaskTracer task_tracer;
+  CooperativeScanRegistry cooperative_scan_registry;
 
   // Plan caches used by the SQLPipelineBuilder if `with_{l/p}qp_cache()` are not used. Both default caches can be
   // nullptr themselves. If both default_{l/p}qp_cache and _{l/p}qp_cache are nullptr, no plan caching is used.
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Result cache used by the SQLPipelineBuilder if `with_result_cache()` is not used. Results are only cached if a
+  // cache is set (see ResultCache).
+  std::shared_ptr<ResultCache> default_result_cache;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
@@ -1,9 +1,9 @@
 #include "binary_parser.hpp"
 
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
-#include <fstream>
-#include <ios>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -12,8 +12,15 @@
 #include <utility>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "all_type_variant.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "resolve_type.hpp"
+#include "storage/abstract_segment_loader.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
@@ -34,60 +41,215 @@
 #include "utils/assert.hpp"
 #include "utils/enum_constant.hpp"
 
+namespace {
+
+// Maps a file read-only into memory and unmaps it on destruction.
+class MemoryMappedFile {
+ public:
+  explicit MemoryMappedFile(const std::string& filename) {
+    const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+    Assert(file_descriptor != -1, "Could not open binary file '" + filename + "': " + std::strerror(errno));
+
+    struct stat file_status {};
+
+    if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0) {
+      _size = static_cast<size_t>(file_status.st_size);
+      _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    }
+    const auto mmap_errno = errno;
+    close(file_descriptor);
+
+    Assert(_size > 0, "Binary file '" + filename + "' is empty or its size could not be determined.");
+    Assert(_data != MAP_FAILED, "Could not map binary file '" + filename + "': " + std::strerror(mmap_errno));
+  }
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+  MemoryMappedFile(MemoryMappedFile&&) = delete;
+  MemoryMappedFile& operator=(MemoryMappedFile&&) = delete;
+
+  ~MemoryMappedFile() {
+    if (_data != MAP_FAILED) {
+      munmap(_data, _size);
+    }
+  }
+
+  const char* data() const {
+    return static_cast<const char*>(_data);
+  }
+
+  // Tells the kernel that the file is read front to back, so that it can read ahead aggressively.
+  void advise_sequential_access() const {
+    madvise(_data, _size, MADV_SEQUENTIAL);
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  // Releases the pages that lie entirely within [begin, end) from the mapping once their data was copied. The file's
+  // contents remain in the page cache and are mapped again if they are accessed again.
+  void release_pages(const char* begin, const char* end) const {
+    static const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto first_page = (reinterpret_cast<uintptr_t>(begin) + page_size - 1) / page_size * page_size;
+    const auto last_page = reinterpret_cast<uintptr_t>(end) / page_size * page_size;
+    if (first_page < last_page) {
+      madvise(reinterpret_cast<void*>(first_page), last_page - first_page, MADV_DONTNEED);
+    }
+  }
+
+ private:
+  void* _data{MAP_FAILED};
+  size_t _size{0};
+};
+
+}  // namespace
+
 namespace hyrise {
 
+class BinaryParser::LazySegmentLoader : public AbstractSegmentLoader {
+ public:
+  LazySegmentLoader(const std::shared_ptr<const MemoryMappedFile>& mapped_file,
+                    const std::shared_ptr<const TableColumnDefinitions>& column_definitions,
+                    const ChunkOffset row_count, std::vector<uint64_t>&& segment_offsets)
+      : _mapped_file(mapped_file),
+        _column_definitions(column_definitions),
+        _row_count(row_count),
+        _segment_offsets(std::move(segment_offsets)) {}
+
+  ChunkOffset row_count() const override {
+    return _row_count;
+  }
+
+  std::shared_ptr<AbstractSegment> load_segment(const ColumnID column_id) const override {
+    auto file = FileReader{_mapped_file->data(), _mapped_file->data() + _mapped_file->size()};
+    const auto* const segment_begin = _read_bytes(file, _segment_offsets[column_id]) + _segment_offsets[column_id];
+
+    const auto& column_definition = (*_column_definitions)[column_id];
+    const auto segment = _import_segment(file, _row_count, column_definition.data_type, column_definition.nullable);
+
+    // The segment owns a copy of its data, so the mapped pages are not needed anymore. As BinaryWriter aligns segments
+    // to pages, all pages of the segment are released.
+    _mapped_file->release_pages(segment_begin, file.position);
+    return segment;
+  }
+
+ private:
+  // The loaders of all chunks share the mapping, which is unmapped when the last chunk is destroyed.
+  std::shared_ptr<const MemoryMappedFile> _mapped_file;
+  std::shared_ptr<const TableColumnDefinitions> _column_definitions;
+  ChunkOffset _row_count;
+  std::vector<uint64_t> _segment_offsets;
+};
+
 std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  const auto mapped_file = std::make_shared<const MemoryMappedFile>(filename);
+  const auto entire_file = FileReader{mapped_file->data(), mapped_file->data() + mapped_file->size()};
+  auto file = entire_file;
 
   auto [table, chunk_count] = _read_header(file);
+  const auto column_count = table->column_count();
+
+  auto segment_index = _find_segment_index(entire_file, chunk_count, column_count);
+  if (!segment_index) {
+    mapped_file->advise_sequential_access();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      _import_chunk(file, table);
+    }
+
+    return table;
+  }
+
+  // Only read the chunk headers. The segments are loaded on first access.
+  const auto column_definitions = std::make_shared<const TableColumnDefinitions>(table->column_definitions());
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    auto chunk_file = entire_file;
+    _read_bytes(chunk_file, _read_value<uint64_t>(*segment_index));
+    const auto [row_count, sorted_columns] = _read_chunk_header(chunk_file);
+
+    auto segment_offsets = std::vector<uint64_t>(column_count);
+    for (auto& segment_offset : segment_offsets) {
+      segment_offset = _read_value<uint64_t>(*segment_index);
+    }
+
+    table->append_chunk(
+        std::make_shared<LazySegmentLoader>(mapped_file, column_definitions, row_count, std::move(segment_offsets)),
+        std::make_shared<MvccData>(row_count, CommitID{0}));
+    table->last_chunk()->set_immutable();
+    if (!sorted_columns.empty()) {
+      table->last_chunk()->set_individually_sorted_by(sorted_columns);
+    }
   }
 
   return table;
 }
 
+std::optional<BinaryParser::FileReader> BinaryParser::_find_segment_index(const FileReader& file,
+                                                                          const ChunkID chunk_count,
+                                                                          const ColumnCount column_count) {
+  const auto trailer_size = 2 * sizeof(uint64_t);
+  const auto file_size = static_cast<size_t>(file.end - file.position);
+  if (file_size < trailer_size) {
+    return std::nullopt;
+  }
+
+  auto trailer = FileReader{file.end - trailer_size, file.end};
+  const auto segment_index_offset = _read_value<uint64_t>(trailer);
+  if (_read_value<uint64_t>(trailer) != BinaryWriter::SEGMENT_INDEX_MAGIC_NUMBER) {
+    return std::nullopt;
+  }
+
+  const auto segment_index_size =
+      static_cast<size_t>(chunk_count) * (static_cast<size_t>(column_count) + 1) * sizeof(uint64_t);
+  Assert(segment_index_offset + segment_index_size + trailer_size == file_size, "Invalid segment index.");
+  return FileReader{file.position + segment_index_offset, file.end - trailer_size};
+}
+
+const char* BinaryParser::_read_bytes(FileReader& file, const size_t byte_count) {
+  Assert(static_cast<size_t>(file.end - file.position) >= byte_count, "Unexpected end of binary file.");
+  const auto* const bytes = file.position;
+  file.position += byte_count;
+  return bytes;
+}
+
 template <typename T>
-pmr_compact_vector BinaryParser::_read_values_compact_vector(std::ifstream& file, const size_t count) {
+pmr_compact_vector BinaryParser::_read_values_compact_vector(FileReader& file, const size_t count) {
   const auto bit_width = _read_value<uint8_t>(file);
   auto values = pmr_compact_vector(bit_width, count);
-  file.read(reinterpret_cast<char*>(values.get()), static_cast<int64_t>(values.bytes()));
+  std::memcpy(values.get(), _read_bytes(file, values.bytes()), values.bytes());
   return values;
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+pmr_vector<T> BinaryParser::_read_values(FileReader& file, const size_t count) {
+  auto values = pmr_vector<T>(count);
+  std::memcpy(values.data(), _read_bytes(file, count * sizeof(T)), count * sizeof(T));
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(FileReader& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()),
-            static_cast<int64_t>(readable_bools.size() * sizeof(BoolAsByteType)));
-  return {readable_bools.begin(), readable_bools.end()};
+pmr_vector<bool> BinaryParser::_read_values(FileReader& file, const size_t count) {
+  static_assert(sizeof(BoolAsByteType) == 1, "Booleans are expected to be stored as single bytes.");
+  const auto* const readable_bools = _read_bytes(file, count);
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(FileReader& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  const auto* const buffer = _read_bytes(file, total_length);
 
   auto values = pmr_vector<pmr_string>{count};
   auto start = size_t{0};
   for (auto index = size_t{0}; index < count; ++index) {
-    values[index] = pmr_string{buffer.data() + start, buffer.data() + start + string_lengths[index]};
+    values[index] = pmr_string{buffer + start, string_lengths[index]};
     start += string_lengths[index];
   }
 
@@ -95,13 +257,13 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
-  T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+T BinaryParser::_read_value(FileReader& file) {
+  auto result = T{};
+  std::memcpy(&result, _read_bytes(file, sizeof(T)), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(FileReader& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -121,7 +283,7 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+std::pair<ChunkOffset, std::vector<SortColumnDefinition>> BinaryParser::_read_chunk_header(FileReader& file) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   // Import sort column definitions
@@ -133,6 +295,12 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
     sorted_columns.emplace_back(column_id, sort_mode);
   }
 
+  return {row_count, std::move(sorted_columns)};
+}
+
+void BinaryParser::_import_chunk(FileReader& file, std::shared_ptr<Table>& table) {
+  const auto [row_count, sorted_columns] = _read_chunk_header(file);
+
   Segments output_segments;
   for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
     output_segments.push_back(
@@ -142,12 +310,12 @@ void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   const auto mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
   table->append_chunk(output_segments, mvcc_data);
   table->last_chunk()->set_immutable();
-  if (num_sorted_columns > 0) {
+  if (!sorted_columns.empty()) {
     table->last_chunk()->set_individually_sorted_by(sorted_columns);
   }
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(FileReader& file, ChunkOffset row_count,
                                                                DataType data_type, bool column_is_nullable) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -159,7 +327,7 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(FileReader& file, ChunkOffset row_count,
                                                                bool column_is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -192,7 +360,7 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(FileReader& file, ChunkOffset row_count,
                                                                      bool column_is_nullable) {
   if (column_is_nullable) {
     const auto segment_is_nullable = _read_value<bool>(file);
@@ -208,7 +376,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(FileReader& file,
                                                                                ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -220,7 +388,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    FileReader& file, ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -230,7 +398,7 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(FileReader& file,
                                                                               ChunkOffset /*row_count*/) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -241,7 +409,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(FileReader& file,
                                                                                              ChunkOffset row_count) {
   const auto compressed_vector_type_id = _read_value<CompressedVectorTypeID>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -259,7 +427,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(FileReader& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -304,7 +472,7 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
 }
 
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    FileReader& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -322,7 +490,7 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
+    FileReader& file, const ChunkOffset row_count, const CompressedVectorTypeID compressed_vector_type_id) {
   const auto compressed_vector_type = static_cast<CompressedVectorType>(compressed_vector_type_id);
   switch (compressed_vector_type) {
     case CompressedVectorType::BitPacking:
@@ -339,10 +507,9 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(FileReader& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
-  pmr_vector<char> values(string_length * count);
-  file.read(values.data(), static_cast<int64_t>(values.size()));
+  auto values = _read_values<char>(file, string_length * count);
   return std::make_shared<FixedStringVector>(std::move(values), string_length);
 }
 
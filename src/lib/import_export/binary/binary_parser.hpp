@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -23,6 +22,20 @@ namespace hyrise {
 /*
  * This parser reads an Hyrise binary file and creates a table from that input.
  * Documentation of the file formats can be found in BinaryWriter header file.
+ *
+ * The file is memory-mapped and values are copied directly from the mapping into the vectors of the created segments.
+ * Compared to reading through a stream, this avoids the stream's buffer and the intermediate vectors that were needed
+ * for strings and booleans, so that every value is copied only once.
+ *
+ * If the file ends with a segment index (see BinaryWriter::write()), only the header and the chunk headers are read.
+ * The segments are loaded from the mapping when they are accessed for the first time (see AbstractSegmentLoader), so
+ * that pages of the file are only read for segments that are used. The file stays mapped as long as the table exists.
+ * As the segments of such files are page-aligned, the pages of a loaded segment are released from the mapping.
+ *
+ * Loading is not zero-copy: Segments own their data in (polymorphic-allocator) vectors, which cannot wrap the mapped
+ * pages. Thus, the data of a segment is copied out of the mapping once, when the segment is loaded. Wrapping the
+ * mapping directly would require segment types that do not own their data, which all segment accesses (iterators,
+ * accessors, encoders, and the BinaryWriter itself) would have to support.
  */
 class BinaryParser {
  public:
@@ -40,12 +53,29 @@ class BinaryParser {
   static std::shared_ptr<Table> parse(const std::string& filename);
 
  private:
+  // Current read position within the memory-mapped file. Reading a value advances the position.
+  struct FileReader {
+    const char* position;
+    const char* end;
+  };
+
+  // Returns a pointer to the next `byte_count` bytes of the file and advances the read position.
+  static const char* _read_bytes(FileReader& file, const size_t byte_count);
+
+  // Loads the segments of a chunk from the memory-mapped file (see AbstractSegmentLoader).
+  class LazySegmentLoader;
+
+  // Returns a reader for the segment index (see BinaryWriter::_write_segment_index()) or std::nullopt if the file does
+  // not end with a segment index. `file` has to cover the entire file.
+  static std::optional<FileReader> _find_segment_index(const FileReader& file, const ChunkID chunk_count,
+                                                       const ColumnCount column_count);
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(FileReader& file);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -59,59 +89,62 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static void _import_chunk(FileReader& file, std::shared_ptr<Table>& table);
+
+  // Reads the row count and the sort column definitions of a chunk.
+  static std::pair<ChunkOffset, std::vector<SortColumnDefinition>> _read_chunk_header(FileReader& file);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(FileReader& file, ChunkOffset row_count,
                                                           DataType data_type, bool column_is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<AbstractSegment> _import_segment(FileReader& file, ChunkOffset row_count,
                                                           bool column_is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(FileReader& file, ChunkOffset row_count,
                                                                 bool column_is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(FileReader& file, ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      FileReader& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file,
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(FileReader& file,
                                                                          ChunkOffset /*row_count*/);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(FileReader& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(FileReader& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given compressed_vector_type_id.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      FileReader& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
+      FileReader& file, ChunkOffset row_count, CompressedVectorTypeID compressed_vector_type_id);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(FileReader& file, const size_t count);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(FileReader& file, const size_t count);
 
   // Reads bit width and row_count many values and returns them in a bitpacked compact_vector of type T
   template <typename T>
-  static pmr_compact_vector _read_values_compact_vector(std::ifstream& file, const size_t count);
+  static pmr_compact_vector _read_values_compact_vector(FileReader& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(FileReader& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(FileReader& file);
 };
 
 }  // namespace hyrise
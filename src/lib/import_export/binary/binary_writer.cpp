@@ -3,9 +3,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <ios>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -108,21 +110,69 @@ void export_compact_vector(std::ofstream& ofstream, const pmr_compact_vector& va
   ofstream.write(reinterpret_cast<const char*>(values.get()), static_cast<int64_t>(values.bytes()));
 }
 
+// Pads the file with zero bytes up to the next multiple of `alignment`.
+void export_padding(std::ofstream& ofstream, const uint64_t alignment) {
+  const auto position = static_cast<uint64_t>(ofstream.tellp());
+  const auto padding = std::vector<char>((alignment - position % alignment) % alignment, 0);
+  export_values(ofstream, padding);
+}
+
+// Removes the file when it goes out of scope, unless it was released. Used to clean up temporary files if writing
+// them fails.
+class TemporaryFileGuard : public Noncopyable {
+ public:
+  explicit TemporaryFileGuard(const std::string& filename) : _filename{filename} {}
+
+  ~TemporaryFileGuard() {
+    if (!_is_released) {
+      auto error_code = std::error_code{};
+      std::filesystem::remove(_filename, error_code);
+    }
+  }
+
+  void release() {
+    _is_released = true;
+  }
+
+ private:
+  const std::string _filename;
+  bool _is_released{false};
+};
+
 }  // namespace
 
 namespace hyrise {
 
-void BinaryWriter::write(const Table& table, const std::string& filename) {
+void BinaryWriter::write(const Table& table, const std::string& filename, const bool write_segment_index) {
+  const auto temporary_filename = filename + ".tmp";
+  auto temporary_file_guard = TemporaryFileGuard{temporary_filename};
+
   std::ofstream ofstream;
   ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
+  ofstream.open(temporary_filename, std::ios::binary);
 
   _write_header(table, ofstream);
 
+  auto offsets = std::vector<uint64_t>{};
   const auto chunk_count = table.chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    _write_chunk(table, ofstream, chunk_id);
+    _write_chunk(table, ofstream, chunk_id, offsets, write_segment_index);
+  }
+
+  if (write_segment_index) {
+    _write_segment_index(offsets, ofstream);
   }
+
+  ofstream.close();
+  std::filesystem::rename(temporary_filename, filename);
+  temporary_file_guard.release();
+}
+
+void BinaryWriter::_write_segment_index(const std::vector<uint64_t>& offsets, std::ofstream& ofstream) {
+  const auto segment_index_offset = static_cast<uint64_t>(ofstream.tellp());
+  export_values(ofstream, offsets);
+  export_value(ofstream, segment_index_offset);
+  export_value(ofstream, SEGMENT_INDEX_MAGIC_NUMBER);
 }
 
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
@@ -147,9 +197,11 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
   export_string_values(ofstream, column_names);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id,
+                                std::vector<uint64_t>& offsets, const bool align_segments) {
   const auto chunk = table.get_chunk(chunk_id);
   Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  offsets.push_back(static_cast<uint64_t>(ofstream.tellp()));
   export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
 
   // Export sort column definitions
@@ -163,6 +215,10 @@ void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, con
   // Iterating over all segments of this chunk and exporting them
   const auto column_count = chunk->column_count();
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (align_segments) {
+      export_padding(ofstream, SEGMENT_ALIGNMENT);
+    }
+    offsets.push_back(static_cast<uint64_t>(ofstream.tellp()));
     resolve_data_and_segment_type(*chunk->get_segment(column_id),
                                   [&](const auto /*data_type_t*/, const auto& resolved_segment) {
                                     _write_segment(resolved_segment, table.column_is_nullable(column_id), ofstream);
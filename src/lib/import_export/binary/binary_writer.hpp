@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,7 +20,23 @@ enum class CompressedVectorType : uint8_t;
 
 class BinaryWriter {
  public:
-  static void write(const Table& table, const std::string& filename);
+  /**
+   * Writes the table to the given file. If `write_segment_index` is set, a segment index is appended (see
+   * _write_segment_index()), which allows the BinaryParser to load the segments lazily. Furthermore, each segment is
+   * then padded to start at a multiple of SEGMENT_ALIGNMENT. As such files cannot be read sequentially, older readers
+   * fail on them. Without the index, the output is unchanged.
+   *
+   * The file is written under a temporary name and then renamed, so that tables that were lazily loaded from a
+   * previous version of the file keep reading the previous version. If writing fails, the temporary file is removed.
+   */
+  static void write(const Table& table, const std::string& filename, const bool write_segment_index = false);
+
+  // Marks the end of files with a segment index. The value is arbitrary.
+  static constexpr auto SEGMENT_INDEX_MAGIC_NUMBER = uint64_t{0x5844'4e49'5447'4553};
+
+  // Alignment of the segments in files with a segment index. As it matches the usual page size, the pages that hold a
+  // segment do not hold data of other segments and can be released once the segment was loaded.
+  static constexpr auto SEGMENT_ALIGNMENT = uint64_t{4096};
 
  private:
   /**
@@ -49,8 +66,25 @@ class BinaryWriter {
    *
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
+   * The offsets of the chunk and its segments within the file are appended to `offsets`. If `align_segments` is set,
+   * each segment is preceded by zero bytes so that it starts at a multiple of SEGMENT_ALIGNMENT.
+   */
+  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id,
+                           std::vector<uint64_t>& offsets, const bool align_segments);
+
+  /**
+   * The segment index stores the offsets of the chunks and their segments within the file. It is written after the
+   * chunks with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Offsets¹                    | uint64_t array                      | Chunk count * (Column count + 1) * 8
+   * Offset of the segment index | uint64_t                            | 8
+   * Magic number                | uint64_t                            | 8
+   *
+   * ¹: For each chunk, the offset of its header is followed by the offsets of its segments.
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_segment_index(const std::vector<uint64_t>& offsets, std::ofstream& ofstream);
 
   /**
    * ValueSegments are dumped with the following layout:
@@ -4,22 +4,23 @@
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/container/vector.hpp>
 
 #include "csv_meta.hpp"
-#include "storage/abstract_segment.hpp"
-#include "storage/value_segment.hpp"
+#include "storage/column_span.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
 
 /*
- * CsvConverter is a helper class that creates a ValueSegment by converting the given null terminated strings and placing
- * them at the given position.
+ * CsvConverter is a helper class that converts the given null terminated strings and places them at the given
+ * position. The converted values are appended to the table via Table::append_columns() (see column_span()).
  * The base class BaseCsvConverter allows us to handle different types of columns uniformly.
  */
 
@@ -30,9 +31,8 @@ class BaseCsvConverter {
   // Converts value to the underlying data type and saves it at the given position.
   virtual void insert(std::string& value, ChunkOffset position) = 0;
 
-  // Returns the segment that contains the previously converted values.
-  // After the call of finish, no other operation should be called.
-  virtual std::unique_ptr<AbstractSegment> finish() = 0;
+  // Returns a view on the previously converted values, which is valid as long as the converter exists.
+  virtual ColumnSpan column_span() const = 0;
 
   /*
    * This is a helper function that removes surrounding quotes of the given csv field and all escape characters.
@@ -84,12 +84,12 @@ class CsvConverter : public BaseCsvConverter {
     _parsed_values[position] = _get_conversion_function()(value);
   }
 
-  std::unique_ptr<AbstractSegment> finish() override {
+  ColumnSpan column_span() const override {
     if (_is_nullable) {
-      return std::make_unique<ValueSegment<T>>(std::move(_parsed_values), std::move(_null_values));
-    } else {
-      return std::make_unique<ValueSegment<T>>(std::move(_parsed_values));
+      return ColumnSpan{_parsed_values, std::span<const bool>{_null_values.data(), _null_values.size()}};
     }
+
+    return ColumnSpan{_parsed_values};
   }
 
  private:
@@ -101,7 +101,10 @@ class CsvConverter : public BaseCsvConverter {
    */
   std::function<T(const std::string&)> _get_conversion_function();
   pmr_vector<T> _parsed_values;
-  pmr_vector<bool> _null_values;
+
+  // The NULL flags are stored as contiguous bools (in contrast to std::vector<bool>), so that they can be passed as a
+  // ColumnSpan.
+  boost::container::vector<bool> _null_values;
   const bool _is_nullable;
   ParseConfig _config;
 };
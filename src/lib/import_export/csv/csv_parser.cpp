@@ -8,7 +8,6 @@
 #include <ios>
 #include <list>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -22,7 +21,6 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
-#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "types.hpp"
@@ -77,14 +75,13 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
   auto content_view = std::string_view{content.c_str(), content.size()};
 
   // Save chunks in list to avoid memory relocation
-  auto segments_by_chunks = std::list<Segments>{};
+  auto converters_by_chunks = std::list<std::vector<std::unique_ptr<BaseCsvConverter>>>{};
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
   auto field_ends = std::vector<size_t>{};
-  auto append_chunk_mutex = std::mutex{};
   while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
     // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+    converters_by_chunks.emplace_back();
+    auto& converters = converters_by_chunks.back();
 
     // Only pass the part of the string that is actually needed to the parsing task
     auto relevant_content = std::string_view{content_view.substr(0, field_ends.back())};
@@ -93,19 +90,33 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     content_view = content_view.substr(field_ends.back() + 1);
 
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
-    }));
+    tasks.emplace_back(
+        std::make_shared<JobTask>([relevant_content, field_ends, &table, &converters, &meta, &escaped_linebreak]() {
+          _parse_into_chunk(relevant_content, field_ends, *table, converters, meta, escaped_linebreak);
+        }));
     tasks.back()->schedule();
   }
 
   Hyrise::get().scheduler()->wait_for_tasks(tasks);
 
-  for (auto& segments : segments_by_chunks) {
-    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
+  // Each parsed chunk holds up to target_chunk_size rows, so that appending them in order creates the same chunks. The
+  // parsed values of a chunk are released once they are appended.
+  const auto column_count = table->column_count();
+  while (!converters_by_chunks.empty()) {
+    const auto& converters = converters_by_chunks.front();
+    DebugAssert(converters.size() == column_count, "Expected one converter per column.");
+    auto column_spans = std::vector<ColumnSpan>{};
+    column_spans.reserve(column_count);
+    for (const auto& converter : converters) {
+      column_spans.emplace_back(converter->column_span());
+    }
+
+    table->append_columns(column_spans);
+    converters_by_chunks.pop_front();
+  }
+
+  // All other chunks have been marked as immutable by `Table::append_columns()` when they reached their capacity.
+  if (!table->empty()) {
     table->last_chunk()->set_immutable();
   }
 
@@ -189,12 +200,11 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
 }
 
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
-                                    const Table& table, Segments& segments, const CsvMeta& meta,
-                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
-  // For each csv column, create a CsvConverter which builds up a ValueSegment
+                                    const Table& table, std::vector<std::unique_ptr<BaseCsvConverter>>& converters,
+                                    const CsvMeta& meta, const std::string& escaped_linebreak) {
+  // For each csv column, create a CsvConverter which holds the column's parsed values
   const auto column_count = table.column_count();
   const auto row_count = ChunkOffset{static_cast<ChunkOffset::base_type>(field_ends.size() / column_count)};
-  auto converters = std::vector<std::unique_ptr<BaseCsvConverter>>{};
 
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
     const auto is_nullable = table.column_is_nullable(column_id);
@@ -234,14 +244,6 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
          ":\n" + exception.what());
   }
 
-  // Transform the field_offsets to segments and add segments to chunk.
-  {
-    const auto lock = std::lock_guard<std::mutex>{append_chunk_mutex};
-    for (auto& converter : converters) {
-      segments.push_back(converter->finish());
-    }
-  }
-
   return row_count;
 }
 
@@ -10,6 +10,7 @@
 
 namespace hyrise {
 
+class BaseCsvConverter;
 class Table;
 class Chunk;
 
@@ -23,7 +24,8 @@ class Chunk;
  *
  * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
  * csv rows.
- * Each data chunk is parsed and converted into a Hyrise chunk. In the end all chunks are combined to the final table.
+ * The data chunks are parsed in parallel. In the end, the parsed values are appended to the final table chunk by chunk
+ * (see Table::append_columns()).
  */
 class CsvParser {
  public:
@@ -57,12 +59,12 @@ class CsvParser {
    * @param      csv_chunk  String_view on one chunk of the CSV.
    * @param      field_ends Positions of the field ends of the given \p csv_chunk.
    * @param      table      Empty table created by _process_meta_file.
-   * @param[out] segments   The segments of the chunk, to be populated with data
+   * @param[out] converters The converters of the chunk's columns, which hold the parsed values
    * @returns               The number of rows in the chunk
    */
   static size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
-                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak,
-                                  std::mutex& append_chunk_mutex);
+                                  std::vector<std::unique_ptr<BaseCsvConverter>>& converters, const CsvMeta& meta,
+                                  const std::string& escaped_linebreak);
 
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
@@ -0,0 +1,72 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+#include <numa.h>
+#endif
+
+#include <cstddef>
+#include <new>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+namespace {
+
+bool node_exists(const NodeID node_id) {
+#if HYRISE_NUMA_SUPPORT
+  return numa_available() >= 0 && static_cast<int>(node_id) <= numa_max_node();
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+NumaMemoryResource::NumaMemoryResource(const NodeID node_id) : _node_id(node_id), _node_exists(node_exists(node_id)) {}
+
+NodeID NumaMemoryResource::node_id() const {
+  return _node_id;
+}
+
+void* NumaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (!_use_numa_allocation(bytes)) {
+    return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+  }
+
+#if HYRISE_NUMA_SUPPORT
+  // numa_alloc_onnode() returns page-aligned memory, which satisfies all alignments we use.
+  auto* const pointer = numa_alloc_onnode(bytes, static_cast<int>(_node_id));
+  if (!pointer) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+#else
+  Fail("Allocating memory on a NUMA node requires NUMA support.");
+#endif
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  if (!_use_numa_allocation(bytes)) {
+    boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+#if HYRISE_NUMA_SUPPORT
+  numa_free(pointer, bytes);
+#endif
+}
+
+bool NumaMemoryResource::do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT {
+  return &other == this;
+}
+
+bool NumaMemoryResource::_use_numa_allocation(const std::size_t bytes) const {
+  return _node_exists && bytes >= NUMA_ALLOCATION_THRESHOLD;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+#include <boost/config.hpp>  // IWYU pragma: keep
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Memory resource that allocates memory on a given NUMA node. Chunks that were migrated to a NumaMemoryResource (see
+ * Chunk::migrate()) report the node they live on (see Chunk::node_id()), so that operators can process them on that
+ * node.
+ *
+ * Only large allocations are placed using libnuma, as numa_alloc_onnode() maps whole pages and is too expensive for
+ * the many small allocations of, e.g., strings. Small allocations as well as all allocations of builds without NUMA
+ * support (or for nodes that do not physically exist, as in fake NUMA topologies) are served by the default memory
+ * resource. As the deallocation receives the same size as the allocation, we can decide on the path by size alone.
+ *
+ * Instances are obtained from Topology::get_memory_resource() and are never destroyed, as chunks might outlive the
+ * topology (see boost_default_memory_resource.cpp).
+ */
+class NumaMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  // Allocations of at least this size are placed on the node using libnuma.
+  static constexpr auto NUMA_ALLOCATION_THRESHOLD = size_t{64 * 1024};
+
+  explicit NumaMemoryResource(const NodeID node_id);
+
+  NodeID node_id() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  [[nodiscard]] bool do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT override;
+
+ private:
+  bool _use_numa_allocation(const std::size_t bytes) const;
+
+  const NodeID _node_id;
+  const bool _node_exists;
+};
+
+}  // namespace hyrise
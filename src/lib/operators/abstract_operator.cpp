@@ -18,6 +18,7 @@
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "operators/operator_performance_data.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
@@ -75,6 +76,11 @@ bool AbstractOperator::executed() const {
 }
 
 void AbstractOperator::execute() {
+  auto coroutine = execute_coroutine();
+  coroutine.run();
+}
+
+TaskCoroutine AbstractOperator::execute_coroutine() {
   /**
    * If an operator has already executed, we return immediately. Either because
    *    a) the output has already been set, or
@@ -82,7 +88,7 @@ void AbstractOperator::execute() {
    * For detailed scenarios see: https://github.com/hyrise/hyrise/pull/2254#discussion_r565253226
    */
   if (executed()) {
-    return;
+    co_return;
   }
   _transition_to(OperatorState::Running);
 
@@ -103,14 +109,14 @@ void AbstractOperator::execute() {
      * tasks of the Transaction run while the Rollback happens.
      */
     if (transaction_context->aborted()) {
-      return;
+      co_return;
     }
 
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    co_await _on_execute_coroutine(transaction_context);
     transaction_context->on_operator_finished();
   } else {
-    _output = _on_execute(nullptr);
+    co_await _on_execute_coroutine(nullptr);
   }
 
   // release any temporary data if possible
@@ -189,6 +195,11 @@ void AbstractOperator::execute() {
   }
 }
 
+TaskCoroutine AbstractOperator::_on_execute_coroutine(std::shared_ptr<TransactionContext> context) {
+  _output = _on_execute(std::move(context));
+  co_return;
+}
+
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   Assert(_state == OperatorState::ExecutedAndAvailable,
          "Trying to get_output of operator which is not in OperatorState::ExecutedAndAvailable.");
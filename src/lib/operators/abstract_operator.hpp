@@ -10,6 +10,7 @@
 #include "all_parameter_variant.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operator_performance_data.hpp"
+#include "scheduler/coroutine_task.hpp"
 
 namespace hyrise {
 
@@ -40,6 +41,7 @@ enum class OperatorType {
   JoinSortMerge,
   JoinVerification,
   Limit,
+  PointUpdate,
   Print,
   Product,
   Projection,
@@ -123,8 +125,13 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   OperatorType type() const;
 
+  // Executes the operator and returns once it is done. Jobs spawned by the operator are waited for synchronously.
+  void execute();
+
+  // Executes the operator as a coroutine (see OperatorTask). Operators that await their jobs (see
+  // _on_execute_coroutine()) suspend the coroutine while the jobs run instead of blocking the worker.
   // Overriding implementations need to call on_operator_started/finished() on the _transaction_context as well
-  virtual void execute();
+  virtual TaskCoroutine execute_coroutine();
 
   /**
    * @return true if the operator finished execution, regardless of whether the results have already been cleared.
@@ -224,6 +231,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) = 0;
 
+  // Operators that parallelize their work using JobTasks can override this coroutine instead of _on_execute() and
+  // co_await AbstractScheduler::schedule_and_await_tasks(). The coroutine sets _output. By default, it calls
+  // _on_execute().
+  virtual TaskCoroutine _on_execute_coroutine(std::shared_ptr<TransactionContext> context);
+
   // method that allows operator-specific cleanups for temporary data.
   // separate from _on_execute for readability and as a reminder to
   // clean up after execution (if it makes sense)
@@ -4,6 +4,7 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "storage/table.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
@@ -11,4 +12,8 @@ std::shared_ptr<const Table> AbstractReadOnlyOperator::_on_execute(std::shared_p
   return _on_execute();
 }
 
+std::shared_ptr<const Table> AbstractReadOnlyOperator::_on_execute() {
+  Fail("Operator implements neither _on_execute() nor _on_execute_coroutine().");
+}
+
 }  // namespace hyrise
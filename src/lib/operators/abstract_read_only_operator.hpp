@@ -19,7 +19,8 @@ class AbstractReadOnlyOperator : public AbstractOperator {
   // Apart from Validate and GetTable, none of the read-only operators needs the transaction context.
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> /*context*/) override;
 
-  virtual std::shared_ptr<const Table> _on_execute() = 0;
+  // Operators that override _on_execute_coroutine() (e.g., TableScan) do not need to implement this method.
+  virtual std::shared_ptr<const Table> _on_execute();
 
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
@@ -5,6 +5,7 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "operators/abstract_operator.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -15,9 +16,10 @@ AbstractReadWriteOperator::AbstractReadWriteOperator(const OperatorType type,
                                                      const std::shared_ptr<const AbstractOperator>& right)
     : AbstractOperator(type, left, right), _rw_state(ReadWriteOperatorState::Pending) {}
 
-void AbstractReadWriteOperator::execute() {
+TaskCoroutine AbstractReadWriteOperator::execute_coroutine() {
   Assert(static_cast<bool>(transaction_context()),
-         "AbstractReadWriteOperator::execute() should never be called without having set the transaction context.");
+         "AbstractReadWriteOperator::execute_coroutine() should never be called without having set the transaction "
+         "context.");
   Assert(transaction_context()->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
   Assert(_rw_state == ReadWriteOperatorState::Pending, "Operator needs to have state Pending in order to be executed.");
 
@@ -25,7 +27,7 @@ void AbstractReadWriteOperator::execute() {
       std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
 
   try {
-    AbstractOperator::execute();
+    co_await AbstractOperator::execute_coroutine();
   } catch (...) {
     // No matter what goes wrong, we need to mark the operators as failed. Otherwise, when the transaction context
     // gets destroyed, it will cause another exception that hides the one that caused the actual error. We are NOT
@@ -35,7 +37,7 @@ void AbstractReadWriteOperator::execute() {
   }
 
   if (_rw_state == ReadWriteOperatorState::Conflicted) {
-    return;
+    co_return;
   }
 
   _rw_state = ReadWriteOperatorState::Executed;
@@ -58,6 +60,15 @@ void AbstractReadWriteOperator::rollback_records() {
   _rw_state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::finalize_records() {
+  Assert(_rw_state == ReadWriteOperatorState::Committed || _rw_state == ReadWriteOperatorState::RolledBack,
+         "Operator needs to have state Committed or RolledBack in order to be finalized.");
+
+  _on_finalize_records();
+}
+
+void AbstractReadWriteOperator::_on_finalize_records() {}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::RolledBack;
 }
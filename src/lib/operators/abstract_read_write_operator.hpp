@@ -6,6 +6,7 @@
 
 #include "abstract_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
@@ -32,7 +33,7 @@ class AbstractReadWriteOperator : public AbstractOperator {
                                      const std::shared_ptr<const AbstractOperator>& left = nullptr,
                                      const std::shared_ptr<const AbstractOperator>& right = nullptr);
 
-  void execute() override;
+  TaskCoroutine execute_coroutine() override;
 
   /**
    * Commits the operator and triggers any potential work following commits.
@@ -46,6 +47,14 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Called by the TransactionContext after commit_records() or rollback_records() once the transaction does not delay
+   * the commits of other transactions anymore. With CommitMode::Synchronous, committed changes are visible at this
+   * point. Performs follow-up work that does not have to be part of the commit, e.g., indexing chunks that became
+   * immutable.
+   */
+  void finalize_records();
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -78,6 +87,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by finalize_records(). Does nothing by default.
+   */
+  virtual void _on_finalize_records();
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -38,6 +38,7 @@
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/shared_dictionary_encoder.hpp"
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "storage/value_segment.hpp"
@@ -622,6 +623,53 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
                 }
               }
             }
+          } else if (const auto shared_dictionary_segments =
+                         get_shared_dictionary_segments<ColumnDataType>(*input_table, groupby_column_id)) {
+            // The GROUP BY column is encoded with a dictionary that is shared by all segments (see
+            // SharedDictionaryEncoder). Thus, value IDs uniquely identify values across chunks and can be used as keys
+            // without materializing or hashing the values. As for the other keys, 0 is reserved for NULL. The value IDs
+            // are read from the pinned segments, as the encoder might remap the value IDs of the chunks' segments.
+            const auto dictionary_size = shared_dictionary_segments->dictionary_size;
+            for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+              if (!shared_dictionary_segments->segments[chunk_id]) {
+                continue;
+              }
+
+              auto& keys = keys_per_chunk[chunk_id];
+              iterate_shared_dictionary_value_ids(*shared_dictionary_segments, chunk_id, [&](const auto& position) {
+                const auto key = position.is_null() ? AggregateKeyEntry{0} : AggregateKeyEntry{position.value()} + 1;
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  keys[position.chunk_offset()] = key;
+                } else {
+                  keys[position.chunk_offset()][group_column_index] = key;
+                }
+              });
+            }
+
+            if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+              // As the keys are dense, they can be used as immediate indexes into the list of results (see the int32_t
+              // case above) unless the dictionary is much larger than the input.
+              if (static_cast<double>(dictionary_size) < static_cast<double>(input_table->row_count()) * 1.2) {
+                _expected_result_size = dictionary_size + 1;
+                _use_immediate_key_shortcut = true;
+
+                for (auto& keys : keys_per_chunk) {
+                  for (auto& key : keys) {
+                    key |= CACHE_MASK;
+                  }
+                }
+                return;
+              }
+            }
+
+            const auto expected_result_size =
+                std::min(dictionary_size + 1, static_cast<size_t>(input_table->row_count()));
+            auto previous_max = _expected_result_size.load();
+            while (previous_max < expected_result_size) {
+              if (_expected_result_size.compare_exchange_strong(previous_max, expected_result_size)) {
+                break;
+              }
+            }
           } else {
             /*
             Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
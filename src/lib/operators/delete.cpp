@@ -10,8 +10,10 @@
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -44,16 +46,20 @@ void commit_with_pos_list(const std::shared_ptr<const Table>& referenced_table,
     // only set_end_cid to our CommitID, but do not set_tid to 0 again.
     mvcc_data->set_end_cid(row_id.chunk_offset, commit_id);
 
+    // Update max_end_cid before invalid_row_count. GetTable relies on this order when it checks whether all rows of
+    // a chunk were deleted before its snapshot.
     if constexpr (!is_single_chunk) {
-      referenced_chunk->increase_invalid_row_count(ChunkOffset{1});
       set_atomic_max(mvcc_data->max_end_cid, commit_id);
+      referenced_chunk->increase_invalid_row_count(ChunkOffset{1});
     }
   }
 
   if constexpr (is_single_chunk) {
-    referenced_chunk->increase_invalid_row_count(ChunkOffset{static_cast<ChunkOffset::base_type>(pos_list.size())});
     set_atomic_max(mvcc_data->max_end_cid, commit_id);
+    referenced_chunk->increase_invalid_row_count(ChunkOffset{static_cast<ChunkOffset::base_type>(pos_list.size())});
   }
+
+  referenced_table->update_last_commit_id(commit_id);
 }
 
 }  // namespace
@@ -131,6 +137,27 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  if (chunk_count == 0) {
+    return nullptr;
+  }
+
+  // Compute the changes of the materialized views that read the table before the transaction commits.
+  const auto& first_referencing_segment =
+      static_cast<const ReferenceSegment&>(*_referencing_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  const auto referenced_table = first_referencing_segment.referenced_table();
+  _materialized_view_changes.emplace(referenced_table, MaterializedView::ChangeType::Delete, [this]() {
+    auto deleted_row_ids = std::make_shared<RowIDPosList>();
+    const auto referencing_chunk_count = _referencing_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < referencing_chunk_count; ++chunk_id) {
+      const auto& referencing_segment =
+          static_cast<const ReferenceSegment&>(*_referencing_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      for (const auto row_id : *referencing_segment.pos_list()) {
+        deleted_row_ids->emplace_back(row_id);
+      }
+    }
+    return deleted_row_ids;
+  });
+
   return nullptr;
 }
 
@@ -149,6 +176,11 @@ void Delete::_on_commit_records(const CommitID commit_id) {
       commit_with_pos_list<false>(referenced_table, pos_list, commit_id);
     }
   }
+
+  // Pass the deleted rows to the materialized views that read the table.
+  if (_materialized_view_changes) {
+    _materialized_view_changes->commit(commit_id);
+  }
 }
 
 void Delete::_on_rollback_records() {
@@ -178,6 +210,12 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_finalize_records() {
+  if (_materialized_view_changes) {
+    _materialized_view_changes->finalize();
+  }
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
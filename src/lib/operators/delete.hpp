@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "utils/assert.hpp"
 
@@ -30,9 +32,11 @@ class Delete : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
   void _on_rollback_records() override;
+  void _on_finalize_records() override;
 
  private:
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+  std::optional<MaterializedViewChanges> _materialized_view_changes;
 };
 }  // namespace hyrise
@@ -30,6 +30,36 @@
 #include "utils/assert.hpp"
 #include "utils/pruning_utils.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Uses the commit ID ranges tracked in the chunk's MvccData to determine whether none of its rows can be visible for
+// the given snapshot. This is the case if (i) all rows were invalidated at or before the snapshot or (ii) all rows were
+// inserted after the snapshot. In both cases, Validate would filter all rows of the chunk anyway.
+bool is_chunk_invisible(const Chunk& chunk, const CommitID snapshot_commit_id) {
+  const auto& mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data) {
+    return false;
+  }
+
+  // (i) Load invalid_row_count before max_end_cid. Delete and PointUpdate update max_end_cid before they increase the
+  // invalid_row_count, so max_end_cid covers all invalidated rows we counted. Rows invalidated by rolled-back Inserts
+  // have an end_cid of 0 and do not affect max_end_cid. As long as no row was deleted, max_end_cid is unset
+  // (MAX_COMMIT_ID) and the check fails.
+  const auto invalid_row_count = chunk.invalid_row_count();
+  if (invalid_row_count == chunk.size() && mvcc_data->max_end_cid.load() <= snapshot_commit_id) {
+    return true;
+  }
+
+  // (ii) Rows of pending Inserts have a begin_cid of MAX_COMMIT_ID until they are committed. They might have been
+  // inserted by our own transaction, which sees them. Once committed or rolled back, their begin_cid is part of
+  // min_begin_cid. Rows committed at or before the snapshot have updated min_begin_cid before the snapshot was taken.
+  return mvcc_data->pending_inserts() == 0 && mvcc_data->min_begin_cid.load() > snapshot_commit_id;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
@@ -98,6 +128,39 @@ const std::vector<ColumnID>& GetTable::pruned_column_ids() const {
   return _pruned_column_ids;
 }
 
+const std::vector<ChunkID>& GetTable::stored_chunk_ids() const {
+  return _stored_chunk_ids;
+}
+
+std::vector<ChunkID> GetTable::output_chunk_ids(const std::vector<ChunkID>& statically_pruned_chunk_ids) const {
+  DebugAssert(executed(), "GetTable must be executed before its output ChunkIDs are known.");
+  DebugAssert(std::is_sorted(statically_pruned_chunk_ids.cbegin(), statically_pruned_chunk_ids.cend()),
+              "Expected sorted ChunkIDs.");
+
+  auto output_chunk_ids = std::vector<ChunkID>{};
+  output_chunk_ids.reserve(statically_pruned_chunk_ids.size());
+
+  auto pruned_chunk_ids_iter = _pruned_chunk_ids.cbegin();
+  auto pruned_chunk_count = ChunkID::base_type{0};
+  auto stored_chunk_ids_iter = _stored_chunk_ids.cbegin();
+  for (const auto chunk_id : statically_pruned_chunk_ids) {
+    // Add the number of statically pruned chunks in front of the chunk to obtain its ChunkID in the stored table.
+    while (pruned_chunk_ids_iter != _pruned_chunk_ids.cend() &&
+           *pruned_chunk_ids_iter <= ChunkID{chunk_id + pruned_chunk_count}) {
+      ++pruned_chunk_ids_iter;
+      ++pruned_chunk_count;
+    }
+    const auto stored_chunk_id = ChunkID{chunk_id + pruned_chunk_count};
+
+    stored_chunk_ids_iter = std::lower_bound(stored_chunk_ids_iter, _stored_chunk_ids.cend(), stored_chunk_id);
+    if (stored_chunk_ids_iter != _stored_chunk_ids.cend() && *stored_chunk_ids_iter == stored_chunk_id) {
+      output_chunk_ids.emplace_back(std::distance(_stored_chunk_ids.cbegin(), stored_chunk_ids_iter));
+    }
+  }
+
+  return output_chunk_ids;
+}
+
 void GetTable::set_prunable_subquery_predicates(
     const std::vector<std::weak_ptr<const AbstractOperator>>& subquery_scans) const {
   DebugAssert(std::all_of(subquery_scans.cbegin(), subquery_scans.cend(),
@@ -143,7 +206,8 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   const auto chunk_count = stored_table->chunk_count();
 
   /**
-   * Build a sorted vector (`excluded_chunk_ids`) of physically/logically deleted and pruned ChunkIDs
+   * Build a sorted vector (`excluded_chunk_ids`) of physically/logically deleted and pruned ChunkIDs as well as of
+   * chunks without any rows visible for the transaction
    */
   DebugAssert(!transaction_context_is_set() || transaction_context()->phase() == TransactionPhase::Active,
               "Transaction is not active anymore.");
@@ -189,6 +253,13 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       continue;
     }
+
+    // Skip chunks whose rows are all invisible for the transaction's snapshot, e.g., chunks of which all rows were
+    // deleted but that were not yet logically deleted. Without a transaction context, all rows are considered visible.
+    if (transaction_context_is_set() && is_chunk_invisible(*chunk, transaction_context()->snapshot_commit_id())) {
+      excluded_chunk_ids.emplace_back(stored_chunk_id);
+      continue;
+    }
   }
 
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
@@ -228,6 +299,8 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
    */
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count - excluded_chunk_ids.size()};
   auto output_chunks_iter = output_chunks.begin();
+  _stored_chunk_ids.clear();
+  _stored_chunk_ids.reserve(output_chunks.size());
 
   auto excluded_chunk_ids_iter = excluded_chunk_ids.begin();
 
@@ -240,6 +313,7 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
 
     // The Chunk is to be included in the output Table, now we progress to excluding Columns
     const auto stored_chunk = stored_table->get_chunk(stored_chunk_id);
+    _stored_chunk_ids.emplace_back(stored_chunk_id);
 
     // Make a copy of the order-by information of the current chunk. This information is adapted when columns are
     // pruned and will be set on the output chunk.
@@ -36,6 +36,15 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // ChunkIDs of the stored table that the chunks of the output table correspond to, i.e., the output's ChunkIDs with
+  // the excluded chunks (pruned, deleted, empty, or invisible) skipped. Set when the operator is executed.
+  const std::vector<ChunkID>& stored_chunk_ids() const;
+
+  // Maps sorted ChunkIDs of the statically pruned table (i.e., as the LQPTranslator sees it) to the ChunkIDs of the
+  // output table. Chunks that were excluded during execution (e.g., dynamically pruned or invisible chunks) are not
+  // part of the output and are skipped. Only available after the operator was executed.
+  std::vector<ChunkID> output_chunk_ids(const std::vector<ChunkID>& statically_pruned_chunk_ids) const;
+
   // Predicates that contain uncorrelated subqueries cannot be used for chunk pruning in the optimization phase since we
   // do not know the predicate value yet. However, the ChunkPruningRule attaches the corresponding PredicateNodes to the
   // StoredTableNode of the table the predicates are performed on. We attach the translated predicates (i.e.,
@@ -64,6 +73,7 @@ class GetTable : public AbstractReadOnlyOperator {
 
   mutable std::vector<std::weak_ptr<const AbstractOperator>> _prunable_subquery_scans{};
   std::set<ChunkID> _dynamically_pruned_chunk_ids{};
+  std::vector<ChunkID> _stored_chunk_ids{};
 };
 
 }  // namespace hyrise
@@ -55,27 +55,22 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
   const auto& pruned_column_ids = input_get_table->pruned_column_ids();
   const auto indexed_column_id_adapted = column_id_before_pruning(_indexed_column_id, pruned_column_ids);
 
-  // If chunks have been pruned, calculate a mapping that maps the pruned ChunkIDs to the original ones.
-  const auto& pruned_chunk_ids = input_get_table->pruned_chunk_ids();
-  const auto data_table_chunk_count = _in_table->chunk_count() + pruned_chunk_ids.size();
-  auto chunk_count_to_scan = static_cast<int32_t>(_in_table->chunk_count());
-  auto chunk_id_mapping = pruned_chunk_id_mapping(data_table_chunk_count, pruned_chunk_ids);
-
-  // Remove all values from the mapping not present in the included ChunkIDs.
-  for (auto chunk_id = size_t{0}; chunk_id < data_table_chunk_count; ++chunk_id) {
-    const auto mapped_chunk_id = chunk_id_mapping[chunk_id];
-    if (mapped_chunk_id != INVALID_CHUNK_ID &&
-        !std::binary_search(included_chunk_ids->begin(), included_chunk_ids->end(), mapped_chunk_id)) {
-      chunk_id_mapping[chunk_id] = INVALID_CHUNK_ID;
-      --chunk_count_to_scan;
-    }
+  // The index returns RowIDs of the stored table. Map their ChunkIDs to the ChunkIDs of the input table. Besides the
+  // statically pruned chunks, GetTable excludes chunks during execution (e.g., dynamically pruned or invisible chunks),
+  // so the mapping is built from the chunks that GetTable actually forwarded. Chunks that are not included are mapped
+  // to INVALID_CHUNK_ID.
+  const auto& stored_chunk_ids = input_get_table->stored_chunk_ids();
+  const auto included_input_chunk_ids = input_get_table->output_chunk_ids(*included_chunk_ids);
+  auto chunk_id_mapping =
+      std::vector<ChunkID>(stored_chunk_ids.empty() ? 0 : stored_chunk_ids.back() + 1, INVALID_CHUNK_ID);
+  for (const auto input_chunk_id : included_input_chunk_ids) {
+    chunk_id_mapping[stored_chunk_ids[input_chunk_id]] = input_chunk_id;
   }
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
-  DebugAssert(chunk_count_to_scan >= 0, "Excluded more chunks for scanning than input table contains.");
-  if (chunk_count_to_scan == 0) {
-    // All chunks to scan have been pruned (can happen due to dynamic pruning).
+  if (included_input_chunk_ids.empty()) {
+    // All chunks to scan have been excluded (can happen due to dynamic pruning or if the chunks are not visible).
     return _out_table;
   }
 
@@ -91,8 +86,12 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
   auto& current_append_pos_list = pos_lists.back();
   const auto append_matches = [&](const auto& begin, const auto& end) {
     for (auto current_iter = begin; current_iter != end; ++current_iter) {
-      const auto mapped_chunk_id = chunk_id_mapping[(*current_iter).chunk_id];
+      const auto stored_chunk_id = (*current_iter).chunk_id;
+      if (stored_chunk_id >= chunk_id_mapping.size()) {
+        continue;
+      }
 
+      const auto mapped_chunk_id = chunk_id_mapping[stored_chunk_id];
       if (mapped_chunk_id != INVALID_CHUNK_ID) {
         // For equality predicates, the results are sorted by chunk. It is thus possible to emit single position lists
         // per chunk and guarantee that only single chunks are referenced (see references_single_chunk()). We decided
@@ -27,8 +27,9 @@ class IndexScan : public AbstractReadOnlyOperator {
   const std::string& name() const final;
 
   // Must not be empty because only the specified chunks will be scanned. See TableScan::excluded_chunk_ids for usage.
-  // Note: These ChunkIDs are referring to the ChunkIDs of the input operator (i.e., GetTable) at optimization-time.
-  // Due to dynamic pruning, the included ChunkIDs must potentially be updated for further pruned chunks.
+  // Note: These ChunkIDs are referring to the ChunkIDs of the input operator (i.e., GetTable) at optimization-time. As
+  // GetTable excludes further chunks during execution (e.g., due to dynamic pruning), they are mapped to the ChunkIDs
+  // of the input table when the operator is executed (see GetTable::output_chunk_ids()).
   std::shared_ptr<std::vector<ChunkID>> included_chunk_ids;
 
  protected:
@@ -4,8 +4,10 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "concurrency/transaction_context.hpp"
@@ -13,7 +15,10 @@
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
@@ -44,7 +49,8 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
     std::copy_n(source_value_segment->values().begin() + source_begin_offset, length,
                 target_values.begin() + target_begin_offset);
 
-    if (source_value_segment->is_nullable()) {
+    // Nullable segments without NULL values do not need to be checked.
+    if (source_value_segment->contains_null_values()) {
       const auto nulls_begin_iter = source_value_segment->null_values().begin() + source_begin_offset;
       const auto nulls_end_iter = nulls_begin_iter + length;
 
@@ -77,18 +83,73 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
   }
 }
 
+// Copies @param row_count rows, starting at @param source_row_id, from the source table into the target chunk. Advances
+// source_row_id past the copied rows.
+void copy_rows(const Table& source_table, RowID& source_row_id, const Chunk& target_chunk,
+               const std::vector<DataType>& column_data_types, ChunkOffset target_chunk_offset, ChunkOffset row_count) {
+  while (row_count > 0) {
+    const auto source_chunk = source_table.get_chunk(source_row_id.chunk_id);
+    const auto source_chunk_remaining_rows = ChunkOffset{source_chunk->size() - source_row_id.chunk_offset};
+    const auto num_rows_current_iteration = std::min<ChunkOffset>(source_chunk_remaining_rows, row_count);
+
+    // Copy from the source into the target Segments.
+    const auto column_count = target_chunk.column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& source_segment = source_chunk->get_segment(column_id);
+      const auto& target_segment = target_chunk.get_segment(column_id);
+
+      resolve_data_type(column_data_types[column_id], [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
+                                         target_chunk_offset, num_rows_current_iteration);
+      });
+    }
+
+    if (num_rows_current_iteration == source_chunk_remaining_rows) {
+      // Proceed to next source Chunk
+      ++source_row_id.chunk_id;
+      source_row_id.chunk_offset = 0;
+    } else {
+      source_row_id.chunk_offset += num_rows_current_iteration;
+    }
+
+    target_chunk_offset += num_rows_current_iteration;
+    row_count -= num_rows_current_iteration;
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
 
-Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
-    : AbstractReadWriteOperator(OperatorType::Insert, values_to_insert), _target_table_name(target_table_name) {}
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert,
+               const InsertChunkMode chunk_mode)
+    : AbstractReadWriteOperator(OperatorType::Insert, values_to_insert),
+      _target_table_name(target_table_name),
+      _chunk_mode(chunk_mode) {}
 
 const std::string& Insert::name() const {
   static const auto name = std::string{"Insert"};
   return name;
 }
 
+std::vector<ChunkID> Insert::target_chunk_ids() const {
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(_target_chunk_ranges.size());
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    chunk_ids.emplace_back(target_chunk_range.chunk_id);
+  }
+  return chunk_ids;
+}
+
+std::optional<ChunkID> Insert::full_chunk_id() const {
+  return _full_chunk_id;
+}
+
+void Insert::set_new_chunk_preparation(const NewChunkPreparation& new_chunk_preparation) {
+  _new_chunk_preparation = new_chunk_preparation;
+}
+
 std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionContext> context) {
   _target_table = Hyrise::get().storage_manager.get_table(_target_table_name);
 
@@ -100,31 +161,46 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type.");
   }
 
+  if (_chunk_mode == InsertChunkMode::NewChunk) {
+    _insert_into_new_chunk(context);
+  } else {
+    _insert_into_insert_chunk(context);
+  }
+
+  // Compute the changes of the materialized views that read the table before the transaction commits.
+  _materialized_view_changes.emplace(_target_table, MaterializedView::ChangeType::Insert, [this]() {
+    auto inserted_row_ids = std::make_shared<RowIDPosList>();
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        inserted_row_ids->emplace_back(target_chunk_range.chunk_id, chunk_offset);
+      }
+    }
+    return inserted_row_ids;
+  });
+
+  return nullptr;
+}
+
+void Insert::_insert_into_insert_chunk(const std::shared_ptr<TransactionContext>& context) {
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.  Do so while locking the
    *    table to prevent multiple threads modifying the table's size simultaneously. Since allocation is expected to be
    *    faster than writing to the memory, allocating under lock and then writing - in a second step - without lock will
-   *    minimize the time that the Table's `_append_mutex` is locked.
+   *    minimize the time that the Table's `_append_mutex` is locked. If the table has multiple insert chunks (see
+   *    Table::set_insert_chunk_count()), we only lock the insert chunk of the current thread's slot.
    */
   {
-    const auto append_lock = _target_table->acquire_append_mutex();
+    const auto insert_chunk_slot = _target_table->insert_chunk_slot();
+    const auto lock = _target_table->acquire_insert_chunk_mutex(insert_chunk_slot);
 
     auto remaining_rows = left_input_table()->row_count();
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
     while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
       const auto target_size = _target_table->target_chunk_size();
-
-      // If the last chunk of the target table is either immutable or full, append a new mutable chunk.
-      if (!target_chunk->is_mutable() || target_chunk->size() == target_size) {
-        _target_table->append_mutable_chunk();
-        ++target_chunk_id;
-        target_chunk = _target_table->get_chunk(target_chunk_id);
-      }
+      // Appends a new mutable chunk if the insert chunk is either immutable or full.
+      const auto target_chunk_id = _target_table->get_or_append_insert_chunk(insert_chunk_slot);
+      const auto target_chunk = _target_table->get_chunk(target_chunk_id);
 
       // Register that Insert is pending. See `chunk.hpp`. for details.
       const auto& mvcc_data = target_chunk->mvcc_data();
@@ -195,46 +271,89 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
    */
   auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
 
+  const auto column_data_types = _target_table->column_data_types();
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    const auto row_count = ChunkOffset{target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset};
+    copy_rows(*left_input_table(), source_row_id, *target_chunk, column_data_types,
+              target_chunk_range.begin_chunk_offset, row_count);
+  }
+}
+
+void Insert::_insert_into_new_chunk(const std::shared_ptr<TransactionContext>& context) {
+  const auto row_count = left_input_table()->row_count();
+  Assert(row_count <= _target_table->target_chunk_size(), "Rows do not fit into a single chunk.");
+  if (row_count == 0) {
+    return;
+  }
 
-    auto target_chunk_offset = target_chunk_range.begin_chunk_offset;
-    auto target_chunk_range_remaining_rows =
-        ChunkOffset{target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset};
+  /**
+   * 1. Write the rows to a new chunk that is not part of the target table yet. As no other thread can access the chunk,
+   *    neither locks nor memory fences are required, and the chunk can be prepared (e.g., encoded) before it is added.
+   */
+  const auto target_chunk = _target_table->create_mutable_chunk();
+  const auto& mvcc_data = target_chunk->mvcc_data();
+  DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data.");
+  mvcc_data->register_insert();
+
+  const auto chunk_size = static_cast<ChunkOffset>(row_count);
+  const auto transaction_id = context->transaction_id();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+  }
 
-    while (target_chunk_range_remaining_rows > 0) {
-      const auto source_chunk = left_input_table()->get_chunk(source_row_id.chunk_id);
-      const auto source_chunk_remaining_rows = ChunkOffset{source_chunk->size() - source_row_id.chunk_offset};
-      const auto num_rows_current_iteration =
-          std::min<ChunkOffset>(source_chunk_remaining_rows, target_chunk_range_remaining_rows);
+  const auto column_count = target_chunk->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto value_segment =
+          std::static_pointer_cast<ValueSegment<ColumnDataType>>(target_chunk->get_segment(column_id));
+      value_segment->resize(chunk_size);
+    });
+  }
 
-      // Copy from the source into the target Segments.
-      const auto column_count = target_chunk->column_count();
-      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-        const auto& source_segment = source_chunk->get_segment(column_id);
-        const auto& target_segment = target_chunk->get_segment(column_id);
+  auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+  copy_rows(*left_input_table(), source_row_id, *target_chunk, _target_table->column_data_types(), ChunkOffset{0},
+            chunk_size);
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-          copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
-                                           target_chunk_offset, num_rows_current_iteration);
-        });
-      }
+  // Prevent other Inserts from writing to the new chunk. It becomes immutable when we commit or roll back.
+  target_chunk->mark_as_full();
 
-      if (num_rows_current_iteration == source_chunk_remaining_rows) {
-        // Proceed to next source Chunk
-        ++source_row_id.chunk_id;
-        source_row_id.chunk_offset = 0;
-      } else {
-        source_row_id.chunk_offset += num_rows_current_iteration;
-      }
+  if (_new_chunk_preparation) {
+    _new_chunk_preparation(target_chunk);
+  }
 
-      target_chunk_offset += num_rows_current_iteration;
-      target_chunk_range_remaining_rows -= num_rows_current_iteration;
+  /**
+   * 2. Append the chunk to the target table. The current last chunk is marked as full, as Inserts do not write to it
+   *    anymore once it is not the last chunk. If no Insert is pending, it becomes immutable right away. Otherwise, the
+   *    last pending Insert will mark it. Insert chunks of other slots are left alone, as Inserts might be allocating
+   *    rows in them without holding the append mutex.
+   */
+  auto sealed_chunk_id = std::optional<ChunkID>{};
+  {
+    const auto append_lock = _target_table->acquire_append_mutex();
+    const auto chunk_count = _target_table->chunk_count();
+    if (chunk_count > 0) {
+      const auto last_chunk_id = ChunkID{chunk_count - 1};
+      const auto last_chunk = _target_table->get_chunk(last_chunk_id);
+      if (last_chunk && last_chunk->is_mutable() && last_chunk->size() > 0 && !last_chunk->is_marked_as_full() &&
+          !_target_table->is_insert_chunk(last_chunk_id)) {
+        last_chunk->mark_as_full();
+        _full_chunk_id = last_chunk_id;
+        if (last_chunk->try_set_immutable()) {
+          sealed_chunk_id = last_chunk_id;
+        }
+      }
     }
+
+    _target_table->append_chunk(target_chunk);
+    _target_chunk_ranges.emplace_back(ChunkRange{ChunkID{chunk_count}, ChunkOffset{0}, chunk_size});
   }
 
-  return nullptr;
+  // Index the chunk we marked as immutable without holding the append mutex.
+  if (sealed_chunk_id) {
+    _target_table->add_chunk_to_table_indexes(*sealed_chunk_id);
+  }
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
@@ -256,10 +375,20 @@ void Insert::_on_commit_records(const CommitID cid) {
     // Deregister the pending Insert and try to mark the chunk as immutable. We might be the last committing Insert
     // operator inserting into a chunk that reached its target size. In this case, the Insert operator that added a new
     // chunk to the table allowed the chunk to be marked, i.e., it set the `reached_target_size` flag. Then,
-    // `try_set_immutable()` actually marks the chunk. Otherwise, this is a no-op.
+    // `try_set_immutable()` actually marks the chunk and we add it to the table's indexes once the transaction left
+    // the commit window (see _on_finalize_records()). Otherwise, this is a no-op.
     mvcc_data->deregister_insert();
-    target_chunk->try_set_immutable();
+    if (target_chunk->try_set_immutable()) {
+      _chunk_ids_to_index.emplace_back(target_chunk_range.chunk_id);
+    }
+  }
+
+  if (!_target_chunk_ranges.empty()) {
+    _target_table->update_last_commit_id(cid);
   }
+
+  // Pass the inserted rows to the materialized views that read the table.
+  _materialized_view_changes->commit(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -304,9 +433,23 @@ void Insert::_on_rollback_records() {
     // Deregister the pending Insert and try to mark the chunk as immutable. We might be the last rolling back Insert
     // operator inserting into a chunk that reached its target size. In this case, the Insert operator that added a new
     // chunk to the table allowed the chunk to be marked, i.e., it set the `reached_target_size` flag. Then,
-    // `try_set_immutable()` actually marks the chunk. Otherwise, this is a no-op.
+    // `try_set_immutable()` actually marks the chunk and we add it to the table's indexes once the transaction left
+    // the commit window (see _on_finalize_records()). Otherwise, this is a no-op.
     mvcc_data->deregister_insert();
-    target_chunk->try_set_immutable();
+    if (target_chunk->try_set_immutable()) {
+      _chunk_ids_to_index.emplace_back(target_chunk_range.chunk_id);
+    }
+  }
+}
+
+void Insert::_on_finalize_records() {
+  // Until then, the LQPTranslator does not assign the chunks to IndexScans, so TableScans handle them.
+  for (const auto chunk_id : _chunk_ids_to_index) {
+    _target_table->add_chunk_to_table_indexes(chunk_id);
+  }
+
+  if (_materialized_view_changes) {
+    _materialized_view_changes->finalize();
   }
 }
 
@@ -314,7 +457,7 @@ std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<Insert>(_target_table_name, copied_left_input);
+  return std::make_shared<Insert>(_target_table_name, copied_left_input, _chunk_mode);
 }
 
 void Insert::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -1,18 +1,34 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
 
+class Chunk;
 class TransactionContext;
 
+/**
+ * By default, Insert operators append rows to the insert chunk of the target table, which is shared by all concurrent
+ * Inserts (or by all Inserts of the same slot, see Table::set_insert_chunk_count()). With InsertChunkMode::NewChunk,
+ * the rows are written to a new chunk that no other Insert writes to. The chunk is filled before it is appended to the
+ * table, so that it can be prepared (e.g., encoded and indexed) while no other thread can access it (see
+ * Insert::set_new_chunk_preparation()). To this end, the current last chunk is marked as full (if it is not empty), and
+ * the new chunk is marked as full as well. Thus, both chunks become immutable once their pending Inserts commit or roll
+ * back. This is used to rewrite rows into dedicated chunks, e.g., when compacting chunks. All rows have to fit into a
+ * single chunk.
+ */
+enum class InsertChunkMode { Append, NewChunk };
+
 /**
  * Operator that inserts a number of rows from one table into another. Expects the table name of the table to insert
  * into as a string and the values to insert in a separate table using the same column layout.
@@ -21,11 +37,24 @@ class TransactionContext;
  */
 class Insert : public AbstractReadWriteOperator {
  public:
+  using NewChunkPreparation = std::function<void(const std::shared_ptr<Chunk>&)>;
+
   explicit Insert(const std::string& target_table_name,
-                  const std::shared_ptr<const AbstractOperator>& values_to_insert);
+                  const std::shared_ptr<const AbstractOperator>& values_to_insert,
+                  const InsertChunkMode chunk_mode = InsertChunkMode::Append);
 
   const std::string& name() const override;
 
+  // IDs of the chunks the rows were written to. Only available after the operator was executed.
+  std::vector<ChunkID> target_chunk_ids() const;
+
+  // ID of the previous last chunk if the Insert marked it as full (see InsertChunkMode::NewChunk).
+  std::optional<ChunkID> full_chunk_id() const;
+
+  // Called with the new chunk after the rows were written to it and before it is appended to the target table (see
+  // InsertChunkMode::NewChunk). The chunk is still mutable, and its rows are not committed yet.
+  void set_new_chunk_preparation(const NewChunkPreparation& new_chunk_preparation);
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -35,9 +64,17 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_finalize_records() override;
 
  private:
+  // Allocates the rows in the insert chunk(s) of the target table and writes them.
+  void _insert_into_insert_chunk(const std::shared_ptr<TransactionContext>& context);
+
+  // Writes the rows to a new chunk and appends it to the target table (see InsertChunkMode::NewChunk).
+  void _insert_into_new_chunk(const std::shared_ptr<TransactionContext>& context);
+
   const std::string _target_table_name;
+  const InsertChunkMode _chunk_mode;
 
   // Ranges of rows to which the inserted values are written.
   struct ChunkRange {
@@ -48,6 +85,16 @@ class Insert : public AbstractReadWriteOperator {
 
   std::vector<ChunkRange> _target_chunk_ranges;
 
+  std::optional<ChunkID> _full_chunk_id;
+
+  NewChunkPreparation _new_chunk_preparation;
+
+  // Chunks that became immutable when the Insert committed or rolled back. They are added to the table indexes in
+  // _on_finalize_records() so that indexing does not delay the commits of other transactions.
+  std::vector<ChunkID> _chunk_ids_to_index;
+
+  std::optional<MaterializedViewChanges> _materialized_view_changes;
+
   std::shared_ptr<Table> _target_table;
 };
 
@@ -27,6 +27,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/shared_dictionary_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -207,10 +208,34 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
                    max_partition_size,
                "Partition count too small (potential overflows in hash map offsetting).");
 
-        _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
-            *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
-            _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
-            adjusted_secondary_predicates);
+        // If both join columns are encoded with the same shared dictionary, equal values have equal value IDs. In this
+        // case, we join the value IDs, which avoids materializing and hashing the (potentially long) values. The value
+        // IDs are read from the pinned segments, as a concurrent SharedDictionaryEncoder might remap the value IDs of
+        // the chunks' segments. If the encoder changed the dictionary between pinning the build and the probe column,
+        // the dictionaries differ and we join the values.
+        auto build_shared_dictionary_segments = std::shared_ptr<const SharedDictionarySegments>{};
+        auto probe_shared_dictionary_segments = std::shared_ptr<const SharedDictionarySegments>{};
+        if constexpr (std::is_same_v<BuildColumnDataType, ProbeColumnDataType>) {
+          build_shared_dictionary_segments =
+              get_shared_dictionary_segments<BuildColumnDataType>(*build_input_table, build_column_id);
+          if (build_shared_dictionary_segments) {
+            probe_shared_dictionary_segments =
+                get_shared_dictionary_segments<ProbeColumnDataType>(*probe_input_table, probe_column_id);
+          }
+        }
+
+        if (build_shared_dictionary_segments && probe_shared_dictionary_segments &&
+            build_shared_dictionary_segments->dictionary == probe_shared_dictionary_segments->dictionary) {
+          _impl = std::make_unique<JoinHashImpl<SharedDictionaryValueID, SharedDictionaryValueID>>(
+              *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
+              _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
+              adjusted_secondary_predicates, build_shared_dictionary_segments, probe_shared_dictionary_segments);
+        } else {
+          _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
+              *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
+              _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
+              adjusted_secondary_predicates);
+        }
       } else {
         Fail("Cannot join String with non-String column");
       }
@@ -235,7 +260,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                const OutputColumnOrder output_column_order, const size_t radix_bits,
-               JoinHash::PerformanceData& performance_data, std::vector<OperatorJoinPredicate>& secondary_predicates)
+               JoinHash::PerformanceData& performance_data, std::vector<OperatorJoinPredicate>& secondary_predicates,
+               const std::shared_ptr<const SharedDictionarySegments>& build_shared_dictionary_segments = nullptr,
+               const std::shared_ptr<const SharedDictionarySegments>& probe_shared_dictionary_segments = nullptr)
       : _join_hash(join_hash),
         _secondary_predicates(secondary_predicates),
         _performance_data(performance_data),
@@ -245,7 +272,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
         _output_column_order(output_column_order),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _build_shared_dictionary_segments(build_shared_dictionary_segments),
+        _probe_shared_dictionary_segments(probe_shared_dictionary_segments) {}
 
  protected:
   // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members): const members and references are problematic with
@@ -264,6 +293,10 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   std::shared_ptr<Table> _output_table;
   size_t _radix_bits;
 
+  // Set if both join columns share a dictionary and the value IDs are joined (see SharedDictionaryValueID).
+  std::shared_ptr<const SharedDictionarySegments> _build_shared_dictionary_segments;
+  std::shared_ptr<const SharedDictionarySegments> _probe_shared_dictionary_segments;
+
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
 
@@ -337,11 +370,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       if (keep_nulls_build_column) {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
             _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, _build_shared_dictionary_segments.get());
       } else {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
             _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, _build_shared_dictionary_segments.get());
       }
     };
 
@@ -353,11 +386,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       if (keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, _probe_shared_dictionary_segments.get());
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-            input_bloom_filter);
+            input_bloom_filter, _probe_shared_dictionary_segments.get());
       }
     };
 
@@ -23,8 +23,10 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/shared_dictionary_encoder.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 
@@ -43,6 +45,10 @@ enum class JoinHashBuildMode { AllPositions, ExistenceOnly };
 
 using Hash = size_t;
 
+// If both join columns are encoded with the same shared dictionary (see SharedDictionaryEncoder), JoinHash joins the
+// value IDs instead of the values. As no column has this type, materialize_input() uses it to identify this case.
+using SharedDictionaryValueID = ValueID::base_type;
+
 /*
 This is how elements of the input relations are saved after materialization.
 The original value is used to detect hash collisions.
@@ -249,6 +255,12 @@ class PosHashTable {
 static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
 static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
 
+// Costs of inserting a row into a hash table and of probing a row relative to scanning it. The jobs that perform the
+// materialization, radix partitioning, building, and probing are only spawned if the number of elements to process is
+// worth a task (see MorselSplitter). Otherwise, the job is executed directly.
+static constexpr auto BUILD_ROW_COST = 2.0f;
+static constexpr auto PROBE_ROW_COST = 2.0f;
+
 // Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
 // needed for merging partial Bloom filters created by different threads. Note that the dynamic_bitset(n, value)
 // constructor does not do what you would expect it to, so try to avoid it.
@@ -268,13 +280,24 @@ static const auto ALL_TRUE_BLOOM_FILTER = ~BloomFilter(BLOOM_FILTER_SIZE);
 //                             encountered in the input column
 // @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
 //                             Bloom filter is false
+// @param shared_dictionary_segments  Required if T is SharedDictionaryValueID: the pinned segments of the column, from
+//                             which the value IDs are read
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
                                     BloomFilter& output_bloom_filter,
-                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER) {
+                                    const BloomFilter& input_bloom_filter = ALL_TRUE_BLOOM_FILTER,
+                                    const SharedDictionarySegments* shared_dictionary_segments = nullptr) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
+  if constexpr (std::is_same_v<T, SharedDictionaryValueID>) {
+    // Chunks that were appended after the segments were pinned are not covered by the shared dictionary. As for the
+    // rows that are concurrently inserted into the last chunk (see below), their rows are not visible to the current
+    // transaction, so we ignore them.
+    Assert(shared_dictionary_segments, "Joining value IDs requires the pinned shared dictionary segments.");
+    chunk_count = std::min(chunk_count,
+                           ChunkID{static_cast<ChunkID::base_type>(shared_dictionary_segments->segments.size())});
+  }
 
   const std::hash<HashedType> hash_function;
   // List of all elements that will be partitioned
@@ -299,6 +322,7 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(chunk_count);
+  const auto morsel_splitter = MorselSplitter{};
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk_in = in_table->get_chunk(chunk_id);
     if (!chunk_in) {
@@ -335,76 +359,90 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
       // prepare histogram
       auto histogram = std::vector<size_t>(num_radix_partitions);
 
-      auto reference_chunk_offset = ChunkOffset{0};
-
-      const auto segment = chunk_in->get_segment(column_id);
-      segment_with_iterators<T>(*segment, [&](auto iter, auto end) {
-        using IterableType = typename decltype(iter)::IterableType;
-
-        if (dynamic_cast<ValueSegment<T>*>(&*segment)) {
-          // The last chunk might have changed its size since we allocated elements. This would be due to concurrent
-          // inserts into that chunk. In any case, those inserts will not be visible to our current transaction, so we
-          // can ignore them.
-          const auto inserted_rows = (end - iter) - num_rows;
-          end -= inserted_rows;
-        } else {
-          Assert(end - iter == num_rows, "Non-ValueSegment changed size while being accessed");
-        }
-
-        while (iter != end) {
-          const auto& value = *iter;
-
-          if (!value.is_null() || keep_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double. See #1550 for details.
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+      // Materializes a single position. `output_chunk_offset` is the offset that is used for the materialized RowID.
+      const auto materialize_position = [&](const auto& value, const ChunkOffset output_chunk_offset) {
+        if (!value.is_null() || keep_null_values) {
+          // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+          // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+          // double. See #1550 for details.
+          const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+
+          auto skip = false;
+          if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
+            // Value in not present in input bloom filter and can be skipped
+            skip = true;
+          }
 
-            auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
-            }
+          if (!skip) {
+            // Fill the corresponding slot in the bloom filter
+            used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
 
-            if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
-
-              /*
-              For ReferenceSegments we do not use the RowIDs from the referenced tables.
-              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-              values from different inputs (important for Multi Joins).
-              */
-              if constexpr (is_reference_segment_iterable_v<IterableType>) {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-              } else {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-              }
-              ++elements_iter;
+            *elements_iter = PartitionedElement<T>{RowID{chunk_id, output_chunk_offset}, static_cast<T>(value.value())};
+            ++elements_iter;
 
-              // In case we care about NULL values, store the NULL flag
-              if constexpr (keep_null_values) {
-                if (value.is_null()) {
-                  *null_values_iter = true;
-                }
-                ++null_values_iter;
+            // In case we care about NULL values, store the NULL flag
+            if constexpr (keep_null_values) {
+              if (value.is_null()) {
+                *null_values_iter = true;
               }
+              ++null_values_iter;
+            }
 
-              if (radix_bits > 0) {
-                const Hash radix = hashed_value & radix_mask;
-                ++histogram[radix];
-              }
+            if (radix_bits > 0) {
+              const Hash radix = hashed_value & radix_mask;
+              ++histogram[radix];
             }
           }
-
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (is_reference_segment_iterable_v<IterableType>) {
-            ++reference_chunk_offset;
+        }
+      };
+
+      if constexpr (std::is_same_v<T, SharedDictionaryValueID>) {
+        // Both join columns share a dictionary (see SharedDictionaryEncoder). As value IDs are unique across all
+        // segments, they are materialized instead of the values. For ReferenceSegments, the positions' chunk offsets
+        // are the offsets within the ReferenceSegment (see below). The value IDs are read from the pinned segments,
+        // which all use the dictionary that was compared with the other join column.
+        Assert(shared_dictionary_segments, "Joining value IDs requires the pinned shared dictionary segments.");
+        Assert(shared_dictionary_segments->segments[chunk_id]->size() == num_rows,
+               "Segment changed size while being accessed");
+        iterate_shared_dictionary_value_ids(*shared_dictionary_segments, chunk_id, [&](const auto& value) {
+          materialize_position(value, value.chunk_offset());
+        });
+      } else {
+        const auto segment = chunk_in->get_segment(column_id);
+        auto reference_chunk_offset = ChunkOffset{0};
+
+        segment_with_iterators<T>(*segment, [&](auto iter, auto end) {
+          using IterableType = typename decltype(iter)::IterableType;
+
+          if (dynamic_cast<ValueSegment<T>*>(&*segment)) {
+            // The last chunk might have changed its size since we allocated elements. This would be due to concurrent
+            // inserts into that chunk. In any case, those inserts will not be visible to our current transaction, so
+            // we can ignore them.
+            const auto inserted_rows = (end - iter) - num_rows;
+            end -= inserted_rows;
+          } else {
+            Assert(end - iter == num_rows, "Non-ValueSegment changed size while being accessed");
           }
 
-          ++iter;
-        }
-      });
+          while (iter != end) {
+            const auto& value = *iter;
+
+            /*
+            For ReferenceSegments we do not use the RowIDs from the referenced tables.
+            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+            values from different inputs (important for Multi Joins).
+            */
+            if constexpr (is_reference_segment_iterable_v<IterableType>) {
+              materialize_position(value, reference_chunk_offset);
+              ++reference_chunk_offset;
+            } else {
+              materialize_position(value, value.chunk_offset());
+            }
+
+            ++iter;
+          }
+        });
+      }
 
       // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
       // vector to the number of values actually written.
@@ -419,10 +457,12 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
         output_bloom_filter |= local_output_bloom_filter;
       }
     };
-    if (JoinHash::JOB_SPAWN_THRESHOLD > num_rows) {
+    if (!morsel_splitter.should_spawn_job(num_rows)) {
       materialize();
     } else {
-      jobs.emplace_back(std::make_shared<JobTask>(materialize));
+      auto job_task = std::make_shared<JobTask>(materialize);
+      job_task->set_preferred_node_id(chunk_in->node_id());
+      jobs.emplace_back(job_task);
     }
   }
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
@@ -464,6 +504,9 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.size());
 
+  // Inserting into a hash table is more expensive than scanning a row.
+  const auto morsel_splitter = MorselSplitter{BUILD_ROW_COST};
+
   for (size_t partition_idx = 0; partition_idx < radix_container.size(); ++partition_idx) {
     // Skip empty partitions, so that we don't have too many empty jobs and hash tables
     if (radix_container[partition_idx].elements.empty()) {
@@ -498,7 +541,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       }
     };
 
-    if (radix_bits == 0 || JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+    if (radix_bits == 0 || !morsel_splitter.should_spawn_job(elements_count)) {
       // Execute the insertion in the hash table sequentially when we do not radix partition (i.e., 0 radix bits) or
       // the number of elements is too small. Without radix partitioning, only a single hash table will be written.
       // Parallelizing this would require a concurrent hash table, which is likely more expensive.
@@ -571,6 +614,8 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(input_partition_count);
 
+  const auto morsel_splitter = MorselSplitter{};
+
   for (auto input_partition_idx = ChunkID{0}; input_partition_idx < input_partition_count; ++input_partition_idx) {
     const auto& input_partition = radix_container[input_partition_idx];
     const auto& elements = input_partition.elements;
@@ -604,7 +649,7 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
         ++output_idx;
       }
     };
-    if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+    if (!morsel_splitter.should_spawn_job(elements_count)) {
       perform_partition();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(perform_partition));
@@ -652,6 +697,9 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
     and the job that probes that partition should also be on that NUMA node.
   */
 
+  // Probing a hash table is more expensive than scanning a row.
+  const auto morsel_splitter = MorselSplitter{PROBE_ROW_COST};
+
   for (size_t partition_idx = 0; partition_idx < probe_radix_container.size(); ++partition_idx) {
     // Skip empty partitions to avoid empty output chunks
     if (probe_radix_container[partition_idx].elements.empty()) {
@@ -785,7 +833,7 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
       pos_lists_probe_side[partition_idx] = std::move(pos_list_probe_side_local);
     };
 
-    if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+    if (!morsel_splitter.should_spawn_job(elements_count)) {
       probe_partition();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(probe_partition));
@@ -805,6 +853,8 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
   const auto probe_radix_container_count = probe_radix_container.size();
   jobs.reserve(probe_radix_container_count);
 
+  const auto morsel_splitter = MorselSplitter{PROBE_ROW_COST};
+
   for (auto partition_idx = size_t{0}; partition_idx < probe_radix_container_count; ++partition_idx) {
     // Skip empty partitions to avoid empty output chunks
     if (probe_radix_container[partition_idx].elements.empty()) {
@@ -905,7 +955,7 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& probe_radix_containe
       pos_lists[partition_idx] = std::move(pos_list_local);
     };
 
-    if (JoinHash::JOB_SPAWN_THRESHOLD > elements_count) {
+    if (!morsel_splitter.should_spawn_job(elements_count)) {
       probe_partition();
     } else {
       jobs.emplace_back(std::make_shared<JobTask>(probe_partition));
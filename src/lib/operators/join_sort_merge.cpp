@@ -8,6 +8,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -28,10 +29,12 @@
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/prefixed_string_view.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -88,7 +91,10 @@ std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
   // Create implementation to compute the join result
   resolve_data_type(left_column_type, [&](const auto type) {
     using ColumnDataType = typename decltype(type)::type;
-    _impl = std::make_unique<JoinSortMergeImpl<ColumnDataType>>(
+    // Strings are joined as PrefixedStringViews (see ColumnMaterializer).
+    using JoinDataType =
+        std::conditional_t<std::is_same_v<ColumnDataType, pmr_string>, PrefixedStringView, ColumnDataType>;
+    _impl = std::make_unique<JoinSortMergeImpl<JoinDataType>>(
         *this, left_input_table_ptr, right_input_table_ptr, _primary_predicate.column_ids.first,
         _primary_predicate.column_ids.second, _primary_predicate.predicate_condition, _mode, _secondary_predicates,
         dynamic_cast<OperatorPerformanceData<JoinSortMerge::OperatorSteps>&>(*performance_data));
@@ -139,6 +145,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
   MaterializedSegmentList<T> _sorted_left_table;
   MaterializedSegmentList<T> _sorted_right_table;
 
+  // Own the characters of the materialized strings (see ColumnMaterializer).
+  std::vector<PrefixedStringHeap> _string_heaps;
+
   // Contains the null value row ids if a join column is an outer join column.
   RowIDPosList _null_rows_left;
   RowIDPosList _null_rows_right;
@@ -821,6 +830,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
     _left_row_ids_emitted_per_chunk.resize(_cluster_count);
     _right_row_ids_emitted_per_chunk.resize(_cluster_count);
+    const auto morsel_splitter = MorselSplitter{};
 
     // Parallel join for each cluster
     for (auto cluster_id = size_t{0}; cluster_id < _cluster_count; ++cluster_id) {
@@ -851,7 +861,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
         this->_join_cluster(cluster_id, multi_predicate_join_evaluator);
       };
 
-      if (merge_row_count > JOB_SPAWN_THRESHOLD) {
+      if (morsel_splitter.should_spawn_job(merge_row_count)) {
         jobs.push_back(std::make_shared<JobTask>(join_cluster_task));
       } else {
         join_cluster_task();
@@ -893,6 +903,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractReadOnlyOperatorImpl {
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    _string_heaps = std::move(sort_output.string_heaps);
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
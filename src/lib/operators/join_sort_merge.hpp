@@ -43,11 +43,10 @@ class JoinSortMerge : public AbstractJoinOperator {
     OutputWriting
   };
 
-  // Tasks are added to the scheduler in case the number of rows to process is above JOB_SPAWN_THRESHOLD. If not,
-  // the task is executed directly. This threshold has been determined by executing a multi-threaded and shuffled TPC-H
-  // run (28 cores and 50 clients). With larger system changes (e.g., scheduling), the threshold needs to be
-  // re-evaluated again.
-  static constexpr auto JOB_SPAWN_THRESHOLD = 500;
+  // Tasks are added to the scheduler in case the number of rows to process is worth a task (see MorselSplitter). If
+  // not, the task is executed directly. Sorting a cluster is more expensive than the other steps, which process each
+  // row once.
+  static constexpr auto SORT_ROW_COST = 4.0f;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -12,11 +13,13 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
+#include "utils/prefixed_string_view.hpp"
 
 namespace hyrise {
 
@@ -49,16 +52,21 @@ struct Subsample {
   std::vector<T> samples;
 };
 
-// Materializes a column and sorts it if requested.
+// Materializes a column and sorts it if requested. String columns are materialized as PrefixedStringViews (i.e., T is
+// PrefixedStringView), so that sorting and merging mostly compare the inlined prefixes. The characters of long strings
+// are copied into one PrefixedStringHeap per segment, as the segment iterators may return temporary strings.
 template <typename T>
 class ColumnMaterializer {
  public:
+  using SegmentDataType = std::conditional_t<std::is_same_v<T, PrefixedStringView>, pmr_string, T>;
+
   explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
 
  public:
-  // For sufficiently large chunks (number of rows > JOB_SPAWN_THRESHOLD), the materialization is parallelized. Returns
-  // the materialized segments and a list of null row ids if _materialize_null is true.
-  std::tuple<MaterializedSegmentList<T>, RowIDPosList, std::vector<T>> materialize(
+  // For sufficiently large chunks (see MorselSplitter), the materialization is parallelized. Returns the materialized
+  // segments, a list of null row ids if _materialize_null is true, the samples, and the string heaps that own the
+  // characters of the materialized PrefixedStringViews (empty for other types).
+  std::tuple<MaterializedSegmentList<T>, RowIDPosList, std::vector<T>, std::vector<PrefixedStringHeap>> materialize(
       const std::shared_ptr<const Table>& input, const ColumnID column_id) {
     constexpr auto SAMPLES_PER_CHUNK = ChunkOffset{10};
     const auto chunk_count = input->chunk_count();
@@ -66,10 +74,16 @@ class ColumnMaterializer {
     auto output = MaterializedSegmentList<T>(chunk_count);
 
     auto null_rows_per_chunk = std::vector<RowIDPosList>(chunk_count);
+    auto string_heaps = std::vector<PrefixedStringHeap>{};
+    if constexpr (std::is_same_v<T, PrefixedStringView>) {
+      string_heaps.resize(chunk_count);
+    }
     auto subsamples = std::vector<Subsample<T>>{};
     subsamples.reserve(chunk_count);
 
     auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    // Materialized segments are sorted if requested.
+    const auto morsel_splitter = MorselSplitter{_sort ? JoinSortMerge::SORT_ROW_COST : 1.0f};
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
       const auto& chunk = input->get_chunk(chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -80,11 +94,14 @@ class ColumnMaterializer {
 
       auto materialize_job = [&, chunk_id] {
         const auto& segment = input->get_chunk(chunk_id)->get_segment(column_id);
-        output[chunk_id] = _materialize_segment(segment, chunk_id, null_rows_per_chunk[chunk_id], subsamples[chunk_id]);
+        output[chunk_id] = _materialize_segment(segment, chunk_id, null_rows_per_chunk[chunk_id], subsamples[chunk_id],
+                                                string_heaps);
       };
 
-      if (chunk_size > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
-        jobs.push_back(std::make_shared<JobTask>(materialize_job));
+      if (morsel_splitter.should_spawn_job(chunk_size)) {
+        auto job_task = std::make_shared<JobTask>(materialize_job);
+        job_task->set_preferred_node_id(chunk->node_id());
+        jobs.push_back(job_task);
       } else {
         materialize_job();
       }
@@ -117,7 +134,7 @@ class ColumnMaterializer {
       gathered_samples.shrink_to_fit();
     }
 
-    return {std::move(output), std::move(null_rows), std::move(gathered_samples)};
+    return {std::move(output), std::move(null_rows), std::move(gathered_samples), std::move(string_heaps)};
   }
 
  private:
@@ -143,15 +160,18 @@ class ColumnMaterializer {
   }
 
   MaterializedSegment<T> _materialize_segment(const std::shared_ptr<AbstractSegment>& segment, const ChunkID chunk_id,
-                                              RowIDPosList& null_rows_output, Subsample<T>& subsample) {
+                                              RowIDPosList& null_rows_output, Subsample<T>& subsample,
+                                              std::vector<PrefixedStringHeap>& string_heaps) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment->size());
 
-    segment_iterate<T>(*segment, [&](const auto& position) {
+    segment_iterate<SegmentDataType>(*segment, [&](const auto& position) {
       if (position.is_null()) {
         if (_materialize_null) {
           null_rows_output.emplace_back(chunk_id, position.chunk_offset());
         }
+      } else if constexpr (std::is_same_v<T, PrefixedStringView>) {
+        output.emplace_back(chunk_id, position.chunk_offset(), string_heaps[chunk_id].add(position.value()));
       } else {
         output.emplace_back(chunk_id, position.chunk_offset(), position.value());
       }
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -13,6 +14,7 @@
 #include "column_materializer.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -24,6 +26,9 @@ struct RadixClusterOutput {
   MaterializedSegmentList<T> clusters_right;
   RowIDPosList null_rows_left;
   RowIDPosList null_rows_right;
+
+  // Own the characters of the clustered values if they are PrefixedStringViews (see ColumnMaterializer).
+  std::vector<PrefixedStringHeap> string_heaps;
 };
 
 // Performs radix clustering for the sort merge join. The radix clustering algorithm clusters on the basis of the least
@@ -166,6 +171,7 @@ class RadixClusterSort {
 
     // Count for every chunk the number of entries for each cluster in parallel
     auto histogram_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    const auto morsel_splitter = MorselSplitter{};
     for (auto chunk_number = size_t{0}; chunk_number < input_chunk_count; ++chunk_number) {
       auto& chunk_information = table_information.chunk_information[chunk_number];
       const auto& input_chunk = input_chunks[chunk_number];
@@ -178,7 +184,7 @@ class RadixClusterSort {
         }
       };
 
-      if (input_chunk.size() > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
+      if (morsel_splitter.should_spawn_job(input_chunk.size())) {
         histogram_jobs.push_back(std::make_shared<JobTask>(histogram_job));
       } else {
         histogram_job();
@@ -216,7 +222,7 @@ class RadixClusterSort {
         }
       };
 
-      if (input_chunk.size() > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
+      if (morsel_splitter.should_spawn_job(input_chunk.size())) {
         cluster_jobs.push_back(std::make_shared<JobTask>(cluster_job));
       } else {
         cluster_job();
@@ -298,6 +304,7 @@ class RadixClusterSort {
   // Sorts all clusters of a materialized table.
   void _sort_clusters(MaterializedSegmentList<T>& clusters) {
     auto sort_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    const auto morsel_splitter = MorselSplitter{JoinSortMerge::SORT_ROW_COST};
     for (auto cluster_id = size_t{0}; cluster_id < clusters.size(); ++cluster_id) {
       const auto cluster_size = clusters[cluster_id].size();
       auto sort_job = [&, cluster_id] {
@@ -307,7 +314,7 @@ class RadixClusterSort {
         });
       };
 
-      if (cluster_size > JoinSortMerge::JOB_SPAWN_THRESHOLD) {
+      if (morsel_splitter.should_spawn_job(cluster_size)) {
         sort_jobs.push_back(std::make_shared<JobTask>(sort_job));
       } else {
         sort_job();
@@ -324,15 +331,17 @@ class RadixClusterSort {
     // Sort the chunks of the input tables iff join is non-equi and when clustering.
     const auto sort_materialized_chunks = !_equi_case && _cluster_count > 1;
     auto left_column_materializer = ColumnMaterializer<T>(sort_materialized_chunks, _materialize_null_left);
-    auto [materialized_left_segments, null_rows_left, samples_left] =
+    auto [materialized_left_segments, null_rows_left, samples_left, string_heaps_left] =
         left_column_materializer.materialize(_left_input_table, _left_column_id);
     output.null_rows_left = std::move(null_rows_left);
+    output.string_heaps = std::move(string_heaps_left);
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::LeftSideMaterializing, timer.lap());
 
     auto right_column_materializer = ColumnMaterializer<T>(sort_materialized_chunks, _materialize_null_right);
-    auto [materialized_right_segments, null_rows_right, samples_right] =
+    auto [materialized_right_segments, null_rows_right, samples_right, string_heaps_right] =
         right_column_materializer.materialize(_right_input_table, _right_column_id);
     output.null_rows_right = std::move(null_rows_right);
+    std::move(string_heaps_right.begin(), string_heaps_right.end(), std::back_inserter(output.string_heaps));
     _performance.set_step_runtime(JoinSortMerge::OperatorSteps::RightSideMaterializing, timer.lap());
 
     if (_cluster_count == 1) {
@@ -0,0 +1,230 @@
+#include "point_update.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+#include "utils/point_lookup.hpp"
+
+namespace hyrise {
+
+PointUpdate::PointUpdate(const std::string& table_name, const PointLookupKey& key,
+                         const std::vector<std::pair<ColumnID, AllTypeVariant>>& values)
+    : AbstractReadWriteOperator(OperatorType::PointUpdate), _table_name(table_name), _key(key), _values(values) {}
+
+const std::string& PointUpdate::name() const {
+  static const auto name = std::string{"PointUpdate"};
+  return name;
+}
+
+size_t PointUpdate::updated_row_count() const {
+  Assert(executed(), "PointUpdate has not been executed yet.");
+  return _new_row_id ? 1 : 0;
+}
+
+std::shared_ptr<const Table> PointUpdate::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _table = Hyrise::get().storage_manager.get_table(_table_name);
+  _transaction_id = context->transaction_id();
+
+  for (const auto& [column_id, value] : _values) {
+    Assert(variant_is_null(value) ? _table->column_is_nullable(column_id)
+                                  : data_type_from_all_type_variant(value) == _table->column_data_type(column_id),
+           "Values must be of the columns' data types.");
+  }
+
+  const auto old_row_id = find_visible_row(*_table, _key, *context);
+  if (!old_row_id) {
+    return nullptr;
+  }
+
+  // Lock the old version of the row. See Delete::_on_execute() for details.
+  const auto& old_mvcc_data = _table->get_chunk(old_row_id->chunk_id)->mvcc_data();
+  if (!old_mvcc_data->compare_exchange_tid(old_row_id->chunk_offset, TransactionID{0}, _transaction_id)) {
+    if (old_mvcc_data->get_tid(old_row_id->chunk_offset) == _transaction_id) {
+      // We inserted the row ourselves, e.g., when we updated it before. Make sure that even we do not see it anymore.
+      old_mvcc_data->set_tid(old_row_id->chunk_offset, INVALID_TRANSACTION_ID);
+    } else {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+  _old_row_id = old_row_id;
+
+  auto row_values = materialize_row(*_table, *old_row_id);
+  for (const auto& [column_id, value] : _values) {
+    row_values[column_id] = value;
+  }
+
+  // Write the new version. As the row is marked as being inserted by us, no other transaction sees it, so we do not
+  // hold the append mutex while writing.
+  _new_row_id = _allocate_row(_transaction_id);
+  const auto new_chunk = _table->get_chunk(_new_row_id->chunk_id);
+  const auto new_chunk_offset = _new_row_id->chunk_offset;
+  const auto column_count = _table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto& value_segment = static_cast<ValueSegment<ColumnDataType>&>(*new_chunk->get_segment(column_id));
+      const auto& value = row_values[column_id];
+      if (variant_is_null(value)) {
+        value_segment.set_null_value(new_chunk_offset);
+      } else {
+        value_segment.values()[new_chunk_offset] = boost::get<ColumnDataType>(value);
+      }
+    });
+  }
+
+  // Compute the changes of the materialized views that read the table before the transaction commits, like Delete and
+  // Insert do.
+  _materialized_view_changes.emplace_back(_table, MaterializedView::ChangeType::Delete, [old_row_id = *_old_row_id]() {
+    return std::make_shared<RowIDPosList>(1, old_row_id);
+  });
+  _materialized_view_changes.emplace_back(_table, MaterializedView::ChangeType::Insert, [new_row_id = *_new_row_id]() {
+    return std::make_shared<RowIDPosList>(1, new_row_id);
+  });
+
+  return nullptr;
+}
+
+RowID PointUpdate::_allocate_row(const TransactionID transaction_id) {
+  // See Insert::_on_execute() for details on the order of the following steps.
+  const auto insert_chunk_slot = _table->insert_chunk_slot();
+  const auto insert_chunk_lock = _table->acquire_insert_chunk_mutex(insert_chunk_slot);
+
+  const auto chunk_id = _table->get_or_append_insert_chunk(insert_chunk_slot);
+  const auto chunk = _table->get_chunk(chunk_id);
+  const auto target_chunk_size = _table->target_chunk_size();
+
+  const auto& mvcc_data = chunk->mvcc_data();
+  mvcc_data->register_insert();
+
+  const auto chunk_offset = chunk->size();
+  DebugAssert(mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid begin CID.");
+  DebugAssert(mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID, "Invalid end CID.");
+  mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  const auto column_count = chunk->column_count();
+  for (auto reverse_column_id = ColumnID{0}; reverse_column_id < column_count; ++reverse_column_id) {
+    const auto column_id = static_cast<ColumnID>(column_count - reverse_column_id - 1);
+
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment =
+          std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(chunk->get_segment(column_id));
+      Assert(value_segment, "Cannot insert into non-ValueSegments.");
+      value_segment->resize(chunk_offset + 1);
+    });
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  if (chunk_offset + 1 == target_chunk_size) {
+    chunk->mark_as_full();
+  }
+
+  return RowID{chunk_id, chunk_offset};
+}
+
+void PointUpdate::_on_commit_records(const CommitID commit_id) {
+  if (!_old_row_id) {
+    return;
+  }
+
+  // Invalidate the old version. Like Delete, we do not unlock it so that subsequent transactions fail to update it, and
+  // we update max_end_cid before invalid_row_count (see Delete's commit_with_pos_list()).
+  const auto old_chunk = _table->get_chunk(_old_row_id->chunk_id);
+  const auto& old_mvcc_data = old_chunk->mvcc_data();
+  old_mvcc_data->set_end_cid(_old_row_id->chunk_offset, commit_id);
+  set_atomic_max(old_mvcc_data->max_end_cid, commit_id);
+  old_chunk->increase_invalid_row_count(ChunkOffset{1});
+
+  // Publish the new version. See Insert::_on_commit_records().
+  const auto new_chunk = _table->get_chunk(_new_row_id->chunk_id);
+  const auto& new_mvcc_data = new_chunk->mvcc_data();
+  new_mvcc_data->set_begin_cid(_new_row_id->chunk_offset, commit_id);
+  new_mvcc_data->set_tid(_new_row_id->chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+  set_atomic_max(new_mvcc_data->max_begin_cid, commit_id);
+
+  std::atomic_thread_fence(std::memory_order_release);
+
+  new_mvcc_data->deregister_insert();
+  _index_new_chunk = new_chunk->try_set_immutable();
+  _table->update_last_commit_id(commit_id);
+
+  // Pass both versions to the materialized views that read the table.
+  for (auto& materialized_view_changes : _materialized_view_changes) {
+    materialized_view_changes.commit(commit_id);
+  }
+}
+
+void PointUpdate::_on_rollback_records() {
+  if (!_old_row_id) {
+    return;
+  }
+
+  // Unlock the old version. If we inserted it ourselves, the operator that inserted it rolls it back.
+  const auto& old_mvcc_data = _table->get_chunk(_old_row_id->chunk_id)->mvcc_data();
+  old_mvcc_data->compare_exchange_tid(_old_row_id->chunk_offset, _transaction_id, TransactionID{0});
+
+  if (!_new_row_id) {
+    return;
+  }
+
+  // Invalidate the new version. See Insert::_on_rollback_records() for why end_cid is set before begin_cid.
+  const auto new_chunk = _table->get_chunk(_new_row_id->chunk_id);
+  const auto& new_mvcc_data = new_chunk->mvcc_data();
+  new_mvcc_data->set_end_cid(_new_row_id->chunk_offset, CommitID{0});
+  new_chunk->increase_invalid_row_count(ChunkOffset{1});
+
+  std::atomic_thread_fence(std::memory_order_release);
+
+  new_mvcc_data->set_begin_cid(_new_row_id->chunk_offset, CommitID{0});
+  new_mvcc_data->set_tid(_new_row_id->chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+
+  std::atomic_thread_fence(std::memory_order_release);
+
+  new_mvcc_data->deregister_insert();
+  _index_new_chunk = new_chunk->try_set_immutable();
+}
+
+void PointUpdate::_on_finalize_records() {
+  if (_index_new_chunk) {
+    _table->add_chunk_to_table_indexes(_new_row_id->chunk_id);
+  }
+
+  for (const auto& materialized_view_changes : _materialized_view_changes) {
+    materialized_view_changes.finalize();
+  }
+}
+
+std::shared_ptr<AbstractOperator> PointUpdate::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<PointUpdate>(_table_name, _key, _values);
+}
+
+void PointUpdate::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace hyrise
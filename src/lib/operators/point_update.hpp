@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+#include "storage/materialized_view.hpp"
+#include "utils/point_lookup.hpp"
+
+namespace hyrise {
+
+/**
+ * Operator that updates a single row identified by a key (usually the primary key) without an input plan. While
+ * Update requires a validated referencing table of the rows to update and one of the new values, and executes Delete
+ * and Insert operators on them, PointUpdate resolves the row using find_visible_row() and creates the new version of
+ * the row directly:
+ *
+ *  1. The old version is locked by setting its TID, exactly like Delete does. If another transaction holds the lock,
+ *     the operator fails.
+ *  2. The values of the old version are copied, the updated columns are overwritten, and the new version is appended
+ *     to an insert chunk of the table like a single-row Insert.
+ *
+ * On commit, the old version is invalidated and the new version becomes visible. If the key does not match a visible
+ * row, nothing is updated (see updated_row_count()).
+ *
+ * Assumption: The key identifies at most one visible row.
+ */
+class PointUpdate : public AbstractReadWriteOperator {
+ public:
+  PointUpdate(const std::string& table_name, const PointLookupKey& key,
+              const std::vector<std::pair<ColumnID, AllTypeVariant>>& values);
+
+  const std::string& name() const override;
+
+  // Either zero or one. Only available after the operator was executed.
+  size_t updated_row_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_commit_records(const CommitID commit_id) override;
+  void _on_rollback_records() override;
+  void _on_finalize_records() override;
+
+ private:
+  // Allocates a row in an insert chunk of the table and marks it as being inserted by the transaction.
+  RowID _allocate_row(TransactionID transaction_id);
+
+  const std::string _table_name;
+  const PointLookupKey _key;
+  const std::vector<std::pair<ColumnID, AllTypeVariant>> _values;
+
+  std::shared_ptr<Table> _table;
+  TransactionID _transaction_id{0};
+
+  // Set if the old version was found (and locked) and the new version was allocated, respectively.
+  std::optional<RowID> _old_row_id;
+  std::optional<RowID> _new_row_id;
+
+  // Set if the chunk of the new version became immutable when committing or rolling back. It is indexed in
+  // _on_finalize_records() (see Insert).
+  bool _index_new_chunk{false};
+
+  std::vector<MaterializedViewChanges> _materialized_view_changes;
+};
+
+}  // namespace hyrise
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <string>
@@ -20,7 +21,9 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/operator_performance_data.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/chunk.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -63,7 +66,7 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
   expressions_set_transaction_context(expressions, transaction_context);
 }
 
-std::shared_ptr<const Table> Projection::_on_execute() {
+TaskCoroutine Projection::_on_execute_coroutine(std::shared_ptr<TransactionContext> /*context*/) {
   auto timer = Timer{};
 
   const auto& input_table = *left_input_table();
@@ -122,6 +125,14 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   auto forwarding_cost = std::chrono::nanoseconds{};
   auto expression_evaluator_cost = std::chrono::nanoseconds{};
 
+  // The cost of evaluating a chunk grows with the number of newly generated columns. We consider each of them to be as
+  // expensive as scanning the chunk.
+  const auto evaluated_expression_count =
+      std::count_if(expressions.cbegin(), expressions.cend(), [&](const auto& expression) {
+        return !forwarded_pqp_columns.contains(expression);
+      });
+  const auto morsel_splitter = MorselSplitter{static_cast<float>(std::max(evaluated_expression_count, ptrdiff_t{1}))};
+
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -173,11 +184,9 @@ std::shared_ptr<const Table> Projection::_on_execute() {
         }
       }
     };
-    // Evaluate the expression immediately if it contains less than `JOB_SPAWN_THRESHOLD` rows, otherwise wrap
-    // it into a task. The upper bound of the chunk size, which defines if it will be executed in parallel or not,
-    // still needs to be re-evaluated over time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
+    // Evaluate the expression immediately if the chunk is too small to be worth a task (see MorselSplitter), otherwise
+    // wrap it into a task.
+    if (morsel_splitter.should_spawn_job(input_chunk->size())) {
       auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
       jobs.push_back(job_task);
     } else {
@@ -186,7 +195,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
   }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  co_await Hyrise::get().scheduler()->schedule_and_await_tasks(jobs);
   expression_evaluator_cost += timer.lap();
 
   auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
@@ -300,8 +309,8 @@ std::shared_ptr<const Table> Projection::_on_execute() {
 
   step_performance_data.set_step_runtime(OperatorSteps::BuildOutput, timer.lap());
 
-  return std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks),
-                                 input_table.uses_mvcc());
+  _output = std::make_shared<Table>(output_column_definitions, output_table_type, std::move(output_chunks),
+                                    input_table.uses_mvcc());
 }
 
 // returns the singleton dummy table used for literal projections
@@ -12,6 +12,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "scheduler/coroutine_task.hpp"
 
 namespace hyrise {
 
@@ -50,7 +51,8 @@ class Projection : public AbstractReadOnlyOperator {
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  // Awaits the jobs that evaluate the expressions without blocking the worker (see OperatorTask).
+  TaskCoroutine _on_execute_coroutine(std::shared_ptr<TransactionContext> /*context*/) override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
 
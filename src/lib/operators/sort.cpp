@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/prefixed_string_view.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -416,34 +418,55 @@ class Sort::SortImpl {
     materialization_time = timer.lap();
 
     // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair lhs, RowIDValuePair rhs) {
-                         return comparator(lhs.second, rhs.second);
-                       });
+    const auto sort_by_value = [&](auto& row_id_value_vector) {
+      const auto sort_with_comparator = [&](auto comparator) {
+        std::stable_sort(row_id_value_vector.begin(), row_id_value_vector.end(),
+                         [comparator](const auto& lhs, const auto& rhs) {
+                           return comparator(lhs.second, rhs.second);
+                         });
+      };
+      if (_sort_mode == SortMode::Ascending) {
+        sort_with_comparator(std::less<>{});
+      } else {
+        sort_with_comparator(std::greater<>{});
+      }
     };
-    if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-    sort_time = timer.lap();
-
-    // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-    }
 
+    // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have a
+    // NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
+    // storing NULLs first even for descending orders is somewhat uncommon:
+    //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
+    // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
     auto pos_list = RowIDPosList{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
+    pos_list.reserve(_null_value_rows.size() + _row_id_value_vector.size());
+    for (const auto& [row_id, _] : _null_value_rows) {
       pos_list.emplace_back(row_id);
     }
+
+    if constexpr (std::is_same_v<SortColumnType, pmr_string>) {
+      // Strings are sorted as PrefixedStringViews that reference the materialized strings. Most comparisons can be
+      // decided by the inlined prefixes without dereferencing the strings, and moving 16-byte views is cheaper than
+      // moving strings.
+      auto row_id_view_vector = std::vector<std::pair<RowID, PrefixedStringView>>{};
+      row_id_view_vector.reserve(_row_id_value_vector.size());
+      for (const auto& [row_id, value] : _row_id_value_vector) {
+        row_id_view_vector.emplace_back(row_id, PrefixedStringView{value});
+      }
+
+      sort_by_value(row_id_view_vector);
+      sort_time = timer.lap();
+
+      for (const auto& [row_id, _] : row_id_view_vector) {
+        pos_list.emplace_back(row_id);
+      }
+    } else {
+      sort_by_value(_row_id_value_vector);
+      sort_time = timer.lap();
+
+      for (const auto& [row_id, _] : _row_id_value_vector) {
+        pos_list.emplace_back(row_id);
+      }
+    }
     temporary_result_writing_time = timer.lap();
     return pos_list;
   }
@@ -1,7 +1,9 @@
 #include "table_scan.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -24,11 +26,16 @@
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/get_table.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "operators/pqp_utils.hpp"
+#include "operators/validate.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/chunk.hpp"
+#include "storage/cooperative_scan_registry.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
@@ -45,6 +52,48 @@
 #include "utils/assert.hpp"
 #include "utils/lossless_predicate_cast.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Returns the GetTable operator of the stored table that the scan reads, either directly or after a Validate.
+std::shared_ptr<const GetTable> stored_table_input(const std::shared_ptr<const AbstractOperator>& input) {
+  if (const auto validate = std::dynamic_pointer_cast<const Validate>(input)) {
+    return std::dynamic_pointer_cast<const GetTable>(validate->left_input());
+  }
+  return std::dynamic_pointer_cast<const GetTable>(input);
+}
+
+// Returns the ChunkIDs of the stored table that the chunks of the input table read. Chunks that reference multiple
+// chunks (or none) get INVALID_CHUNK_ID.
+std::vector<ChunkID> stored_chunk_ids(const GetTable& get_table, const Table& input_table) {
+  const auto& get_table_chunk_ids = get_table.stored_chunk_ids();
+  if (input_table.type() == TableType::Data) {
+    DebugAssert(get_table_chunk_ids.size() == input_table.chunk_count(), "Input is not the output of the GetTable.");
+    return get_table_chunk_ids;
+  }
+
+  // The output chunks of Validate reference single chunks of the GetTable's output.
+  const auto chunk_count = input_table.chunk_count();
+  auto chunk_ids = std::vector<ChunkID>(chunk_count, INVALID_CHUNK_ID);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table.get_chunk(chunk_id);
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    const auto& pos_list = reference_segment->pos_list();
+    if (pos_list->empty() || !pos_list->references_single_chunk()) {
+      continue;
+    }
+
+    const auto referenced_chunk_id = pos_list->common_chunk_id();
+    if (referenced_chunk_id < get_table_chunk_ids.size()) {
+      chunk_ids[chunk_id] = get_table_chunk_ids[referenced_chunk_id];
+    }
+  }
+  return chunk_ids;
+}
+
+}  // namespace
+
 namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
@@ -99,7 +148,7 @@ std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
   return table_scan;
 }
 
-std::shared_ptr<const Table> TableScan::_on_execute() {
+TaskCoroutine TableScan::_on_execute_coroutine(std::shared_ptr<TransactionContext> /*context*/) {
   DebugAssert(excluded_chunk_ids, "Excluded ChunkIDs vector has not been initialized.");
   DebugAssert(std::is_sorted(excluded_chunk_ids->cbegin(), excluded_chunk_ids->cend()),
               "Excluded ChunkIDs must be sorted.");
@@ -110,10 +159,43 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   auto output_mutex = std::mutex{};
 
+  // GetTable might have excluded further chunks during execution, which shifts the ChunkIDs of its output.
+  auto input_excluded_chunk_ids = *excluded_chunk_ids;
+  if (const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input())) {
+    input_excluded_chunk_ids = get_table->output_chunk_ids(*excluded_chunk_ids);
+  }
+
   const auto chunk_count = in_table->chunk_count();
-  const auto chunks_to_scan = chunk_count - excluded_chunk_ids->size();
+  const auto chunks_to_scan = chunk_count - input_excluded_chunk_ids.size();
 
-  auto excluded_chunk_ids_iter = excluded_chunk_ids->cbegin();
+  auto excluded_chunk_ids_iter = input_excluded_chunk_ids.cbegin();
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(chunks_to_scan);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (excluded_chunk_ids_iter != input_excluded_chunk_ids.cend() && chunk_id == *excluded_chunk_ids_iter) {
+      ++excluded_chunk_ids_iter;
+      continue;
+    }
+    chunk_ids.emplace_back(chunk_id);
+  }
+
+  // When scanning a stored table, attach to the circular scan of concurrent scans of that table and start at the chunk
+  // that they currently read (see CooperativeScanRegistry). As the output chunks are not ordered anyway when the chunks
+  // are scanned in parallel, scanning the chunks in a different order does not change the result.
+  auto cooperative_scan_cursor = std::shared_ptr<CooperativeScanCursor>{};
+  auto stored_chunk_ids_of_input = std::vector<ChunkID>{};
+  if (const auto get_table = stored_table_input(left_input())) {
+    stored_chunk_ids_of_input = stored_chunk_ids(*get_table, *in_table);
+    cooperative_scan_cursor = Hyrise::get().cooperative_scan_registry.attach(get_table->table_name());
+
+    const auto position = cooperative_scan_cursor->position();
+    const auto first_chunk_id_iter = std::find_if(chunk_ids.begin(), chunk_ids.end(), [&](const auto chunk_id) {
+      const auto stored_chunk_id = stored_chunk_ids_of_input[chunk_id];
+      return stored_chunk_id != INVALID_CHUNK_ID && stored_chunk_id >= position;
+    });
+    std::rotate(chunk_ids.begin(), first_chunk_id_iter, chunk_ids.end());
+  }
 
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
   output_chunks.reserve(chunks_to_scan);
@@ -121,17 +203,26 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(chunks_to_scan);
 
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-    if (excluded_chunk_ids_iter != excluded_chunk_ids->cend() && chunk_id == *excluded_chunk_ids_iter) {
-      ++excluded_chunk_ids_iter;
-      continue;
-    }
+  // Scans of the chunks of a cooperative scan in their circular order, see below.
+  auto cooperative_chunk_scans = std::vector<std::function<void()>>{};
+  auto next_cooperative_chunk_scan = std::atomic<size_t>{0};
+  auto spawnable_chunk_count = size_t{0};
+
+  const auto morsel_splitter = MorselSplitter{};
 
+  for (const auto chunk_id : chunk_ids) {
     const auto& chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+    const auto stored_chunk_id = cooperative_scan_cursor ? stored_chunk_ids_of_input[chunk_id] : INVALID_CHUNK_ID;
+
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto perform_table_scan = [this, chunk_id, chunk_in, stored_chunk_id, &cooperative_scan_cursor, &in_table,
+                               &output_mutex, &output_chunks]() {
+      if (stored_chunk_id != INVALID_CHUNK_ID) {
+        cooperative_scan_cursor->advance(stored_chunk_id);
+      }
+
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
       if (matches_out->empty()) {
@@ -223,25 +314,54 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       const auto lock = std::lock_guard<std::mutex>{output_mutex};
       output_chunks.emplace_back(chunk);
     };
-    // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
-    // time to find the value which gives the best performance.
-    constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
-    if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
+
+    if (cooperative_scan_cursor) {
+      cooperative_chunk_scans.emplace_back(perform_table_scan);
+      spawnable_chunk_count += morsel_splitter.should_spawn_job(chunk_in->size()) ? 1 : 0;
+      continue;
+    }
+
+    // Spawn job when chunk sufficiently large (see MorselSplitter).
+    if (morsel_splitter.should_spawn_job(chunk_in->size())) {
       auto job_task = std::make_shared<JobTask>(perform_table_scan);
+      // Scan the chunk on the NUMA node that holds its data (if it was placed on one, see Chunk::node_id()).
+      job_task->set_preferred_node_id(chunk_in->node_id());
       jobs.push_back(job_task);
     } else {
       perform_table_scan();
     }
   }
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  // The chunks of a cooperative scan are handed out one at a time in their circular order, and each chunk advances the
+  // shared cursor when it is handed out. Thus, the cursor follows the chunks that the scan currently reads, and scans
+  // that attach later start there. Each job scans chunks until all are handed out, so the scan takes at most one
+  // worker per spawnable chunk. In contrast to the per-chunk jobs above, the jobs do not prefer the chunks' NUMA nodes.
+  if (!cooperative_chunk_scans.empty()) {
+    const auto scan_next_chunks = [&cooperative_chunk_scans, &next_cooperative_chunk_scan]() {
+      const auto chunk_scan_count = cooperative_chunk_scans.size();
+      for (auto index = next_cooperative_chunk_scan++; index < chunk_scan_count;
+           index = next_cooperative_chunk_scan++) {
+        cooperative_chunk_scans[index]();
+      }
+    };
+
+    const auto job_count = std::min(spawnable_chunk_count, Hyrise::get().topology.num_cpus());
+    if (job_count == 0) {
+      scan_next_chunks();
+    }
+    for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>(scan_next_chunks));
+    }
+  }
+
+  co_await Hyrise::get().scheduler()->schedule_and_await_tasks(jobs);
 
   auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
 
-  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+  _output = std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
 std::shared_ptr<const AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
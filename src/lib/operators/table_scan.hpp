@@ -9,6 +9,7 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -50,6 +51,9 @@ class TableScan : public AbstractReadOnlyOperator {
    * since the optimizer had distributed the chunks between
    * operators. This is why this scan accepts a list of
    * excluded chunks and all others a list of included chunks.
+   *
+   * If the input is a GetTable, the ChunkIDs refer to its chunks at optimization-time, like the included ChunkIDs of
+   * the IndexScan, and are mapped to the ChunkIDs of the input table during execution.
    */
   std::shared_ptr<std::vector<ChunkID>> excluded_chunk_ids;
 
@@ -69,7 +73,8 @@ class TableScan : public AbstractReadOnlyOperator {
   };
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  // Awaits the jobs that scan the chunks without blocking the worker (see OperatorTask).
+  TaskCoroutine _on_execute_coroutine(std::shared_ptr<TransactionContext> /*context*/) override;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
@@ -7,14 +7,19 @@
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <bit>
+#include <cstddef>
 
 #include "operators/operator_performance_data.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/segment_iterables/any_segment_iterator.hpp"
+#include "storage/validity_bitmap.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace hyrise {
@@ -241,6 +246,52 @@ class AbstractTableScanImpl {
     // The remainder is now done by the regular scan
   }
 
+  /**
+   * Scans values that contain NULLs without checking each position for NULL. For each word of the @param validity
+   * bitmap, `func` is evaluated for the corresponding values, including the values at NULL positions, and the
+   * resulting match bits are ANDed with the word. Words that only contain NULLs are skipped.
+   */
+  template <typename UnaryFunctor, typename T>
+  static void __attribute__((hot, flatten, noinline))
+  _scan_with_validity_bitmap(const UnaryFunctor func, const pmr_vector<T>& values, const ValidityBitmap& validity,
+                             const ChunkID chunk_id, RowIDPosList& matches_out) {
+    DebugAssert(values.size() == validity.size(), "Validity bitmap does not match the values.");
+    constexpr auto WORD_SIZE = ValidityBitmap::WORD_SIZE;
+
+    const auto& words = validity.words();
+    const auto word_count = words.size();
+    const auto value_count = values.size();
+    for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+      if (!words[word_id]) {
+        continue;
+      }
+
+      const auto* const word_values = values.data() + word_id * WORD_SIZE;
+      const auto bit_count = std::min(WORD_SIZE, value_count - word_id * WORD_SIZE);
+      auto mask = ValidityBitmap::Word{0};
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask)
+      // clang-format on
+      for (auto bit = size_t{0}; bit < bit_count; ++bit) {
+        mask |= static_cast<ValidityBitmap::Word>(func(word_values[bit])) << bit;
+      }
+
+      _append_matches(mask & words[word_id], word_id * WORD_SIZE, chunk_id, matches_out);
+    }
+  }
+
+  // Appends the positions of the bits that are set in @param word, where bit 0 belongs to @param first_offset.
+  static void _append_matches(ValidityBitmap::Word word, const size_t first_offset, const ChunkID chunk_id,
+                              RowIDPosList& matches_out) {
+    while (word) {
+      const auto offset = first_offset + static_cast<size_t>(std::countr_zero(word));
+      matches_out.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(offset)});
+      word &= word - 1;
+    }
+  }
+
   /**@}*/
 };
 
@@ -8,7 +8,7 @@
 #include "storage/base_value_segment.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
-#include "storage/value_segment/null_value_vector_iterable.hpp"
+#include "storage/validity_bitmap.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -112,17 +112,22 @@ void ColumnIsNullTableScanImpl::_scan_value_segment(const BaseValueSegment& segm
     return;
   }
 
-  DebugAssert(segment.is_nullable(), "Columns that are not nullable should have been caught by edge case handling.");
+  DebugAssert(segment.contains_null_values(),
+              "Segments without NULL values should have been caught by edge case handling.");
 
-  auto iterable = NullValueVectorIterable{segment.null_values()};
+  // The matching positions are the valid positions (IS NOT NULL) or their complement (IS NULL). They are emitted word
+  // by word, so that words without matches are skipped entirely.
+  auto bitmap = ValidityBitmap::from_null_values(segment.null_values());
+  if (_predicate_condition == PredicateCondition::IsNull) {
+    bitmap.invert();
+  }
 
-  const auto invert = _predicate_condition == PredicateCondition::IsNotNull;
-  const auto functor = [&](const auto& value) {
-    return invert ^ value.is_null();
-  };
-  iterable.with_iterators([&](auto iter, auto end) {
-    _scan_with_iterators<false>(functor, iter, end, chunk_id, matches);
-  });
+  matches.reserve(matches.size() + bitmap.count());
+  const auto& words = bitmap.words();
+  const auto word_count = words.size();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    _append_matches(words[word_id], word_id * ValidityBitmap::WORD_SIZE, chunk_id, matches);
+  }
 }
 
 bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) const {
@@ -131,7 +136,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
       return false;
 
     case PredicateCondition::IsNotNull:
-      return !segment.is_nullable();
+      return !segment.contains_null_values();
 
     default:
       Fail("Unsupported comparison type encountered");
@@ -141,7 +146,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
 bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::IsNull:
-      return !segment.is_nullable();
+      return !segment.contains_null_values();
 
     case PredicateCondition::IsNotNull:
       return false;
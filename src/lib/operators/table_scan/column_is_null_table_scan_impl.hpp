@@ -31,7 +31,9 @@ class ColumnIsNullTableScanImpl : public AbstractTableScanImpl {
   void _scan_generic_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                     const SortMode sorted_by) const;
 
-  // Optimized scan on ValueSegments
+  // Optimized scan on ValueSegments. Segments without NULL values are handled without reading their NULL values
+  // (see _matches_all() and _matches_none()). Otherwise, the NULL values are converted into a ValidityBitmap, whose
+  // words are emitted as matches.
   void _scan_value_segment(const BaseValueSegment& segment, const ChunkID chunk_id, RowIDPosList& matches);
 
   /**
@@ -1,6 +1,9 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -15,9 +18,13 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_access_counter.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "storage/validity_bitmap.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -56,9 +63,45 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-  } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    return;
+  }
+
+  // Run-length and frame-of-reference segments are scanned directly on their compressed representation when the entire
+  // segment is scanned. The same holds for the NULL values of value segments. Position filters require point accesses,
+  // for which the generic path is used.
+  if (!position_filter) {
+    auto scanned_directly = false;
+    resolve_data_type(_in_table->column_data_type(_column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      if (const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+        // Value segments without NULL values are scanned by the generic path without any NULL checks.
+        if (value_segment->contains_null_values()) {
+          _scan_value_segment_with_null_values(*value_segment, chunk_id, matches);
+          scanned_directly = true;
+        }
+      }
+
+      if (const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment)) {
+        _scan_run_length_segment(*run_length_segment, chunk_id, matches);
+        scanned_directly = true;
+      }
+
+      if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+        if (const auto* frame_of_reference_segment =
+                dynamic_cast<const FrameOfReferenceSegment<ColumnDataType>*>(&segment)) {
+          _scan_frame_of_reference_segment(*frame_of_reference_segment, chunk_id, matches);
+          scanned_directly = true;
+        }
+      }
+    });
+
+    if (scanned_directly) {
+      return;
+    }
   }
+
+  _scan_generic_segment(segment, chunk_id, matches, position_filter);
 }
 
 void ColumnVsValueTableScanImpl::_scan_generic_segment(
@@ -180,6 +223,180 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+template <typename T>
+void ColumnVsValueTableScanImpl::_scan_value_segment_with_null_values(const ValueSegment<T>& segment,
+                                                                      const ChunkID chunk_id, RowIDPosList& matches) {
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+  const auto validity = ValidityBitmap::from_null_values(segment.null_values());
+  const auto typed_value = boost::get<T>(value);
+
+  with_comparator(predicate_condition, [&](auto predicate_comparator) {
+    const auto comparator = [predicate_comparator, &typed_value](const auto& segment_value) {
+      return predicate_comparator(segment_value, typed_value);
+    };
+    _scan_with_validity_bitmap(comparator, segment.values(), validity, chunk_id, matches);
+  });
+}
+
+template <typename T>
+void ColumnVsValueTableScanImpl::_scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id,
+                                                          RowIDPosList& matches) {
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+  const auto run_count = values.size();
+  const auto typed_value = boost::get<T>(value);
+
+  const auto previous_match_count = matches.size();
+
+  with_comparator(predicate_condition, [&](auto predicate_comparator) {
+    // End positions are inclusive, i.e., a run spans [run_begin, end_positions[run_id]].
+    auto run_begin = ChunkOffset::base_type{0};
+    for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+      const auto run_end = static_cast<ChunkOffset::base_type>(end_positions[run_id]) + 1;
+
+      if (!null_values[run_id] && predicate_comparator(values[run_id], typed_value)) {
+        const auto output_start_offset = matches.size();
+        matches.resize(output_start_offset + run_end - run_begin);
+
+        // NOLINTNEXTLINE
+        {}  // clang-format off
+        #pragma omp simd
+        // clang-format on
+        for (auto offset = run_begin; offset < run_end; ++offset) {
+          matches[output_start_offset + offset - run_begin] = RowID{chunk_id, ChunkOffset{offset}};
+        }
+      }
+
+      run_begin = run_end;
+    }
+  });
+
+  const auto match_count = matches.size() - previous_match_count;
+  if (match_count == 0) {
+    ++num_chunks_with_early_out;
+  } else if (match_count == segment.size()) {
+    ++num_chunks_with_all_rows_matching;
+  }
+}
+
+void ColumnVsValueTableScanImpl::_scan_frame_of_reference_segment(const FrameOfReferenceSegment<int32_t>& segment,
+                                                                  const ChunkID chunk_id,
+                                                                  RowIDPosList& matches) {
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+  constexpr auto BLOCK_SIZE = FrameOfReferenceSegment<int32_t>::block_size;
+
+  const auto& block_minima = segment.block_minima();
+  const auto& null_values = segment.null_values();
+  const auto segment_size = static_cast<ChunkOffset::base_type>(segment.size());
+  const auto typed_value = static_cast<int64_t>(boost::get<int32_t>(value));
+
+  /**
+   * All values of a block lie in [block_minimum, block_minimum + 2^32 - 1]. Only the lower bound of each block is
+   * known, so blocks can be skipped or fully accepted if the search value is below (or equal to) the block minimum:
+   *
+   * Operator        | No rows of the block match if:   | All (non-NULL) rows of the block match if:
+   * column == value | value < minimum                  | -
+   * column != value | -                                | value < minimum
+   * column <  value | value <= minimum                 | -
+   * column <= value | value < minimum                  | -
+   * column >  value | -                                | value < minimum
+   * column >= value | -                                | value <= minimum
+   *
+   * For all other blocks, the predicate is evaluated on the offsets, i.e., `offset OP (value - minimum)`. If
+   * (value - minimum) exceeds the range of the offsets, the value is larger than every value of the block.
+   */
+  enum class BlockMatch { None, All, Offsets };
+
+  const auto block_match = [&](const int64_t block_minimum) {
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::LessThanEquals:
+        return typed_value < block_minimum ? BlockMatch::None : BlockMatch::Offsets;
+      case PredicateCondition::LessThan:
+        return typed_value <= block_minimum ? BlockMatch::None : BlockMatch::Offsets;
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::GreaterThan:
+        return typed_value < block_minimum ? BlockMatch::All : BlockMatch::Offsets;
+      case PredicateCondition::GreaterThanEquals:
+        return typed_value <= block_minimum ? BlockMatch::All : BlockMatch::Offsets;
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+  };
+
+  const auto previous_match_count = matches.size();
+  auto skipped_block_count = size_t{0};
+
+  resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+    with_comparator(predicate_condition, [&](auto predicate_comparator) {
+      const auto block_count = block_minima.size();
+      for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+        const auto block_begin = static_cast<ChunkOffset::base_type>(block_id * BLOCK_SIZE);
+        const auto block_end = std::min(static_cast<ChunkOffset::base_type>(block_begin + BLOCK_SIZE), segment_size);
+        const auto block_minimum = static_cast<int64_t>(block_minima[block_id]);
+
+        auto match = block_match(block_minimum);
+        const auto value_offset = typed_value - block_minimum;
+        if (match == BlockMatch::Offsets && value_offset > int64_t{std::numeric_limits<uint32_t>::max()}) {
+          // The value is larger than any value that can be stored in this block.
+          const auto is_less_condition = predicate_condition == PredicateCondition::LessThan ||
+                                         predicate_condition == PredicateCondition::LessThanEquals ||
+                                         predicate_condition == PredicateCondition::NotEquals;
+          match = is_less_condition ? BlockMatch::All : BlockMatch::None;
+        }
+
+        if (match == BlockMatch::None) {
+          ++skipped_block_count;
+          continue;
+        }
+
+        if (match == BlockMatch::All && !null_values) {
+          const auto output_start_offset = matches.size();
+          matches.resize(output_start_offset + block_end - block_begin);
+
+          // NOLINTNEXTLINE
+          {}  // clang-format off
+          #pragma omp simd
+          // clang-format on
+          for (auto offset = block_begin; offset < block_end; ++offset) {
+            matches[output_start_offset + offset - block_begin] = RowID{chunk_id, ChunkOffset{offset}};
+          }
+          continue;
+        }
+
+        if (match == BlockMatch::All) {
+          for (auto offset = block_begin; offset < block_end; ++offset) {
+            if (!(*null_values)[offset]) {
+              matches.emplace_back(chunk_id, ChunkOffset{offset});
+            }
+          }
+          continue;
+        }
+
+        // NULLs are stored with the block minimum as their offset (i.e., zero) and need to be checked explicitly.
+        const auto search_offset = static_cast<uint32_t>(value_offset);
+        auto offset_it = offset_values.cbegin() + block_begin;
+        for (auto offset = block_begin; offset < block_end; ++offset, ++offset_it) {
+          if (predicate_comparator(*offset_it, search_offset) && (!null_values || !(*null_values)[offset])) {
+            matches.emplace_back(chunk_id, ChunkOffset{offset});
+          }
+        }
+      }
+    });
+  });
+
+  if (skipped_block_count == block_minima.size()) {
+    ++num_chunks_with_early_out;
+  } else if (matches.size() - previous_match_count == segment.size()) {
+    ++num_chunks_with_all_rows_matching;
+  }
+}
+
 void ColumnVsValueTableScanImpl::_scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id,
                                                       RowIDPosList& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
@@ -9,6 +9,9 @@
 
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 #include "all_type_variant.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -17,10 +20,15 @@ namespace hyrise {
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
- * - Value segments are scanned sequentially
+ * - Value segments are scanned sequentially. If they contain NULL values, the matches are combined with a
+ *   ValidityBitmap word by word instead of checking each position for NULL.
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For run-length segments, the predicate is evaluated once per run and matching runs are emitted as offset ranges
+ * - For frame-of-reference segments, the value is compared to each block's minimum to skip or fully accept blocks.
+ *   The remaining blocks are scanned by comparing the stored offsets against the value's offset to the block minimum,
+ *   so that no values have to be reconstructed.
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -40,6 +48,15 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  template <typename T>
+  void _scan_value_segment_with_null_values(const ValueSegment<T>& segment, const ChunkID chunk_id,
+                                            RowIDPosList& matches);
+  template <typename T>
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, const ChunkID chunk_id,
+                                RowIDPosList& matches);
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<int32_t>& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches);
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter, const SortMode sort_mode);
 
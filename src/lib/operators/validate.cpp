@@ -1,5 +1,6 @@
 #include "validate.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -16,6 +17,7 @@
 #include "operators/abstract_read_write_operator.hpp"  // IWYU pragma: keep
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/morsel_splitter.hpp"
 #include "storage/chunk.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/pos_lists/abstract_pos_list.hpp"
@@ -30,6 +32,9 @@ namespace hyrise {
 
 namespace {
 
+// Cost of validating a row relative to scanning it (see MorselSplitter).
+constexpr auto VALIDATE_ROW_COST = 0.25f;
+
 bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
                     const MvccData& mvcc_data) {
   const auto row_tid = mvcc_data.get_tid(chunk_offset);
@@ -62,7 +67,15 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
   const auto& mvcc_data = chunk->mvcc_data();
   const auto max_begin_cid = mvcc_data->max_begin_cid.load();
 
-  return !chunk->is_mutable() && snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
+  // Invalidated rows are still visible if they were invalidated after the transaction started.
+  return !chunk->is_mutable() && snapshot_commit_id >= max_begin_cid &&
+         (chunk->invalid_row_count() == 0 || snapshot_commit_id < mvcc_data->min_end_cid.load());
+}
+
+bool Validate::_can_ignore_transaction_ids(const std::shared_ptr<const Chunk>& chunk) const {
+  // Immutable chunks do not contain rows with pending inserts. If the transaction has no in-flight deletes, it cannot
+  // have locked any rows, so their TIDs do not influence the visibility.
+  return _can_use_chunk_shortcut && !chunk->is_mutable();
 }
 
 Validate::Validate(const std::shared_ptr<AbstractOperator>& input_operator)
@@ -100,52 +113,52 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   output_chunks.reserve(chunk_count);
   auto output_mutex = std::mutex{};
 
-  auto job_start_chunk_id = ChunkID{0};
-  auto job_end_chunk_id = ChunkID{0};
-  auto job_row_count = uint32_t{0};
-
   // In some cases, we can identify a chunk as being entirely visible for the current transaction. Simply said,
   // if the youngest row in a chunk is visible, all other rows are older and hence visible, too. This applies if
   // (1) the chunk is immutable, i.e., no new rows can be added while this transaction is being executed,
   // (2) all rows in the chunk have been committed (i.e., their begin_cid has been set),
   // (3) the highest begin_cid in the chunk is lower than/equal to the snapshot_cid of the transaction
   //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
-  // (4) no rows in the chunk have been invalidated before this transaction was started,
+  // (4) no rows in the chunk have been invalidated before this transaction was started (i.e., there are either no
+  //     invalidated rows or the lowest end_cid in the chunk is higher than the snapshot_cid),
   // (5) the current transaction has no in-flight deletes.
+  // If only (4) is not met for an immutable chunk, the visibility of a row only depends on its begin_cid and end_cid,
+  // which Validate checks for all rows of the chunk in a vectorized loop (see MvccData::get_committed_visibility()).
+  // If all rows turn out to be visible, the chunk is nevertheless forwarded as a whole.
   const auto& read_write_operators = transaction_context->read_write_operators();
   for (const auto& read_write_operator : read_write_operators) {
-    if (read_write_operator->type() == OperatorType::Delete) {
+    // Besides Delete, PointUpdate locks the old versions of the rows it updates.
+    if (read_write_operator->type() == OperatorType::Delete ||
+        read_write_operator->type() == OperatorType::PointUpdate) {
       _can_use_chunk_shortcut = false;
       break;
     }
   }
 
-  while (job_end_chunk_id < chunk_count) {
-    const auto chunk = input_table->get_chunk(job_end_chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    // Small chunks are bundled together to avoid unnecessary scheduling overhead.
-    // Therefore, we count the number of rows to ensure a minimum of rows per job (default chunk size).
-    job_row_count += chunk->size();
-    if (job_row_count >= Chunk::DEFAULT_SIZE || job_end_chunk_id == (chunk_count - 1)) {
-      // Single tasks are executed directly instead of scheduling a single job.
-      const auto execute_directly = job_start_chunk_id == 0 && job_end_chunk_id == (chunk_count - 1);
-
-      if (execute_directly) {
-        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                         output_mutex);
-      } else {
-        jobs.push_back(std::make_shared<JobTask>([&, input_table, job_start_chunk_id, job_end_chunk_id] {
-          _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
-                           output_chunks, output_mutex);
-        }));
-
-        // Prepare next job
-        job_start_chunk_id = job_end_chunk_id + 1;
-        job_row_count = 0;
-      }
+  // Small chunks are bundled together to avoid unnecessary scheduling overhead (see MorselSplitter). Validating a row
+  // is much cheaper than, e.g., scanning it, as the visibility checks are vectorized or skipped for entire chunks.
+  const auto chunk_ranges = MorselSplitter{VALIDATE_ROW_COST}.split_chunks(*input_table);
+  if (chunk_ranges.size() == 1) {
+    // Single tasks are executed directly instead of scheduling a single job.
+    if (chunk_count > 0) {
+      _validate_chunks(input_table, ChunkID{0}, ChunkID{chunk_count - 1}, our_tid, snapshot_commit_id, output_chunks,
+                       output_mutex);
+    }
+  } else {
+    for (const auto& [begin_chunk_id, end_chunk_id] : chunk_ranges) {
+      const auto job_start_chunk_id = begin_chunk_id;
+      const auto job_end_chunk_id = ChunkID{end_chunk_id - 1};
+      auto job_task = std::make_shared<JobTask>([&, input_table, job_start_chunk_id, job_end_chunk_id] {
+        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
+                         output_chunks, output_mutex);
+      });
+      // Chunks placed on NUMA nodes usually span multiple consecutive chunks (see numa_placement.hpp), so we validate
+      // the bundled chunks on the node of the first one.
+      const auto first_chunk = input_table->get_chunk(job_start_chunk_id);
+      Assert(first_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      job_task->set_preferred_node_id(first_chunk->node_id());
+      jobs.push_back(job_task);
     }
-    job_end_chunk_id++;
   }
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
@@ -271,6 +284,29 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       if (_is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
         // Not using the entirely_visible_chunks cache here as for data tables, we only look at chunks once anyway.
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+      } else if (_can_ignore_transaction_ids(chunk_in)) {
+        const auto chunk_size = chunk_in->size();
+        auto visible_rows = std::vector<uint8_t>{};
+        chunk_in->mvcc_data()->get_committed_visibility(chunk_size, snapshot_commit_id, visible_rows);
+
+        const auto visible_row_count = static_cast<ChunkOffset::base_type>(
+            std::count(visible_rows.cbegin(), visible_rows.cend(), uint8_t{1}));
+        if (visible_row_count == chunk_size) {
+          pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_size);
+        } else {
+          auto temp_pos_list = RowIDPosList(visible_row_count);
+          temp_pos_list.guarantee_single_chunk();
+          auto pos_list_offset = size_t{0};
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            if (pos_list_offset == visible_row_count) {
+              break;
+            }
+            // Write unconditionally to avoid branch mispredictions. Only visible rows advance the write position.
+            temp_pos_list[pos_list_offset] = RowID{chunk_id, chunk_offset};
+            pos_list_offset += visible_rows[chunk_offset];
+          }
+          pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+        }
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
         auto temp_pos_list = RowIDPosList{};
@@ -297,7 +333,8 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       const auto lock = std::lock_guard<std::mutex>{output_mutex};
       // The validate operator does not affect the sorted_by property. If a chunk has been sorted before, it still is
       // after the validate operator.
-      const auto chunk = std::make_shared<Chunk>(output_segments);
+      // Like TableScan, we use the input chunk's allocator so that subsequent operators know the chunk's NUMA node.
+      const auto chunk = std::make_shared<Chunk>(output_segments, nullptr, chunk_in->get_allocator());
       chunk->set_immutable();
 
       const auto& sorted_by = chunk_in->individually_sorted_by();
@@ -38,6 +38,9 @@ class Validate : public AbstractReadOnlyOperator {
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Returns true if the visibility of all rows in the chunk is determined by their begin_cids and end_cids alone.
+  bool _can_ignore_transaction_ids(const std::shared_ptr<const Chunk>& chunk) const;
+
   bool _can_use_chunk_shortcut = true;
 
  protected:
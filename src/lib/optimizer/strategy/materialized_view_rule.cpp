@@ -0,0 +1,100 @@
+#include "materialized_view_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "storage/materialized_view.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+MaterializedViewRule::MaterializedViewRule(const CommitID snapshot_commit_id)
+    : _snapshot_commit_id{snapshot_commit_id} {}
+
+std::string MaterializedViewRule::name() const {
+  static const auto name = std::string{"MaterializedViewRule"};
+  return name;
+}
+
+void MaterializedViewRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  Assert(lqp_root->type == LQPNodeType::Root, "MaterializedViewRule needs root to hold onto.");
+
+  auto materialized_views = std::vector<std::shared_ptr<MaterializedView>>{};
+  for (const auto& [materialized_view_name, materialized_view] : Hyrise::get().storage_manager.materialized_views()) {
+    if (materialized_view->covers_snapshot(_snapshot_commit_id)) {
+      materialized_views.emplace_back(materialized_view);
+    }
+  }
+
+  if (materialized_views.empty()) {
+    return;
+  }
+
+  const auto output_expressions = lqp_root->left_input()->output_expressions();
+  auto column_names = std::vector<std::string>{};
+  for (const auto& output_expression : output_expressions) {
+    column_names.emplace_back(output_expression->as_column_name());
+  }
+
+  // Replace the matching aggregates and remember which expressions replace their output.
+  auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Aggregate) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    for (const auto& materialized_view : materialized_views) {
+      if (*node != *materialized_view->aggregate_node()) {
+        continue;
+      }
+
+      const auto view_lqp = materialized_view->make_lqp();
+      const auto aggregate_expressions = node->output_expressions();
+      const auto view_expressions = view_lqp->output_expressions();
+      DebugAssert(aggregate_expressions.size() == view_expressions.size(), "Expected view to have the same output.");
+      for (auto column_id = size_t{0}; column_id < aggregate_expressions.size(); ++column_id) {
+        expression_mapping.emplace(aggregate_expressions[column_id], view_expressions[column_id]);
+      }
+
+      const auto outputs = node->outputs();
+      const auto input_sides = node->get_input_sides();
+      for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+        outputs[output_idx]->set_input(input_sides[output_idx], view_lqp);
+      }
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  if (expression_mapping.empty()) {
+    return;
+  }
+
+  visit_lqp(lqp_root, [&](const auto& node) {
+    for (auto& expression : node->node_expressions) {
+      expression_deep_replace(expression, expression_mapping);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  // The replaced aggregates are named differently. If they are part of the output, restore the names.
+  const auto rewritten_output_expressions = lqp_root->left_input()->output_expressions();
+  for (auto column_id = size_t{0}; column_id < rewritten_output_expressions.size(); ++column_id) {
+    if (rewritten_output_expressions[column_id]->as_column_name() != column_names[column_id]) {
+      lqp_insert_node(lqp_root, LQPInputSide::Left, AliasNode::make(rewritten_output_expressions, column_names));
+      break;
+    }
+  }
+}
+
+}  // namespace hyrise
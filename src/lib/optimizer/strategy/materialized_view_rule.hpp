@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces AggregateNodes (including their inputs) that are equal to the aggregate of a MaterializedView with the LQP
+ * that reads the view's stored result (see MaterializedView::make_lqp()). Expressions of the nodes above that referred
+ * to the replaced aggregates are adapted, and the output column names of the plan are kept.
+ *
+ * Only views that cover the given snapshot are used (see MaterializedView::covers_snapshot()). Thus, the rule is not
+ * part of the default optimizer, whose plans are cached and reused for other snapshots. Instead, SQLPipelineStatement
+ * applies it to the unoptimized LQP of auto-commit statements, as the views do not reflect uncommitted modifications
+ * that other statements of the transaction made. The unoptimized LQP is used because the views store their aggregate
+ * as translated by the SQLTranslator. Other rules might reorder or push down predicates, so that equal queries would
+ * not be recognized anymore.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  explicit MaterializedViewRule(const CommitID snapshot_commit_id);
+
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+
+  const CommitID _snapshot_commit_id;
+};
+
+}  // namespace hyrise
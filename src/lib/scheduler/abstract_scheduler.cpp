@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
@@ -43,4 +44,8 @@ void AbstractScheduler::schedule_and_wait_for_tasks(const std::vector<std::share
   wait_for_tasks(tasks);
 }
 
+TasksAwaiter AbstractScheduler::schedule_and_await_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  return TasksAwaiter{*this, tasks};
+}
+
 }  // namespace hyrise
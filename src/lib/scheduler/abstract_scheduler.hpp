@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "worker.hpp"
@@ -42,7 +43,8 @@ class TaskQueue;
  * parts of its work by taking a void-returning lambda. If a task itself spawns tasks to be executed, the worker
  * executing the main task executes these tasks directly when possible or waits for their completion in case other
  * workers already process these tasks (during this wait time, the worker pulls tasks from the TaskQueues to avoid
- * idling).
+ * idling). CoroutineTasks can instead await the tasks they spawn. They are suspended while the tasks are executed
+ * and do not occupy their worker (see CoroutineTask).
  *
  */
 
@@ -87,7 +89,13 @@ class AbstractScheduler : public Noncopyable {
   // NodeQueueScheduler::_group_tasks for an example.
   void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
 
+  // Awaitable variant of schedule_and_wait_for_tasks for coroutines executed by CoroutineTasks. The awaiting coroutine
+  // is suspended (without blocking its worker) and resumed once all tasks are done (see TasksAwaiter).
+  TasksAwaiter schedule_and_await_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
  protected:
+  friend class TasksAwaiter;
+
   // Internal helper method that adds predecessor/successor relationships between tasks to limit the degree of
   // parallelism and reduce scheduling overhead.
   virtual void _group_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) const;
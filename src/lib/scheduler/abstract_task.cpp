@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "query_context.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "worker.hpp"
@@ -83,6 +85,15 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+void AbstractTask::set_preferred_node_id(NodeID preferred_node_id) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the preferred node after the Task was scheduled.");
+  _preferred_node_id = preferred_node_id;
+}
+
+NodeID AbstractTask::preferred_node_id() const {
+  return _preferred_node_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -97,6 +108,15 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
   _done_callback = done_callback;
 }
 
+void AbstractTask::set_query_context(const std::shared_ptr<QueryContext>& query_context) {
+  DebugAssert(!is_scheduled(), "Possible race: Don't set the QueryContext after the Task was scheduled.");
+  _query_context = query_context;
+}
+
+const std::shared_ptr<QueryContext>& AbstractTask::query_context() const {
+  return _query_context;
+}
+
 void AbstractTask::schedule(NodeID preferred_node_id) {
   // We need to make sure that data written by the scheduling thread is visible in the thread executing the task. While
   // spawning a thread is an implicit barrier, we have no such guarantee when we simply add a task to a queue and it is
@@ -111,6 +131,25 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
     return;
   }
 
+  if (preferred_node_id == CURRENT_NODE_ID) {
+    preferred_node_id = _preferred_node_id;
+  }
+
+  if (!_query_context) {
+    auto* const current_query_context = QueryContext::current();
+    if (current_query_context) {
+      _query_context = current_query_context->shared_from_this();
+    }
+  }
+
+  if (_query_context) {
+    _query_context->register_scheduled_task();
+  }
+
+  if (Hyrise::get().task_tracer.is_enabled()) {
+    _scheduled_time = std::chrono::steady_clock::now();
+  }
+
   Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
 }
 
@@ -140,8 +179,21 @@ void AbstractTask::execute() {
   // _is_scheduled and this assert (potentially in "thread" B) reads it, it is guaranteed that no writes of whoever
   // spawned the task are pushed down to a point where this thread is already running.
 
-  _on_execute();
+  {
+    const auto execution_scope = QueryContext::ExecutionScope{_query_context.get()};
+    _on_execute();
+  }
 
+  if (_completes_on_execute()) {
+    _finish();
+  }
+}
+
+bool AbstractTask::_completes_on_execute() const {
+  return true;
+}
+
+void AbstractTask::_finish() {
   {
     const auto success_done = _try_transition_to(TaskState::Done);
     Assert(success_done, "Expected successful transition to TaskState::Done.");
@@ -165,6 +217,10 @@ TaskState AbstractTask::state() const {
   return _state;
 }
 
+std::chrono::steady_clock::time_point AbstractTask::scheduled_time() const {
+  return _scheduled_time;
+}
+
 void AbstractTask::_on_predecessor_done() {
   const auto previous_predecessor_count = _pending_predecessors--;
   Assert(previous_predecessor_count > 0, "Cannot decrement pending predecessors when no predecessors are left.");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -13,6 +14,7 @@
 
 namespace hyrise {
 
+class QueryContext;
 class Worker;
 
 /**
@@ -61,7 +63,8 @@ class Worker;
  *      immediately after task->schedule() has been called. Consequently, tasks never enter TaskState::Enqueued and
  *      TaskState::AssignedToWorker.
  *  4. A task switches to TaskState::Started when execute() is called.
- *  5. After finishing its work, execute() transitions the task to TaskState::Done.
+ *  5. After finishing its work, execute() transitions the task to TaskState::Done. CoroutineTasks and OperatorTasks
+ *     transition to TaskState::Done when their coroutine returns, which might be after execute() returned.
  *
  * Note that the state machine's _try_transition_to function ensures that tasks can be marked as scheduled / enqueued /
  * assigned once only, respectively.
@@ -88,6 +91,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // clear the successor pointers.
   friend class OperatorTaskTest;
 
+  // Finishes tasks whose coroutine returned (see _completes_on_execute()).
+  friend class TaskCoroutine;
+
  public:
   explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
   virtual ~AbstractTask() = default;
@@ -145,6 +151,21 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * Node the task should be executed on when it is scheduled without an explicit node, e.g., the node that holds the
+   * data of the chunk the task processes (see Chunk::node_id()). Schedulers fall back to CURRENT_NODE_ID if the node
+   * has no workers, which includes INVALID_NODE_ID.
+   */
+  void set_preferred_node_id(NodeID preferred_node_id);
+  NodeID preferred_node_id() const;
+
+  /**
+   * QueryContext the task is accounted to (see QueryContext). If the task has none when it is scheduled, it inherits
+   * the QueryContext of the task that is currently executed by this thread, i.e., the task that spawned it.
+   */
+  void set_query_context(const std::shared_ptr<QueryContext>& query_context);
+  const std::shared_ptr<QueryContext>& query_context() const;
+
   /**
    * Callback to be executed right after the task finished. Notice the execution of the callback might happen on ANY
    * thread.
@@ -179,9 +200,25 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskState state() const;
 
+  /**
+   * Point in time when the task was scheduled. Only recorded while task tracing is enabled (see TaskTracer).
+   */
+  std::chrono::steady_clock::time_point scheduled_time() const;
+
  protected:
   virtual void _on_execute() = 0;
 
+  /**
+   * Usually, a task is done when _on_execute() returns. Tasks that continue asynchronously (see CoroutineTask and
+   * OperatorTask) return false and are finished when their TaskCoroutine returns.
+   */
+  virtual bool _completes_on_execute() const;
+
+  /**
+   * Marks the task as done, notifies its successors, calls the done callback, and wakes up threads that join the task.
+   */
+  void _finish();
+
   /**
    * Transitions the task's state to @param new_state.
    * @returns true on success and false if another caller/thread/worker was faster in progressing this task's state.
@@ -202,9 +239,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id{INVALID_NODE_ID};
+  NodeID _preferred_node_id{CURRENT_NODE_ID};
   SchedulePriority _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
+  std::shared_ptr<QueryContext> _query_context;
+  std::chrono::steady_clock::time_point _scheduled_time{};
 
   // For dependencies.
   std::atomic_uint32_t _pending_predecessors{0};
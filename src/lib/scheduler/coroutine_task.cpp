@@ -0,0 +1,208 @@
+#include "coroutine_task.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
+#include "hyrise.hpp"
+#include "job_task.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Exception of the outermost coroutine that returned during the current TaskCoroutine::_resume() of this thread. The
+// coroutine's task is finished before the exception is rethrown by _resume().
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::exception_ptr finished_coroutine_exception;
+
+}  // namespace
+
+namespace hyrise {
+
+bool TaskCoroutine::promise_type::FinalAwaiter::await_ready() const noexcept {
+  return false;
+}
+
+std::coroutine_handle<> TaskCoroutine::promise_type::FinalAwaiter::await_suspend(
+    std::coroutine_handle<promise_type> handle) const noexcept {
+  auto& promise = handle.promise();
+  if (promise.continuation) {
+    return promise.continuation;
+  }
+
+  // The coroutine is suspended at its final suspension point, so the task (and with it, the coroutine) may be destroyed
+  // by whoever waits for the task. Whoever resumed the coroutine holds a reference to the task, so that it lives until
+  // _finish() returns. The task is finished even if the coroutine failed, so that its successors and waiters do not
+  // wait forever. The exception is passed on to _resume(), which rethrows it afterwards. Without a task, run() rethrows
+  // the exception.
+  if (promise.task) {
+    auto exception = std::move(promise.exception);
+    _finish_task(*promise.task);
+    finished_coroutine_exception = std::move(exception);
+  }
+  return std::noop_coroutine();
+}
+
+void TaskCoroutine::promise_type::FinalAwaiter::await_resume() const noexcept {}
+
+TaskCoroutine TaskCoroutine::promise_type::get_return_object() {
+  return TaskCoroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+std::suspend_always TaskCoroutine::promise_type::initial_suspend() const noexcept {
+  return {};
+}
+
+TaskCoroutine::promise_type::FinalAwaiter TaskCoroutine::promise_type::final_suspend() const noexcept {
+  return {};
+}
+
+void TaskCoroutine::promise_type::return_void() const {}
+
+void TaskCoroutine::promise_type::unhandled_exception() {
+  exception = std::current_exception();
+}
+
+TaskCoroutine::Awaiter::Awaiter(std::coroutine_handle<promise_type> handle) : _handle{handle} {}
+
+bool TaskCoroutine::Awaiter::await_ready() const noexcept {
+  return false;
+}
+
+std::coroutine_handle<> TaskCoroutine::Awaiter::await_suspend(
+    std::coroutine_handle<promise_type> awaiting_handle) const noexcept {
+  auto& promise = _handle.promise();
+  promise.task = awaiting_handle.promise().task;
+  promise.continuation = awaiting_handle;
+  return _handle;
+}
+
+void TaskCoroutine::Awaiter::await_resume() const {
+  if (_handle.promise().exception) {
+    std::rethrow_exception(_handle.promise().exception);
+  }
+}
+
+TaskCoroutine::TaskCoroutine(std::coroutine_handle<promise_type> handle) : _handle{handle} {}
+
+TaskCoroutine::TaskCoroutine(TaskCoroutine&& other) noexcept : _handle{std::exchange(other._handle, nullptr)} {}
+
+TaskCoroutine& TaskCoroutine::operator=(TaskCoroutine&& other) noexcept {
+  if (this != &other) {
+    if (_handle) {
+      _handle.destroy();
+    }
+    _handle = std::exchange(other._handle, nullptr);
+  }
+  return *this;
+}
+
+TaskCoroutine::~TaskCoroutine() {
+  if (_handle) {
+    _handle.destroy();
+  }
+}
+
+TaskCoroutine::Awaiter TaskCoroutine::operator co_await() && noexcept {
+  return Awaiter{_handle};
+}
+
+void TaskCoroutine::run(AbstractTask* task) {
+  DebugAssert(_handle && !_handle.done(), "Coroutine has already been run.");
+  _handle.promise().task = task;
+
+  if (!task) {
+    _handle.resume();
+    Assert(_handle.done(), "Coroutine suspended although it was run synchronously.");
+    if (_handle.promise().exception) {
+      std::rethrow_exception(_handle.promise().exception);
+    }
+    return;
+  }
+
+  _resume(_handle);
+}
+
+void TaskCoroutine::_resume(std::coroutine_handle<> handle) {
+  DebugAssert(!finished_coroutine_exception, "Exception of a finished coroutine was not rethrown.");
+  handle.resume();
+
+  if (finished_coroutine_exception) {
+    std::rethrow_exception(std::exchange(finished_coroutine_exception, nullptr));
+  }
+}
+
+void TaskCoroutine::_finish_task(AbstractTask& task) {
+  task._finish();
+}
+
+TasksAwaiter::TasksAwaiter(AbstractScheduler& scheduler, const std::vector<std::shared_ptr<AbstractTask>>& tasks)
+    : _scheduler{scheduler}, _tasks{tasks} {}
+
+bool TasksAwaiter::await_ready() {
+  if (_tasks.empty()) {
+    return true;
+  }
+
+  // Without workers, there is nobody to resume the coroutine. Execute the tasks right away instead.
+  if (!Hyrise::get().is_multi_threaded()) {
+    _scheduler.schedule_and_wait_for_tasks(_tasks);
+    return true;
+  }
+
+  return false;
+}
+
+bool TasksAwaiter::await_suspend(std::coroutine_handle<TaskCoroutine::promise_type> handle) {
+  auto* const awaiting_task = handle.promise().task;
+  if (!awaiting_task) {
+    // The coroutine is run synchronously (see TaskCoroutine::run()). Wait for the tasks without suspending.
+    _scheduler.schedule_and_wait_for_tasks(_tasks);
+    return false;
+  }
+
+  // The awaiter is part of the coroutine's frame, which might be resumed and destroyed by another worker as soon as the
+  // tasks are scheduled. Thus, we must not access members after that.
+  const auto tasks = std::move(_tasks);
+  _scheduler._group_tasks(tasks);
+
+  // The resume task keeps the task alive while the coroutine is executed.
+  const auto resume_task = std::make_shared<JobTask>([awaiting_task = awaiting_task->shared_from_this(), handle]() {
+    TaskCoroutine::_resume(handle);
+  });
+
+  for (const auto& task : tasks) {
+    DebugAssert(!task->is_scheduled(), "Awaited tasks must not be scheduled yet.");
+    task->set_as_predecessor_of(resume_task);
+  }
+
+  // Schedule the resume task first. Otherwise, the awaited tasks might be done before it is scheduled and nobody would
+  // execute it.
+  resume_task->schedule();
+  AbstractScheduler::schedule_tasks(tasks);
+  return true;
+}
+
+void TasksAwaiter::await_resume() const {}
+
+CoroutineTask::CoroutineTask(const std::function<TaskCoroutine()>& coroutine_function, SchedulePriority priority,
+                             bool stealable)
+    : AbstractTask{priority, stealable}, _coroutine_function{coroutine_function} {}
+
+void CoroutineTask::_on_execute() {
+  // Runs the coroutine until it awaits tasks for the first time or returns.
+  _coroutine.emplace(_coroutine_function());
+  _coroutine->run(this);
+}
+
+bool CoroutineTask::_completes_on_execute() const {
+  return false;
+}
+
+}  // namespace hyrise
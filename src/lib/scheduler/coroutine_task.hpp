@@ -0,0 +1,151 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractScheduler;
+
+/**
+ * Return type of the coroutines that are executed by tasks (see CoroutineTask and OperatorTask). The coroutine is
+ * started by run() and destroyed together with the TaskCoroutine.
+ *
+ * A coroutine can await another TaskCoroutine (e.g., co_await _on_execute_coroutine(...)). The awaited coroutine is
+ * executed on behalf of the same task and the awaiting coroutine continues once it returned. Exceptions of the awaited
+ * coroutine are rethrown in the awaiting one.
+ */
+class TaskCoroutine : private Noncopyable {
+ public:
+  struct promise_type {
+    // Continues the awaiting coroutine or, if there is none, marks the task as done once the coroutine finished.
+    struct FinalAwaiter {
+      bool await_ready() const noexcept;
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) const noexcept;
+      void await_resume() const noexcept;
+    };
+
+    TaskCoroutine get_return_object();
+    std::suspend_always initial_suspend() const noexcept;
+    FinalAwaiter final_suspend() const noexcept;
+    void return_void() const;
+
+    // Exceptions are stored and passed to the awaiting coroutine. Exceptions of the outermost coroutine are rethrown
+    // once its task is finished, to whoever resumed the coroutine (see run()). This way, exceptions are propagated just
+    // like exceptions of other tasks are propagated to whoever executes them.
+    void unhandled_exception();
+
+    // Task on whose behalf the coroutine is executed. nullptr if the coroutine is run synchronously.
+    AbstractTask* task{nullptr};
+
+    // Coroutine that awaits this coroutine and continues when it returns.
+    std::coroutine_handle<> continuation;
+
+    std::exception_ptr exception;
+  };
+
+  // Awaiter for co_await-ing a TaskCoroutine from another TaskCoroutine.
+  class Awaiter {
+   public:
+    explicit Awaiter(std::coroutine_handle<promise_type> handle);
+
+    bool await_ready() const noexcept;
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> awaiting_handle) const noexcept;
+    void await_resume() const;
+
+   private:
+    std::coroutine_handle<promise_type> _handle;
+  };
+
+  explicit TaskCoroutine(std::coroutine_handle<promise_type> handle);
+  TaskCoroutine(TaskCoroutine&& other) noexcept;
+  TaskCoroutine& operator=(TaskCoroutine&& other) noexcept;
+  ~TaskCoroutine();
+
+  Awaiter operator co_await() && noexcept;
+
+  /**
+   * Starts the coroutine on behalf of @param task, which is marked as done when the coroutine returns. Afterwards, the
+   * coroutine must not be accessed anymore, as another worker might already resume it. Without a task, the coroutine
+   * awaits tasks synchronously (see TasksAwaiter) and has returned once run() returns. If the coroutine throws, the
+   * exception is rethrown by run() or, if the coroutine was suspended, by the JobTask that resumed it. The task is
+   * finished before.
+   */
+  void run(AbstractTask* task = nullptr);
+
+ private:
+  friend class TasksAwaiter;
+
+  static void _finish_task(AbstractTask& task);
+
+  // Resumes a coroutine that is executed on behalf of a task and rethrows the exception of the outermost coroutine if
+  // it returned.
+  static void _resume(std::coroutine_handle<> handle);
+
+  std::coroutine_handle<promise_type> _handle;
+};
+
+/**
+ * Awaitable returned by AbstractScheduler::schedule_and_await_tasks(). Awaiting it schedules the given tasks and
+ * suspends the awaiting coroutine until all of them are done. The coroutine is then resumed by a JobTask that succeeds
+ * the awaited tasks. Usually, this task is executed by the worker that finished the last awaited task.
+ *
+ * With the ImmediateExecutionScheduler or if the coroutine is run synchronously (see TaskCoroutine::run()), the tasks
+ * are executed right away (or waited for) and the coroutine does not suspend.
+ */
+class TasksAwaiter {
+ public:
+  TasksAwaiter(AbstractScheduler& scheduler, const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  bool await_ready();
+  bool await_suspend(std::coroutine_handle<TaskCoroutine::promise_type> handle);
+  void await_resume() const;
+
+ private:
+  AbstractScheduler& _scheduler;
+  std::vector<std::shared_ptr<AbstractTask>> _tasks;
+};
+
+/**
+ * A task that executes a coroutine. In contrast to tasks that wait for their subtasks using
+ * AbstractScheduler::schedule_and_wait_for_tasks(), a CoroutineTask that awaits its subtasks (co_await
+ * AbstractScheduler::schedule_and_await_tasks(...)) does not occupy its worker while waiting. The worker neither
+ * blocks nor recursively executes unrelated tasks (see Worker::_wait_for_tasks()), but returns to its regular work.
+ * Once the subtasks are done, the coroutine continues on the worker that finished the last of them.
+ *
+ * The CoroutineTask is done when its coroutine returns, not when the first part of the coroutine has been executed.
+ *
+ * Usage example:
+ *
+ *   const auto task = std::make_shared<CoroutineTask>([&]() -> TaskCoroutine {
+ *     auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+ *     jobs.emplace_back(std::make_shared<JobTask>([&]() { ... }));
+ *     co_await Hyrise::get().scheduler()->schedule_and_await_tasks(jobs);
+ *     ...
+ *   });
+ *
+ * The coroutine function (including the captures of a lambda) is kept alive by the CoroutineTask, so that the
+ * coroutine can access it while it is suspended.
+ */
+class CoroutineTask : public AbstractTask {
+ public:
+  explicit CoroutineTask(const std::function<TaskCoroutine()>& coroutine_function,
+                         SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
+
+ protected:
+  void _on_execute() override;
+  bool _completes_on_execute() const override;
+
+ private:
+  std::function<TaskCoroutine()> _coroutine_function;
+  std::optional<TaskCoroutine> _coroutine;
+};
+
+}  // namespace hyrise
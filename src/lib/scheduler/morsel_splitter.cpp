@@ -0,0 +1,89 @@
+#include "morsel_splitter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+MorselSplitter::MorselSplitter(const float row_cost) {
+  Assert(row_cost > 0.0f, "Row cost must be positive.");
+
+  auto& hyrise = Hyrise::get();
+  _multi_threaded = hyrise.is_multi_threaded();
+  if (!_multi_threaded) {
+    return;
+  }
+
+  // Estimate the number of tasks that are waiting to be executed. Both the queues' and the deques' sizes are only
+  // approximations, which is sufficient here.
+  auto queued_task_count = size_t{0};
+  for (const auto& queue : hyrise.scheduler()->queues()) {
+    if (!queue) {
+      continue;
+    }
+
+    queued_task_count += queue->estimate_load();
+    for (const auto& deque : queue->worker_deques()) {
+      queued_task_count += deque->size_approx();
+    }
+  }
+
+  _worker_count = std::max(size_t{1}, static_cast<size_t>(hyrise.topology.num_cpus()));
+  const auto load_factor = std::min(MAX_LOAD_FACTOR, 1 + queued_task_count / _worker_count);
+  const auto min_row_count = static_cast<size_t>(std::ceil(static_cast<float>(BASE_MIN_MORSEL_ROW_COUNT) / row_cost));
+  _min_morsel_row_count = std::max(size_t{1}, min_row_count) * load_factor;
+}
+
+size_t MorselSplitter::min_morsel_row_count() const {
+  return _min_morsel_row_count;
+}
+
+bool MorselSplitter::should_spawn_job(const size_t row_count) const {
+  return _multi_threaded && row_count >= _min_morsel_row_count;
+}
+
+std::vector<MorselSplitter::ChunkRange> MorselSplitter::split_chunks(const Table& table) const {
+  const auto chunk_count = table.chunk_count();
+  if (!_multi_threaded || chunk_count < 2) {
+    return {ChunkRange{ChunkID{0}, chunk_count}};
+  }
+
+  const auto target_row_count =
+      std::max(_min_morsel_row_count, table.row_count() / (_worker_count * MORSELS_PER_WORKER));
+
+  auto chunk_ranges = std::vector<ChunkRange>{};
+  auto begin_chunk_id = ChunkID{0};
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    row_count += chunk ? chunk->size() : 0;
+    if (row_count >= target_row_count) {
+      chunk_ranges.emplace_back(ChunkRange{begin_chunk_id, ChunkID{chunk_id + 1}});
+      begin_chunk_id = ChunkID{chunk_id + 1};
+      row_count = 0;
+    }
+  }
+
+  if (begin_chunk_id < chunk_count) {
+    // Append the remaining chunks to the last range if they are not worth a task of their own.
+    if (!chunk_ranges.empty() && row_count < _min_morsel_row_count) {
+      chunk_ranges.back().end_chunk_id = chunk_count;
+    } else {
+      chunk_ranges.emplace_back(ChunkRange{begin_chunk_id, chunk_count});
+    }
+  }
+
+  return chunk_ranges;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Decides how operators split their work into tasks (i.e., morsels). Spawning a task for a small amount of work costs
+ * more than it saves, while too few tasks leave workers idle. Operators create a MorselSplitter once per parallelized
+ * step and pass the estimated cost of processing a row relative to a simple table scan. The MorselSplitter then
+ * decides whether a unit of work (e.g., a chunk or a radix partition) is worth a task of its own (see
+ * should_spawn_job()) or how consecutive chunks are bundled into tasks (see split_chunks()).
+ *
+ * The minimum morsel size adapts to the load of the scheduler: while the TaskQueues and the workers' deques already
+ * hold more tasks than there are workers, additional tasks do not add parallelism but only overhead. Thus, the minimum
+ * morsel size grows with the number of queued tasks per worker (up to MAX_LOAD_FACTOR). Without multi-threading (i.e.,
+ * with the ImmediateExecutionScheduler), no tasks are spawned at all.
+ */
+class MorselSplitter {
+ public:
+  // Minimum number of rows of a task with a row cost of 1.0 when the scheduler is idle.
+  static constexpr auto BASE_MIN_MORSEL_ROW_COUNT = size_t{500};
+
+  // Maximum factor by which the minimum morsel size grows under load.
+  static constexpr auto MAX_LOAD_FACTOR = size_t{16};
+
+  // Number of tasks per worker that split_chunks() aims for, so that workers finishing early can steal the remaining
+  // work.
+  static constexpr auto MORSELS_PER_WORKER = size_t{4};
+
+  // Range of consecutive chunks [begin_chunk_id, end_chunk_id).
+  struct ChunkRange {
+    ChunkID begin_chunk_id;
+    ChunkID end_chunk_id;
+  };
+
+  explicit MorselSplitter(const float row_cost = 1.0f);
+
+  size_t min_morsel_row_count() const;
+
+  // Returns true if processing the given number of rows is worth a task of its own.
+  bool should_spawn_job(const size_t row_count) const;
+
+  // Bundles the table's chunks into ranges of at least min_morsel_row_count() rows. Within that bound, the ranges are
+  // sized so that every worker gets MORSELS_PER_WORKER of them. A single range is returned if the table is too small to
+  // be split. Physically deleted chunks are counted with zero rows.
+  std::vector<ChunkRange> split_chunks(const Table& table) const;
+
+ private:
+  bool _multi_threaded{false};
+  size_t _worker_count{1};
+  size_t _min_morsel_row_count{BASE_MIN_MORSEL_ROW_COUNT};
+};
+
+}  // namespace hyrise
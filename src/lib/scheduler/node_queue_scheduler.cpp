@@ -10,12 +10,14 @@
 #include <optional>
 #include <sstream>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "shutdown_task.hpp"
 #include "task_queue.hpp"
+#include "task_tracer.hpp"
 #include "types.hpp"
 #include "uid_allocator.hpp"
 #include "utils/assert.hpp"
@@ -68,6 +70,9 @@ void NodeQueueScheduler::begin() {
   Assert(!_active_nodes.empty(), "None of the system nodes has active workers.");
   _active = true;
 
+  _task_tracing_setting = std::make_shared<TaskTracingSetting>();
+  _task_tracing_setting->register_at_settings_manager();
+
   for (auto& worker : _workers) {
     worker->start();
     ++_active_worker_count;
@@ -132,7 +137,7 @@ void NodeQueueScheduler::wait_for_all_tasks() {
     }
 
     auto queue_check_runs = size_t{0};
-    while (!queue->empty()) {
+    while (!queue->empty() || !queue->worker_deques_empty()) {
       // The following assert checks that we are not looping forever. The empty() check can be inaccurate for
       // concurrent queues when many tiny tasks have been scheduled (see MergeSort scheduler test). When this assert is
       // triggered in other situations, there have probably been new tasks added after wait_for_all_tasks() was called.
@@ -177,6 +182,9 @@ void NodeQueueScheduler::finish() {
     worker->join();
   }
 
+  _task_tracing_setting->unregister_at_settings_manager();
+  _task_tracing_setting = nullptr;
+
   _task_counter = 0;
   _workers = {};
   _queues = {};
@@ -211,6 +219,25 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
     return;
   }
 
+  // Tasks might prefer nodes without workers, e.g., when the chunk they process was not placed on a node
+  // (INVALID_NODE_ID) or was placed on a node that has no workers in the current topology. Such tasks, as well as all
+  // tasks when there is only a single node, are scheduled as if no node was preferred.
+  if (preferred_node_id != CURRENT_NODE_ID &&
+      (_active_nodes.size() == 1 || preferred_node_id >= _queues.size() || !_queues[preferred_node_id])) {
+    preferred_node_id = CURRENT_NODE_ID;
+  }
+
+  // Tasks spawned by workers (e.g., JobTasks of operators) are pushed to the worker's own deque if they do not prefer
+  // another node. Idle workers steal them from there. Tasks for other nodes, prioritized tasks, and non-stealable tasks
+  // are added to the node's queue.
+  if (priority == SchedulePriority::Default && task->is_stealable()) {
+    const auto& worker = Worker::get_this_thread_worker();
+    if (worker && (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker->queue()->node_id())) {
+      worker->push_local_task(task);
+      return;
+    }
+  }
+
   const auto node_id_for_queue = determine_queue_id(preferred_node_id);
   DebugAssert((static_cast<size_t>(node_id_for_queue) < _queues.size()),
               "Node ID is not within range of available nodes.");
@@ -249,7 +276,7 @@ NodeID NodeQueueScheduler::determine_queue_id(const NodeID preferred_node_id) co
     const auto node_id = _active_nodes[node_id_offset];
     const auto queue_load = _queues[node_id]->estimate_load();
     if (queue_load < min_load) {
-      min_load_node_id = _active_nodes[node_id];
+      min_load_node_id = node_id;
       min_load = queue_load;
     }
   }
@@ -264,33 +291,34 @@ void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<Abstract
   //
   // Approach: Skip all tasks that already have predecessors or successors, as adding relationships to these could
   // introduce cyclic dependencies. Again, this is far from perfect, but better than not grouping the tasks.
+  //
+  // As the tasks of a group are likely executed on the same worker (see Worker::execute_next), tasks are only grouped
+  // with tasks that prefer the same node (e.g., because they process chunks placed on that node). Each node gets its
+  // own NUM_GROUPS groups.
 
-  auto round_robin_counter = 0;
-  auto common_node_id = std::optional<NodeID>{};
-
-  auto grouped_tasks = std::vector<std::shared_ptr<AbstractTask>>(NUM_GROUPS);
+  auto round_robin_counters = std::unordered_map<NodeID, size_t>{};
+  auto grouped_tasks = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
   for (const auto& task : tasks) {
     if (!task->predecessors().empty() || !task->successors().empty() || dynamic_cast<ShutdownTask*>(&*task)) {
       // Do not group tasks that either have precessors/successors or are ShutdownTasks.
       return;
     }
+  }
 
-    if (common_node_id) {
-      // This is not really a hard assertion. As the chain will likely be executed on the same worker (see
-      // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-      // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-      // node ids.
-      DebugAssert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id.");
-    } else {
-      common_node_id = task->node_id();
+  for (const auto& task : tasks) {
+    const auto node_id = task->preferred_node_id();
+    auto& node_grouped_tasks = grouped_tasks[node_id];
+    if (node_grouped_tasks.empty()) {
+      node_grouped_tasks.resize(NUM_GROUPS);
     }
 
+    auto& round_robin_counter = round_robin_counters[node_id];
     const auto group_id = round_robin_counter % NUM_GROUPS;
-    const auto& first_task_in_group = grouped_tasks[group_id];
+    const auto& first_task_in_group = node_grouped_tasks[group_id];
     if (first_task_in_group) {
       task->set_as_predecessor_of(first_task_in_group);
     }
-    grouped_tasks[group_id] = task;
+    node_grouped_tasks[group_id] = task;
     ++round_robin_counter;
   }
 }
@@ -26,13 +26,26 @@ namespace hyrise {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore idle
- * CPU threads) while there are still tasks in the system that need to be processed. A worker gets idle when its local
- * TaskQueue is empty. In this case, the worker is checking non-local TaskQueues of other NUMA nodes for tasks. The
- * worker pulls a task from a remote TaskQueue and checks if this task is stealable. If not, the task is pushed to the
- * TaskQueue again.
- * In case no tasks can be processed, the worker thread is put to sleep and waits on the semaphore of its node-local
- * TaskQueue.
+ * Tasks that are scheduled by workers (e.g., the JobTasks that operators spawn) are pushed to the worker's own
+ * WorkStealingDeque instead of the node's TaskQueue. The worker executes them in LIFO order, without contending with
+ * other workers. Tasks scheduled by other threads, tasks with a specific node or priority, and non-stealable tasks are
+ * added to the node's TaskQueue.
+ * Work stealing is useful to avoid idle workers (and therefore idle CPU threads) while there are still tasks in the
+ * system that need to be processed. A worker gets idle when its deque and its local TaskQueue are empty. In this case,
+ * it steals tasks from the deques of randomly selected workers of the same node first. Then, it checks the TaskQueues
+ * and worker deques of the other NUMA nodes. A task pulled from a remote TaskQueue that is not stealable is pushed to
+ * the TaskQueue again.
+ * In case no tasks can be processed, the worker registers as idle at its node-local TaskQueue and goes to sleep. When a
+ * task is added to the TaskQueue or to the deque of a worker, a single idle worker of the node is woken up (or of
+ * another node if the task was added to a deque and all workers of the node are busy).
+ *
+ *
+ * NUMA PLACEMENT
+ *
+ * Tasks can prefer a node (see AbstractTask::set_preferred_node_id()). Operators let their per-chunk JobTasks prefer
+ * the node that holds the chunk's data, which is set when tables are partitioned across the nodes (see
+ * numa_placement.hpp). Such tasks are added to the preferred node's TaskQueue unless they are scheduled by a worker of
+ * that node, which pushes them to its deque. Tasks of the same node are grouped together (see _group_tasks()).
  *
  * Note: currently, TaskQueues are not explicitly allocated on a NUMA node. This means most workers will frequently
  * access distant TaskQueues, which is ~1.6 times slower than accessing a local node [1]. 
@@ -43,6 +56,7 @@ namespace hyrise {
 
 class Worker;
 class TaskQueue;
+class TaskTracingSetting;
 class UidAllocator;
 
 /**
@@ -54,7 +68,8 @@ class NodeQueueScheduler : public AbstractScheduler {
   ~NodeQueueScheduler() override;
 
   /**
-   * Create a TaskQueue on every node and a worker for every core.
+   * Create a TaskQueue on every node and a worker for every core. While the scheduler is active, task tracing can be
+   * enabled using the "Scheduler.task_tracing" setting (see TaskTracer).
    */
   void begin() override;
 
@@ -99,6 +114,7 @@ class NodeQueueScheduler : public AbstractScheduler {
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::vector<NodeID> _active_nodes;
+  std::shared_ptr<TaskTracingSetting> _task_tracing_setting;
 
   std::atomic_bool _active{false};
   std::atomic_int64_t _active_worker_count{0};
@@ -11,6 +11,7 @@
 #include "operators/abstract_read_write_operator.hpp"
 #include "operators/get_table.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 #include "scheduler/task_utils.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -161,6 +162,15 @@ void OperatorTask::skip_operator_task() {
 }
 
 void OperatorTask::_on_execute() {
+  _coroutine.emplace(_execute_operator());
+  _coroutine->run(this);
+}
+
+bool OperatorTask::_completes_on_execute() const {
+  return false;
+}
+
+TaskCoroutine OperatorTask::_execute_operator() {
   auto context = _op->transaction_context();
   if (context) {
     switch (context->phase()) {
@@ -175,7 +185,7 @@ void OperatorTask::_on_execute() {
           // Essentially a noop, because no modifications are recorded yet. Better be on the safe side though.
           read_write_operator->rollback_records();
         }
-        return;
+        co_return;
       case TransactionPhase::Committing:
       case TransactionPhase::Committed:
         Fail("Trying to execute an operator for a transaction that is already committed.");
@@ -185,7 +195,7 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  _op->execute();
+  co_await _op->execute_coroutine();
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -1,18 +1,22 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/coroutine_task.hpp"
 
 namespace hyrise {
 
 class AbstractOperator;
 
 /**
- * Makes an AbstractOperator scheduleable
+ * Makes an AbstractOperator scheduleable. The operator is executed as a coroutine (see
+ * AbstractOperator::execute_coroutine()). Operators that await their jobs suspend the coroutine instead of blocking the
+ * worker, and the task is done once the operator finished.
  */
 class OperatorTask : public AbstractTask {
  public:
@@ -46,8 +50,12 @@ class OperatorTask : public AbstractTask {
 
  protected:
   void _on_execute() override;
+  bool _completes_on_execute() const override;
 
  private:
+  TaskCoroutine _execute_operator();
+
   std::shared_ptr<AbstractOperator> _op;
+  std::optional<TaskCoroutine> _coroutine;
 };
 }  // namespace hyrise
@@ -0,0 +1,220 @@
+#include "query_context.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "abstract_task.hpp"
+#include "hyrise.hpp"
+#include "task_queue.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// The QueryContext of the task that is currently executed by this thread and the time spent in tasks that were executed
+// while it was waiting for other tasks. See QueryContext::ExecutionScope.
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local QueryContext* current_query_context = nullptr;
+thread_local std::chrono::nanoseconds nested_execution_duration{0};
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+std::atomic_uint64_t next_query_id{0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace
+
+namespace hyrise {
+
+QueryContext::QueryContext(const std::string& description, const QuerySchedulingOptions& options,
+                           const size_t estimated_memory_usage)
+    : _id{next_query_id++},
+      _description{description},
+      _options{options},
+      _estimated_memory_usage{estimated_memory_usage},
+      _start_time{std::chrono::steady_clock::now()} {
+  Assert(options.weight > 0, "Weight of a query must be positive.");
+}
+
+QueryContext* QueryContext::current() {
+  return current_query_context;
+}
+
+uint64_t QueryContext::id() const {
+  return _id;
+}
+
+const std::string& QueryContext::description() const {
+  return _description;
+}
+
+const QuerySchedulingOptions& QueryContext::options() const {
+  return _options;
+}
+
+size_t QueryContext::estimated_memory_usage() const {
+  return _estimated_memory_usage;
+}
+
+std::chrono::steady_clock::time_point QueryContext::start_time() const {
+  return _start_time;
+}
+
+size_t QueryContext::scheduled_task_count() const {
+  return _scheduled_task_count.load(std::memory_order_relaxed);
+}
+
+size_t QueryContext::finished_task_count() const {
+  return _finished_task_count.load(std::memory_order_relaxed);
+}
+
+size_t QueryContext::running_task_count() const {
+  return _running_task_count.load(std::memory_order_relaxed);
+}
+
+size_t QueryContext::deferred_task_count() const {
+  return _deferred_task_count.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds QueryContext::execution_duration() const {
+  return std::chrono::nanoseconds{_execution_duration.load(std::memory_order_relaxed)};
+}
+
+void QueryContext::register_scheduled_task() {
+  _scheduled_task_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool QueryContext::try_acquire_worker(const std::shared_ptr<AbstractTask>& task) {
+  if (_try_increment_occupied_workers(_limit())) {
+    return true;
+  }
+
+  // Check again while holding the mutex. Otherwise, the last worker of the query might release its slot after our
+  // check but before we defer the task, and nobody would resume it.
+  const auto lock = std::lock_guard<std::mutex>{_deferred_tasks_mutex};
+  if (_try_increment_occupied_workers(_limit())) {
+    return true;
+  }
+
+  _deferred_tasks.emplace_back(task);
+  _deferred_task_count.fetch_add(1, std::memory_order_relaxed);
+  Hyrise::get().workload_manager._deferred_task_count.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void QueryContext::release_worker() {
+  // Sequentially consistent, so that either a concurrent try_acquire_worker() sees the free slot or we see its deferred
+  // task.
+  _occupied_worker_count.fetch_sub(1, std::memory_order_seq_cst);
+  if (_deferred_task_count.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+
+  auto task = std::shared_ptr<AbstractTask>{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_deferred_tasks_mutex};
+    if (_deferred_tasks.empty()) {
+      return;
+    }
+
+    task = std::move(_deferred_tasks.front());
+    _deferred_tasks.pop_front();
+    _deferred_task_count.fetch_sub(1, std::memory_order_relaxed);
+    Hyrise::get().workload_manager._deferred_task_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Hand the task back to the queue of the node it was enqueued at. Whichever worker pulls it acquires a slot again.
+  const auto& queues = Hyrise::get().scheduler()->queues();
+  const auto node_id = task->node_id();
+  if (node_id < queues.size() && queues[node_id]) {
+    queues[node_id]->resume(task);
+    return;
+  }
+
+  const auto worker = Worker::get_this_thread_worker();
+  Assert(worker, "Deferred tasks can only be resumed by workers.");
+  worker->queue()->resume(task);
+}
+
+std::shared_ptr<AbstractTask> QueryContext::take_deferred_task() {
+  if (_deferred_task_count.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+
+  const auto hard_limit =
+      _options.max_parallelism > 0 ? _options.max_parallelism : std::numeric_limits<uint32_t>::max();
+  const auto lock = std::lock_guard<std::mutex>{_deferred_tasks_mutex};
+  if (_deferred_tasks.empty() || !_try_increment_occupied_workers(hard_limit)) {
+    return nullptr;
+  }
+
+  auto task = std::move(_deferred_tasks.front());
+  _deferred_tasks.pop_front();
+  _deferred_task_count.fetch_sub(1, std::memory_order_relaxed);
+  Hyrise::get().workload_manager._deferred_task_count.fetch_sub(1, std::memory_order_relaxed);
+  return task;
+}
+
+void QueryContext::_clear_deferred_tasks() {
+  const auto lock = std::lock_guard<std::mutex>{_deferred_tasks_mutex};
+  const auto deferred_task_count = static_cast<int64_t>(_deferred_tasks.size());
+  _deferred_tasks.clear();
+  _deferred_task_count.store(0, std::memory_order_relaxed);
+  Hyrise::get().workload_manager._deferred_task_count.fetch_sub(deferred_task_count, std::memory_order_relaxed);
+}
+
+bool QueryContext::_try_increment_occupied_workers(const uint32_t limit) {
+  auto occupied_worker_count = _occupied_worker_count.load(std::memory_order_seq_cst);
+  while (occupied_worker_count < limit) {
+    if (_occupied_worker_count.compare_exchange_weak(occupied_worker_count, occupied_worker_count + 1,
+                                                     std::memory_order_seq_cst)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t QueryContext::_limit() const {
+  const auto fair_share = Hyrise::get().workload_manager.fair_share(_options.weight);
+  return _options.max_parallelism > 0 ? std::min(_options.max_parallelism, fair_share) : fair_share;
+}
+
+QueryContext::ExecutionScope::ExecutionScope(QueryContext* query_context)
+    : _query_context{query_context},
+      _previous_query_context{current_query_context},
+      _previous_nested_duration{nested_execution_duration} {
+  if (!_query_context) {
+    return;
+  }
+
+  current_query_context = _query_context;
+  nested_execution_duration = std::chrono::nanoseconds{0};
+  _query_context->_running_task_count.fetch_add(1, std::memory_order_relaxed);
+  _start = std::chrono::steady_clock::now();
+}
+
+QueryContext::ExecutionScope::~ExecutionScope() {
+  if (!_query_context) {
+    return;
+  }
+
+  const auto duration = std::chrono::steady_clock::now() - _start;
+  const auto exclusive_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(duration) -
+                                  nested_execution_duration;
+  _query_context->_execution_duration.fetch_add(exclusive_duration.count(), std::memory_order_relaxed);
+  _query_context->_running_task_count.fetch_sub(1, std::memory_order_relaxed);
+  _query_context->_finished_task_count.fetch_add(1, std::memory_order_relaxed);
+
+  current_query_context = _previous_query_context;
+  nested_execution_duration = _previous_nested_duration + duration;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+// Options for scheduling the tasks of a query (see QueryContext).
+struct QuerySchedulingOptions {
+  // Share of the workers relative to the weights of the other running queries.
+  uint32_t weight{1};
+
+  // Maximum number of workers that concurrently execute tasks of the query. 0 means unlimited.
+  uint32_t max_parallelism{0};
+};
+
+/**
+ * Scheduling state of a query (or of any other group of tasks, e.g., all queries of a session) that is registered at
+ * the WorkloadManager. Tasks are assigned to a QueryContext either explicitly (see AbstractTask::set_query_context(),
+ * as done by the SQLPipelineStatement for its OperatorTasks) or implicitly when they are scheduled while a task of the
+ * query is executed (e.g., the JobTasks spawned by operators).
+ *
+ * The QueryContext accounts for the query's tasks and their execution time. Furthermore, it limits the number of
+ * workers that execute tasks of the query at the same time:
+ *   - The hard limit is the query's max_parallelism.
+ *   - The soft limit is the query's fair share of the workers, i.e., the number of workers weighted by the query's
+ *     weight relative to the weights of all running queries (see WorkloadManager::fair_share()).
+ * When a worker takes a task of a query that reached its limit, the task is deferred: the worker keeps the task in the
+ * QueryContext and picks another one. A deferred task is handed back to the TaskQueues once a worker finishes a task of
+ * the query. Workers that would go to sleep otherwise take deferred tasks of queries that did not reach their hard
+ * limit (see WorkloadManager::take_deferred_task()), so that the soft limit does not leave workers idle.
+ *
+ * Tasks that a worker executes while waiting for its own tasks (see Worker::_wait_for_tasks()) are not limited, as the
+ * waiting task holds the worker anyway. This also guarantees progress when the waiting task occupies the query's last
+ * slot.
+ */
+class QueryContext : public std::enable_shared_from_this<QueryContext>, private Noncopyable {
+ public:
+  QueryContext(const std::string& description, const QuerySchedulingOptions& options,
+               const size_t estimated_memory_usage);
+
+  // Returns the QueryContext of the task that is currently executed by this thread (or nullptr).
+  static QueryContext* current();
+
+  uint64_t id() const;
+  const std::string& description() const;
+  const QuerySchedulingOptions& options() const;
+  size_t estimated_memory_usage() const;
+  std::chrono::steady_clock::time_point start_time() const;
+
+  /**
+   * Task accounting. The execution duration of a task excludes the tasks it executes while waiting for others, so that
+   * the durations of all tasks of a query add up to the CPU time spent on the query.
+   * @{
+   */
+  size_t scheduled_task_count() const;
+  size_t finished_task_count() const;
+  size_t running_task_count() const;
+  size_t deferred_task_count() const;
+  std::chrono::nanoseconds execution_duration() const;
+
+  void register_scheduled_task();
+  /** @} */
+
+  /**
+   * Called by workers before executing a task of the query. Returns false and keeps the task if the query reached its
+   * limit. Otherwise, the worker executes the task and has to call release_worker() afterwards.
+   */
+  bool try_acquire_worker(const std::shared_ptr<AbstractTask>& task);
+  void release_worker();
+
+  // Takes a deferred task and acquires a worker for it if the query did not reach its hard limit (i.e., ignoring the
+  // fair share).
+  std::shared_ptr<AbstractTask> take_deferred_task();
+
+  // Sets the QueryContext of the current thread while a task is executed and accounts for the task's execution.
+  class ExecutionScope : private Noncopyable {
+   public:
+    explicit ExecutionScope(QueryContext* query_context);
+    ~ExecutionScope();
+
+    ExecutionScope(ExecutionScope&&) = delete;
+    ExecutionScope& operator=(ExecutionScope&&) = delete;
+
+   private:
+    QueryContext* _query_context;
+    QueryContext* _previous_query_context;
+    std::chrono::nanoseconds _previous_nested_duration;
+    std::chrono::steady_clock::time_point _start{};
+  };
+
+ private:
+  friend class WorkloadManager;
+
+  // Drops the deferred tasks when the query ends. See WorkloadManager::end_query().
+  void _clear_deferred_tasks();
+
+  bool _try_increment_occupied_workers(const uint32_t limit);
+  uint32_t _limit() const;
+
+  const uint64_t _id;
+  const std::string _description;
+  const QuerySchedulingOptions _options;
+  const size_t _estimated_memory_usage;
+  const std::chrono::steady_clock::time_point _start_time;
+
+  std::atomic_size_t _scheduled_task_count{0};
+  std::atomic_size_t _finished_task_count{0};
+  std::atomic_size_t _running_task_count{0};
+  std::atomic<std::chrono::nanoseconds::rep> _execution_duration{0};
+
+  std::atomic_uint32_t _occupied_worker_count{0};
+
+  std::atomic_size_t _deferred_task_count{0};
+  std::mutex _deferred_tasks_mutex;
+  std::deque<std::shared_ptr<AbstractTask>> _deferred_tasks;
+};
+
+}  // namespace hyrise
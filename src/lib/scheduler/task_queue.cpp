@@ -1,12 +1,17 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "abstract_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace hyrise {
 
@@ -37,6 +42,14 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, const SchedulePr
   task->set_node_id(_node_id);
   _queues[priority_uint].push(task);
   semaphore.signal();
+  wake_idle_worker();
+}
+
+void TaskQueue::resume(const std::shared_ptr<AbstractTask>& task) {
+  task->set_node_id(_node_id);
+  _queues[static_cast<uint32_t>(SchedulePriority::High)].push(task);
+  semaphore.signal();
+  wake_idle_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -62,6 +75,7 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
 
       queue.push(task);
       semaphore.signal();
+      wake_idle_worker();
     }
   }
 
@@ -83,8 +97,82 @@ size_t TaskQueue::estimate_load() const {
   return estimated_load;
 }
 
+size_t TaskQueue::task_count(const SchedulePriority priority) const {
+  const auto priority_uint = static_cast<uint32_t>(priority);
+  DebugAssert(priority_uint < NUM_PRIORITY_LEVELS, "Illegal priority level.");
+  return _queues[priority_uint].unsafe_size();
+}
+
 void TaskQueue::signal(const int32_t count) {
   semaphore.signal(count);
+  for (auto worker_index = int32_t{0}; worker_index < count; ++worker_index) {
+    if (!wake_idle_worker()) {
+      break;
+    }
+  }
+}
+
+void TaskQueue::add_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque) {
+  _worker_deques.emplace_back(deque);
+}
+
+const std::vector<std::shared_ptr<WorkStealingDeque>>& TaskQueue::worker_deques() const {
+  return _worker_deques;
+}
+
+bool TaskQueue::worker_deques_empty() const {
+  return std::all_of(_worker_deques.cbegin(), _worker_deques.cend(), [](const auto& deque) {
+    return deque->empty();
+  });
+}
+
+void TaskQueue::add_idle_worker(moodycamel::LightweightSemaphore& wake_up_semaphore) {
+  const auto lock = std::lock_guard<std::mutex>{_idle_workers_mutex};
+  _idle_workers.emplace_back(&wake_up_semaphore);
+  // Sequentially consistent, so that either the worker sees the new task when checking the queues for the last time,
+  // or wake_idle_worker() sees the idle worker (see below).
+  _idle_worker_count.fetch_add(1, std::memory_order_seq_cst);
+}
+
+bool TaskQueue::remove_idle_worker(moodycamel::LightweightSemaphore& wake_up_semaphore) {
+  const auto lock = std::lock_guard<std::mutex>{_idle_workers_mutex};
+  const auto iter = std::find(_idle_workers.begin(), _idle_workers.end(), &wake_up_semaphore);
+  if (iter == _idle_workers.end()) {
+    return false;
+  }
+
+  _idle_workers.erase(iter);
+  _idle_worker_count.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+bool TaskQueue::wake_idle_worker() {
+  // The caller has just added a task. Order this write with the read of the idle worker count (the counterpart of the
+  // fetch_add in add_idle_worker()). In the common case that all workers are busy, we do not acquire the mutex.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_idle_worker_count.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+
+  auto* wake_up_semaphore = static_cast<moodycamel::LightweightSemaphore*>(nullptr);
+  {
+    const auto lock = std::lock_guard<std::mutex>{_idle_workers_mutex};
+    if (_idle_workers.empty()) {
+      return false;
+    }
+
+    // Wake up the worker that went to sleep last, as its caches are most likely still warm.
+    wake_up_semaphore = _idle_workers.back();
+    _idle_workers.pop_back();
+    _idle_worker_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  wake_up_semaphore->signal();
+  return true;
+}
+
+uint32_t TaskQueue::idle_worker_count() const {
+  return _idle_worker_count.load(std::memory_order_relaxed);
 }
 
 }  // namespace hyrise
@@ -6,6 +6,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include <oneapi/tbb/concurrent_queue.h>  // NOLINT(build/include_order): cpplint identifies TBB as C system headers.
 
@@ -21,9 +23,12 @@ class LightweightSemaphore;
 namespace hyrise {
 
 class AbstractTask;
+class WorkStealingDeque;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Besides the node-wide queue, it knows the
+ * WorkStealingDeques of the node's workers and the workers that are currently sleeping, so that workers can be woken up
+ * one at a time when new tasks arrive.
  */
 class TaskQueue {
  public:
@@ -39,6 +44,12 @@ class TaskQueue {
 
   void push(const std::shared_ptr<AbstractTask>& task, const SchedulePriority priority);
 
+  /**
+   * Re-adds a task that has already been enqueued before but was deferred by its QueryContext (see
+   * QueryContext::release_worker()). Resumed tasks are queued with high priority, as they have been waiting already.
+   */
+  void resume(const std::shared_ptr<AbstractTask>& task);
+
   /**
    * Returns a Tasks that is ready to be executed and removes it from the queue
    */
@@ -57,10 +68,33 @@ class TaskQueue {
    */
   size_t estimate_load() const;
 
+  /**
+   * Number of tasks in the queue of the given priority. Like estimate_load(), the result is only an estimation.
+   */
+  size_t task_count(const SchedulePriority priority) const;
+
   void signal(const int32_t count);
 
   /**
-   * Semaphore to signal waiting workers for new tasks.
+   * The WorkStealingDeques of the workers on this node. Deques are only added before the workers are started.
+   */
+  void add_worker_deque(const std::shared_ptr<WorkStealingDeque>& deque);
+  const std::vector<std::shared_ptr<WorkStealingDeque>>& worker_deques() const;
+  bool worker_deques_empty() const;
+
+  /**
+   * Workers that did not find any task register their wake-up semaphore before they check the queues for a last time
+   * and go to sleep. Whenever tasks are added to the queue or to one of the workers' deques, wake_idle_worker() wakes
+   * up a single sleeping worker (if any) instead of waking up all of them. remove_idle_worker() returns false if the
+   * worker has already been woken up.
+   */
+  void add_idle_worker(moodycamel::LightweightSemaphore& wake_up_semaphore);
+  bool remove_idle_worker(moodycamel::LightweightSemaphore& wake_up_semaphore);
+  bool wake_idle_worker();
+  uint32_t idle_worker_count() const;
+
+  /**
+   * Semaphore counting the tasks in the queue. Workers acquire it before pulling a task.
    * When macOS ships a more recent libc++, this third-party semaphore can be replaced by std::counting_semaphore (see
    * comment in benchmark_runner.hpp).
    */
@@ -69,6 +103,12 @@ class TaskQueue {
  private:
   NodeID _node_id{INVALID_NODE_ID};
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  std::vector<std::shared_ptr<WorkStealingDeque>> _worker_deques;
+
+  std::atomic_uint32_t _idle_worker_count{0};
+  std::mutex _idle_workers_mutex;
+  std::vector<moodycamel::LightweightSemaphore*> _idle_workers;
 };
 
 }  // namespace hyrise
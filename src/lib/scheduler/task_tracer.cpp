@@ -0,0 +1,194 @@
+#include "task_tracer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "magic_enum.hpp"
+#include "nlohmann/json.hpp"
+
+#include "hyrise.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Chrome traces use microseconds as time unit. We use fractions to keep the precision of the steady_clock.
+double to_trace_time(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::micro>{duration}.count();
+}
+
+double to_trace_time(const std::chrono::steady_clock::time_point time_point) {
+  return to_trace_time(time_point.time_since_epoch());
+}
+
+}  // namespace
+
+namespace hyrise {
+
+TaskTraceBuffer::TaskTraceBuffer(const WorkerID worker_id, const CpuID cpu_id, const size_t capacity)
+    : _worker_id{worker_id}, _cpu_id{cpu_id}, _capacity{capacity} {
+  Assert(capacity > 0, "Trace buffer must not be empty.");
+}
+
+WorkerID TaskTraceBuffer::worker_id() const {
+  return _worker_id;
+}
+
+CpuID TaskTraceBuffer::cpu_id() const {
+  return _cpu_id;
+}
+
+void TaskTraceBuffer::add(TaskTraceEvent&& event) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  // The buffer grows until it reaches its capacity, so that workers of idle schedulers do not occupy memory.
+  if (_events.size() < _capacity) {
+    _events.emplace_back(std::move(event));
+    return;
+  }
+
+  // Overwrite the oldest event.
+  _events[_next_index] = std::move(event);
+  _next_index = (_next_index + 1) % _capacity;
+}
+
+std::vector<TaskTraceEvent> TaskTraceBuffer::events() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto oldest_event = _events.begin() + static_cast<std::ptrdiff_t>(_next_index);
+
+  auto events = std::vector<TaskTraceEvent>{};
+  events.reserve(_events.size());
+  events.insert(events.end(), oldest_event, _events.end());
+  events.insert(events.end(), _events.begin(), oldest_event);
+  return events;
+}
+
+void TaskTraceBuffer::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _events.clear();
+  _next_index = 0;
+}
+
+TaskTracer& TaskTracer::operator=(TaskTracer&& task_tracer) noexcept {
+  _enabled = task_tracer._enabled.load();
+  _buffers = std::move(task_tracer._buffers);
+  return *this;
+}
+
+bool TaskTracer::is_enabled() const {
+  return _enabled.load(std::memory_order_relaxed);
+}
+
+void TaskTracer::set_enabled(const bool enabled) {
+  _enabled = enabled;
+}
+
+std::shared_ptr<TaskTraceBuffer> TaskTracer::buffer(const WorkerID worker_id, const CpuID cpu_id) {
+  const auto lock = std::lock_guard<std::mutex>{_buffers_mutex};
+  const auto buffer_id = static_cast<size_t>(worker_id);
+  if (_buffers.size() <= buffer_id) {
+    _buffers.resize(buffer_id + 1);
+  }
+
+  auto& buffer = _buffers[buffer_id];
+  if (!buffer || buffer->cpu_id() != cpu_id) {
+    buffer = std::make_shared<TaskTraceBuffer>(worker_id, cpu_id, TRACE_BUFFER_CAPACITY);
+  }
+  return buffer;
+}
+
+void TaskTracer::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_buffers_mutex};
+  for (const auto& buffer : _buffers) {
+    if (buffer) {
+      buffer->clear();
+    }
+  }
+}
+
+nlohmann::json TaskTracer::to_chrome_trace() const {
+  auto trace_events = nlohmann::json::array();
+
+  const auto lock = std::lock_guard<std::mutex>{_buffers_mutex};
+  for (const auto& buffer : _buffers) {
+    if (!buffer) {
+      continue;
+    }
+
+    const auto thread_id = static_cast<WorkerID::base_type>(buffer->worker_id());
+    trace_events.push_back({{"name", "thread_name"},
+                            {"ph", "M"},
+                            {"pid", 0},
+                            {"tid", thread_id},
+                            {"args",
+                             {{"name", "Worker " + std::to_string(thread_id) + " (CPU " +
+                                           std::to_string(static_cast<CpuID::base_type>(buffer->cpu_id())) + ")"}}}});
+
+    for (const auto& event : buffer->events()) {
+      auto trace_event = nlohmann::json{{"cat", magic_enum::enum_name(event.type)},
+                                        {"pid", 0},
+                                        {"tid", thread_id},
+                                        {"ts", to_trace_time(event.begin)}};
+      switch (event.type) {
+        case TaskTraceEventType::Execution:
+          trace_event["name"] = event.description;
+          trace_event["ph"] = "X";
+          trace_event["dur"] = to_trace_time(event.end - event.begin);
+          trace_event["args"] = {{"task_id", static_cast<TaskID::base_type>(event.task_id)},
+                                 {"queue_wait_us", to_trace_time(event.queue_wait)}};
+          if (event.query_id) {
+            trace_event["args"]["query_id"] = *event.query_id;
+          }
+          break;
+        case TaskTraceEventType::Idle:
+          trace_event["name"] = "Idle";
+          trace_event["ph"] = "X";
+          trace_event["dur"] = to_trace_time(event.end - event.begin);
+          break;
+        case TaskTraceEventType::Steal:
+          trace_event["name"] = "Steal";
+          trace_event["ph"] = "i";
+          trace_event["s"] = "t";
+          trace_event["args"] = {{"task_id", static_cast<TaskID::base_type>(event.task_id)}};
+          break;
+      }
+      trace_events.push_back(std::move(trace_event));
+    }
+  }
+
+  return nlohmann::json{{"traceEvents", std::move(trace_events)}, {"displayTimeUnit", "ns"}};
+}
+
+void TaskTracer::export_chrome_trace(const std::string& file_name) const {
+  auto output_file = std::ofstream{file_name};
+  Assert(output_file.is_open(), "Could not open '" + file_name + "' for writing.");
+  output_file << to_chrome_trace().dump() << '\n';
+}
+
+TaskTracingSetting::TaskTracingSetting() : AbstractSetting("Scheduler.task_tracing") {}
+
+const std::string& TaskTracingSetting::description() const {
+  static const auto description =
+      std::string{"Record the tasks executed by the workers (true/false). See TaskTracer for exporting the trace."};
+  return description;
+}
+
+const std::string& TaskTracingSetting::get() {
+  _value = Hyrise::get().task_tracer.is_enabled() ? "true" : "false";
+  return _value;
+}
+
+void TaskTracingSetting::set(const std::string& value) {
+  Assert(value == "true" || value == "false", "Task tracing can only be set to 'true' or 'false'.");
+  Hyrise::get().task_tracer.set_enabled(value == "true");
+}
+
+}  // namespace hyrise
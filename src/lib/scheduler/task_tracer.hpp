@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json_fwd.hpp"
+
+#include "types.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace hyrise {
+
+enum class TaskTraceEventType : uint8_t {
+  Execution,  // A task was executed. Spans the task's execution, including tasks executed while waiting for others.
+  Idle,       // The worker slept because it did not find any task.
+  Steal       // The worker stole a task from another worker's deque or from another node (instant event).
+};
+
+struct TaskTraceEvent {
+  TaskTraceEventType type{TaskTraceEventType::Execution};
+  TaskID task_id{INVALID_TASK_ID};
+  std::optional<uint64_t> query_id{};
+  std::string description{};
+  std::chrono::steady_clock::time_point begin{};
+  std::chrono::steady_clock::time_point end{};
+
+  // Time between scheduling the task and the start of its execution.
+  std::chrono::nanoseconds queue_wait{0};
+};
+
+/**
+ * Fixed-size ring buffer that holds the most recent trace events of a single worker. Only the owning worker adds
+ * events, so the mutex is uncontended unless the events are read concurrently (e.g., while exporting a trace).
+ */
+class TaskTraceBuffer : private Noncopyable {
+ public:
+  TaskTraceBuffer(const WorkerID worker_id, const CpuID cpu_id, const size_t capacity);
+
+  WorkerID worker_id() const;
+  CpuID cpu_id() const;
+
+  void add(TaskTraceEvent&& event);
+
+  // Returns the buffered events from the oldest to the most recent one.
+  std::vector<TaskTraceEvent> events() const;
+
+  void clear();
+
+ private:
+  const WorkerID _worker_id;
+  const CpuID _cpu_id;
+  const size_t _capacity;
+
+  mutable std::mutex _mutex;
+  std::vector<TaskTraceEvent> _events;
+
+  // Position of the oldest event once the buffer is full.
+  size_t _next_index{0};
+};
+
+/**
+ * Records what the workers of the NodeQueueScheduler do over time: which tasks they execute (including how long the
+ * tasks waited in the queues), when they steal tasks, and when they are idle. Each worker writes to its own
+ * TaskTraceBuffer, which keeps the most recent TRACE_BUFFER_CAPACITY events. Tracing is disabled by default and can be
+ * enabled at runtime, either using set_enabled() or the "Scheduler.task_tracing" setting (see TaskTracingSetting).
+ *
+ * The trace can be exported to the Chrome trace event format, which can be opened with chrome://tracing or Perfetto
+ * (https://ui.perfetto.dev). Each worker is shown as a thread, tasks are shown as slices. Tasks that a worker executes
+ * while waiting for other tasks are nested into the waiting task.
+ */
+class TaskTracer : public Noncopyable {
+ public:
+  static constexpr auto TRACE_BUFFER_CAPACITY = size_t{1} << 16;
+
+  bool is_enabled() const;
+  void set_enabled(const bool enabled);
+
+  // Returns the buffer of the given worker. Workers of subsequent schedulers with the same ID and CPU share a buffer,
+  // so that the trace covers all schedulers since the last clear().
+  std::shared_ptr<TaskTraceBuffer> buffer(const WorkerID worker_id, const CpuID cpu_id);
+
+  // Drops all recorded events.
+  void clear();
+
+  nlohmann::json to_chrome_trace() const;
+  void export_chrome_trace(const std::string& file_name) const;
+
+ protected:
+  friend class Hyrise;
+
+  TaskTracer() = default;
+  TaskTracer& operator=(TaskTracer&& task_tracer) noexcept;
+
+ private:
+  std::atomic_bool _enabled{false};
+
+  mutable std::mutex _buffers_mutex;
+  std::vector<std::shared_ptr<TaskTraceBuffer>> _buffers;
+};
+
+/**
+ * Setting to enable or disable task tracing at runtime, e.g., using
+ *   UPDATE meta_settings SET value = 'true' WHERE name = 'Scheduler.task_tracing'
+ * The NodeQueueScheduler registers the setting while it is active.
+ */
+class TaskTracingSetting : public AbstractSetting {
+ public:
+  TaskTracingSetting();
+
+  const std::string& description() const final;
+  const std::string& get() final;
+  void set(const std::string& value) final;
+
+ private:
+  std::string _value;
+};
+
+}  // namespace hyrise
@@ -7,13 +7,20 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <ostream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "memory/numa_memory_resource.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
@@ -186,6 +193,24 @@ size_t Topology::num_cpus() const {
   return _num_cpus;
 }
 
+boost::container::pmr::memory_resource* Topology::get_memory_resource(const NodeID node_id) const {
+  Assert(node_id < _nodes.size(), "Node " + std::to_string(node_id) + " is not part of the topology.");
+
+  // Like the default memory resource (see boost_default_memory_resource.cpp), the memory resources are leaked on
+  // purpose, as chunks allocated using them might be destructed after the Topology or even after static destruction.
+  // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,bugprone-unhandled-exception-at-new)
+  static auto* memory_resources = new std::vector<std::unique_ptr<NumaMemoryResource>>{};
+  static auto* memory_resources_mutex = new std::mutex{};
+  // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,bugprone-unhandled-exception-at-new)
+
+  const auto lock = std::lock_guard<std::mutex>{*memory_resources_mutex};
+  while (memory_resources->size() <= node_id) {
+    memory_resources->emplace_back(
+        std::make_unique<NumaMemoryResource>(static_cast<NodeID>(memory_resources->size())));
+  }
+  return (*memory_resources)[node_id].get();
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _num_cpus = 0;
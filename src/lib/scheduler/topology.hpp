@@ -5,6 +5,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/pmr/memory_resource.hpp>
+
 #include "types.hpp"
 
 namespace hyrise {
@@ -81,6 +83,12 @@ class Topology final : public Noncopyable {
 
   size_t num_cpus() const;
 
+  /**
+   * Returns the memory resource that allocates memory on the given node (see NumaMemoryResource). Memory resources are
+   * created on first use and are kept when the topology is re-initialized, as chunks might still use them.
+   */
+  boost::container::pmr::memory_resource* get_memory_resource(const NodeID node_id) const;
+
  private:
   Topology();
 
@@ -0,0 +1,125 @@
+#include "work_stealing_deque.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+WorkStealingDeque::Buffer::Buffer(size_t init_capacity) : capacity{init_capacity}, elements(init_capacity) {}
+
+WorkStealingDeque::Element WorkStealingDeque::Buffer::load(int64_t index) const {
+  // The capacity is a power of two, so the modulo is a cheap bitwise AND.
+  return elements[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::store(int64_t index, Element element) {
+  elements[static_cast<size_t>(index) & (capacity - 1)].store(element, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  Assert(std::has_single_bit(initial_capacity), "Capacity of WorkStealingDeque must be a power of two.");
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Free the shared_ptrs of tasks that have not been taken.
+  while (pop()) {}
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, bottom, top);
+  }
+
+  buffer->store(bottom, new std::shared_ptr<AbstractTask>(task));  // NOLINT(cppcoreguidelines-owning-memory)
+
+  // Make sure the element is written before thieves can observe the new bottom.
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+
+  // Order the reservation of the bottom element with the thieves' read of bottom (see steal()).
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto element = buffer->load(bottom);
+  if (top == bottom) {
+    // Last element. Race against thieves by incrementing top.
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      element = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!element) {
+    return nullptr;
+  }
+
+  const auto owned_element = std::unique_ptr<std::shared_ptr<AbstractTask>>{element};
+  return std::move(*owned_element);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  // Read the element before claiming it. If the claim fails, the owner or another thief took it and we must not touch
+  // it. The buffer is not freed while the deque exists, so reading from an outdated buffer is safe.
+  const auto* buffer = _buffer.load(std::memory_order_acquire);
+  const auto element = buffer->load(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  const auto owned_element = std::unique_ptr<std::shared_ptr<AbstractTask>>{element};
+  return std::move(*owned_element);
+}
+
+bool WorkStealingDeque::empty() const {
+  return size_approx() == 0;
+}
+
+size_t WorkStealingDeque::size_approx() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, int64_t bottom, int64_t top) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->store(index, buffer->load(index));
+  }
+
+  auto* const new_buffer_ptr = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_ptr, std::memory_order_release);
+  return new_buffer_ptr;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+/**
+ * Work-stealing deque of tasks following Chase and Lev [1] with the memory orderings proposed by Lê et al. [2]. Each
+ * worker owns one deque. The owner pushes and pops tasks at the bottom (LIFO) without synchronizing with other workers,
+ * so that the tasks it spawned last, whose data is most likely still cached, are executed first. Other workers steal
+ * tasks from the top (FIFO), which usually yields the oldest and thus largest tasks.
+ *
+ * Only the owning worker may call push() and pop(). steal(), empty(), and size_approx() may be called by any thread.
+ *
+ * As shared_ptrs cannot be atomically stored in the circular buffer, the buffer holds pointers to heap-allocated
+ * shared_ptrs. Exactly one pop() or steal() takes a task out of the deque and frees its shared_ptr. When the buffer is
+ * full, it is replaced by a buffer of twice the capacity. Previous buffers are kept until the deque is destroyed, as
+ * concurrent thieves might still read from them.
+ *
+ *  [1] Chase and Lev. Dynamic Circular Work-Stealing Deque. SPAA 2005.
+ *  [2] Lê, Pop, Cohen, and Zappa Nardelli. Correct and Efficient Work-Stealing for Weak Memory Models. PPoPP 2013.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 256);
+  ~WorkStealingDeque();
+
+  WorkStealingDeque(WorkStealingDeque&&) = delete;
+  WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // Returns the task pushed last or nullptr if the deque is empty.
+  std::shared_ptr<AbstractTask> pop();
+
+  // Returns the task pushed first or nullptr if the deque is empty or another thread took the task concurrently.
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+  // The size might be outdated when it is returned as other threads concurrently steal tasks.
+  size_t size_approx() const;
+
+ private:
+  using Element = std::shared_ptr<AbstractTask>*;
+
+  struct Buffer {
+    explicit Buffer(size_t init_capacity);
+
+    Element load(int64_t index) const;
+    void store(int64_t index, Element element);
+
+    const size_t capacity;
+    std::vector<std::atomic<Element>> elements;
+  };
+
+  Buffer* _grow(Buffer* buffer, int64_t bottom, int64_t top);
+
+  // Top and bottom are modified by different threads and are placed on different cache lines.
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all previous buffers. Only accessed by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace hyrise
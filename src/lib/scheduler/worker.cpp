@@ -4,9 +4,11 @@
 #include <sched.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
@@ -16,10 +18,13 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
+#include "query_context.hpp"
 #include "shutdown_task.hpp"
+#include "task_tracer.hpp"
 #include "task_queue.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -41,11 +46,18 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() {
 }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID worker_id, CpuID cpu_id)
-    : _queue(queue), _id(worker_id), _cpu_id(cpu_id) {
+    : _queue(queue),
+      _deque(std::make_shared<WorkStealingDeque>()),
+      _trace_buffer(Hyrise::get().task_tracer.buffer(worker_id, cpu_id)),
+      _id(worker_id),
+      _cpu_id(cpu_id) {
   // Generate a random distribution from 0-99 for later use, see below
   _random.resize(100);
   std::iota(_random.begin(), _random.end(), 0);
   std::shuffle(_random.begin(), _random.end(), std::default_random_engine{std::random_device{}()});
+  _random_engine.seed(std::random_device{}());
+
+  _queue->add_worker_deque(_deque);
 }
 
 WorkerID Worker::id() const {
@@ -60,6 +72,30 @@ CpuID Worker::cpu_id() const {
   return _cpu_id;
 }
 
+void Worker::push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(&*get_this_thread_worker() == this, "Tasks can only be pushed to the deque of the current worker.");
+  DebugAssert(task->is_stealable(), "Non-stealable tasks have to be pushed to a TaskQueue.");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) {
+    return;
+  }
+
+  task->set_node_id(_queue->node_id());
+  _deque->push(task);
+
+  // Wake up an idle worker to steal the task, preferably from our node.
+  if (_queue->wake_idle_worker()) {
+    return;
+  }
+
+  for (const auto& queue : Hyrise::get().scheduler()->queues()) {
+    if (queue && queue != _queue && queue->wake_idle_worker()) {
+      return;
+    }
+  }
+}
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker.");
 
@@ -74,51 +110,70 @@ void Worker::operator()() {
 }
 
 void Worker::_work(const AllowSleep allow_sleep) {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // If execute_next has been called, run that task first, otherwise try to retrieve a task from our deque or the queue.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
   } else {
-    if (_queue->semaphore.tryWait()) {
+    task = _deque->pop();
+    if (!task && _queue->semaphore.tryWait()) {
       task = _queue->pull();
     }
   }
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
-      if (!queue || queue == _queue) {
-        continue;
-      }
+    task = _steal_task();
+    if (task) {
+      _num_stolen_tasks.fetch_add(1, std::memory_order_relaxed);
+    }
 
-      if (queue->semaphore.tryWait()) {
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          break;
-        }
-      }
+    if (task && Hyrise::get().task_tracer.is_enabled()) {
+      auto event = TaskTraceEvent{};
+      event.type = TaskTraceEventType::Steal;
+      event.task_id = task->id();
+      event.begin = std::chrono::steady_clock::now();
+      event.end = event.begin;
+      _trace_buffer->add(std::move(event));
     }
   }
 
-  // If there is no ready task neither in our queue nor in any other and we are allowed to sleep, wait on the semaphore.
-  if (!task && allow_sleep == AllowSleep::Yes) {
-    _queue->semaphore.wait();
-    task = _queue->pull();
+  // Tasks of queries that reached their limit of workers have to be deferred (see QueryContext). Before going idle, we
+  // take deferred tasks of queries that did not reach their hard limit. These tasks already hold a worker slot.
+  auto query_context = std::shared_ptr<QueryContext>{};
+  if (!task) {
+    task = Hyrise::get().workload_manager.take_deferred_task();
+    query_context = task ? task->query_context() : nullptr;
+  } else {
+    query_context = task->query_context();
+    if (query_context && !query_context->try_acquire_worker(task)) {
+      return;
+    }
   }
 
+  // If there is no ready task neither in our queue nor in any other and we are allowed to sleep, wait until we are
+  // woken up. As the tasks might have been taken by other workers in the meantime, we check all queues again.
   if (!task) {
+    if (allow_sleep == AllowSleep::Yes) {
+      _sleep();
+    }
     return;
   }
 
   const auto successfully_assigned = task->try_mark_as_assigned_to_worker();
   if (!successfully_assigned) {
     // Some other worker has already started to work on this task - pick a different one.
+    if (query_context) {
+      query_context->release_worker();
+    }
     return;
   }
 
-  task->execute();
+  _execute_task(task);
+
+  if (query_context) {
+    query_context->release_worker();
+  }
 
   // In case the processed task is a ShutdownTask, we shut down the worker (see `operator()` loop).
   if (dynamic_cast<ShutdownTask*>(&*task)) {
@@ -146,6 +201,8 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution.");
     _next_task = task;
+  } else if (task->is_stealable()) {
+    push_local_task(task);
   } else {
     _queue->push(task, SchedulePriority::Default);
   }
@@ -164,6 +221,22 @@ uint64_t Worker::num_finished_tasks() const {
   return _num_finished_tasks;
 }
 
+uint64_t Worker::num_stolen_tasks() const {
+  return _num_stolen_tasks.load(std::memory_order_relaxed);
+}
+
+std::chrono::nanoseconds Worker::idle_duration() const {
+  return std::chrono::nanoseconds{_idle_duration.load(std::memory_order_relaxed)};
+}
+
+std::optional<TaskID> Worker::current_task_id() const {
+  const auto task_id = TaskID{_current_task_id.load(std::memory_order_relaxed)};
+  if (task_id == INVALID_TASK_ID) {
+    return std::nullopt;
+  }
+  return task_id;
+}
+
 void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
   // This lambda checks if all tasks from the vector (our "own" tasks) have been executed. If they are, it causes
   // _wait_for_tasks to return. If there are remaining tasks, it primarily tries to execute these. If they cannot be
@@ -211,7 +284,7 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
       }
 
       // Actually execute it.
-      task->execute();
+      _execute_task(task);
       ++_num_finished_tasks;
 
       // Reset loop so that we re-visit tasks that may have finished in the meantime. We need to decrement `it` because
@@ -230,6 +303,124 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
   }
 }
 
+std::shared_ptr<AbstractTask> Worker::_steal_task() {
+  // Steal from the workers of our node first, as their tasks most likely work on data of our node.
+  auto task = _steal_from_deques(*_queue);
+  if (task) {
+    return task;
+  }
+
+  // Steal from other nodes without explicitly transferring data between nodes. We start with a random node so that
+  // idle workers do not all steal from the same node.
+  const auto& queues = Hyrise::get().scheduler()->queues();
+  const auto queue_count = queues.size();
+  const auto first_queue_id = queue_count > 1 ? _random_engine() % queue_count : size_t{0};
+  for (auto queue_offset = size_t{0}; queue_offset < queue_count; ++queue_offset) {
+    const auto& queue = queues[(first_queue_id + queue_offset) % queue_count];
+    if (!queue || queue == _queue) {
+      continue;
+    }
+
+    if (queue->semaphore.tryWait()) {
+      task = queue->steal();
+    }
+
+    if (!task) {
+      task = _steal_from_deques(*queue);
+    }
+
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_from_deques(const TaskQueue& queue) {
+  // Select a random victim and continue with the subsequent workers.
+  const auto& deques = queue.worker_deques();
+  const auto deque_count = deques.size();
+  if (deque_count == 0) {
+    return nullptr;
+  }
+
+  const auto first_victim_id = _random_engine() % deque_count;
+  for (auto victim_offset = size_t{0}; victim_offset < deque_count; ++victim_offset) {
+    const auto& deque = deques[(first_victim_id + victim_offset) % deque_count];
+    if (deque == _deque) {
+      continue;
+    }
+
+    auto task = deque->steal();
+    if (task) {
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+void Worker::_sleep() {
+  _queue->add_idle_worker(_wake_up_semaphore);
+
+  // Tasks might have been added after we last checked the queues but before we registered as idle.
+  if (!_queue->empty() || !_queue->worker_deques_empty()) {
+    if (_queue->remove_idle_worker(_wake_up_semaphore)) {
+      return;
+    }
+    // We have been woken up in the meantime. Consume the signal.
+  }
+
+  // Taking the time is cheap compared to going to sleep, so we always account for the idle time.
+  const auto begin = std::chrono::steady_clock::now();
+  _wake_up_semaphore.wait();
+  const auto end = std::chrono::steady_clock::now();
+  _idle_duration.fetch_add(std::chrono::nanoseconds{end - begin}.count(), std::memory_order_relaxed);
+
+  if (Hyrise::get().task_tracer.is_enabled()) {
+    auto event = TaskTraceEvent{};
+    event.type = TaskTraceEventType::Idle;
+    event.begin = begin;
+    event.end = end;
+    _trace_buffer->add(std::move(event));
+  }
+}
+
+void Worker::_execute_task(const std::shared_ptr<AbstractTask>& task) {
+  // Tasks can be executed while waiting for other tasks (see _wait_for_tasks()). Afterwards, the waiting task is the
+  // current task again.
+  const auto previous_task_id = _current_task_id.exchange(task->id(), std::memory_order_relaxed);
+  if (!Hyrise::get().task_tracer.is_enabled()) {
+    task->execute();
+    _current_task_id.store(previous_task_id, std::memory_order_relaxed);
+    return;
+  }
+
+  // The description and the QueryContext are determined before the execution, as the task's state might change while
+  // it is executed (e.g., CoroutineTasks might be finished and released by another worker).
+  auto event = TaskTraceEvent{};
+  event.type = TaskTraceEventType::Execution;
+  event.task_id = task->id();
+  event.description = task->description();
+  if (const auto& query_context = task->query_context()) {
+    event.query_id = query_context->id();
+  }
+
+  event.begin = std::chrono::steady_clock::now();
+  const auto scheduled_time = task->scheduled_time();
+  if (scheduled_time != std::chrono::steady_clock::time_point{} && scheduled_time < event.begin) {
+    event.queue_wait = event.begin - scheduled_time;
+  }
+
+  task->execute();
+  _current_task_id.store(previous_task_id, std::memory_order_relaxed);
+
+  event.end = std::chrono::steady_clock::now();
+  _trace_buffer->add(std::move(event));
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   auto cpuset = cpu_set_t{};  // NOLINT(misc-include-cleaner): cpu_set_t is defined by another include of sched.h.
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <random>
 #include <thread>
 #include <vector>
 
+#include "concurrentqueue.h"  // The lightweight semaphore uses definitions of concurrentqueue.h.
+#include "lightweightsemaphore.h"
+
 #include "scheduler/abstract_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -12,9 +18,20 @@
 namespace hyrise {
 
 class TaskQueue;
+class TaskTraceBuffer;
+class WorkStealingDeque;
 
 /**
- * To be executed on a separate thread, fetches and executes tasks until the queue is empty.
+ * To be executed on a separate thread, fetches and executes tasks until the queue is empty. Each worker owns a
+ * WorkStealingDeque for the tasks it spawns itself. Tasks are taken in the following order:
+ *   1. the task passed to execute_next(),
+ *   2. the most recently pushed task of the own deque (LIFO),
+ *   3. the node's TaskQueue,
+ *   4. stolen from the deques of randomly selected workers of the same node,
+ *   5. stolen from the TaskQueues and worker deques of the other nodes (again, in random order).
+ * If no task is found, the worker goes to sleep until a new task is added to its node.
+ *
+ * While task tracing is enabled, the worker records the executed tasks, steals, and idle times (see TaskTracer).
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -31,6 +48,9 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
 
+  // Pushes a stealable task to the worker's own deque. Must be called from the worker's thread.
+  void push_local_task(const std::shared_ptr<AbstractTask>& task);
+
   void start();
   void join();
 
@@ -45,6 +65,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // cautious when using this method in any other context (see comments in #2526).
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Statistics of the worker (see MetaWorkersTable). They are updated using relaxed atomic operations and are thus only
+   * approximately consistent with each other.
+   * @{
+   */
+  uint64_t num_stolen_tasks() const;
+  std::chrono::nanoseconds idle_duration() const;
+
+  // ID of the task that the worker currently executes, if any.
+  std::optional<TaskID> current_task_id() const;
+  /** @} */
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -64,17 +96,35 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  std::shared_ptr<AbstractTask> _steal_task();
+  std::shared_ptr<AbstractTask> _steal_from_deques(const TaskQueue& queue);
+
+  // Registers the worker as idle and waits until it is woken up, unless new tasks arrived in the meantime.
+  void _sleep();
+
+  // Executes the task and records it if task tracing is enabled.
+  void _execute_task(const std::shared_ptr<AbstractTask>& task);
+
   std::shared_ptr<AbstractTask> _next_task{};
   std::shared_ptr<TaskQueue> _queue{};
+  std::shared_ptr<WorkStealingDeque> _deque{};
+  std::shared_ptr<TaskTraceBuffer> _trace_buffer{};
+  moodycamel::LightweightSemaphore _wake_up_semaphore{};
   WorkerID _id{0};
   CpuID _cpu_id{0};
   std::thread _thread;
   std::atomic_uint64_t _num_finished_tasks{0};
+  std::atomic_uint64_t _num_stolen_tasks{0};
+  std::atomic<std::chrono::nanoseconds::rep> _idle_duration{0};
+  std::atomic<TaskID::base_type> _current_task_id{INVALID_TASK_ID};
 
   bool _active{true};
 
   std::vector<uint> _random{};
   size_t _next_random{0};
+
+  // Used to select victims for work stealing.
+  std::minstd_rand _random_engine{};
 };
 
 }  // namespace hyrise
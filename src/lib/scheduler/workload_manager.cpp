@@ -0,0 +1,112 @@
+#include "workload_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "hyrise.hpp"
+#include "query_context.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace hyrise {
+
+WorkloadManager& WorkloadManager::operator=(WorkloadManager&& workload_manager) noexcept {
+  _running_queries = std::move(workload_manager._running_queries);
+  _total_weight = workload_manager._total_weight.load();
+  _deferred_task_count = workload_manager._deferred_task_count.load();
+  _memory_budget = workload_manager._memory_budget;
+  _admitted_memory_usage = workload_manager._admitted_memory_usage;
+  return *this;
+}
+
+std::shared_ptr<QueryContext> WorkloadManager::begin_query(const std::string& description,
+                                                           const QuerySchedulingOptions& options,
+                                                           const size_t estimated_memory_usage) {
+  auto query_context = std::make_shared<QueryContext>(description, options, estimated_memory_usage);
+
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  if (!Worker::get_this_thread_worker()) {
+    _admission_condition_variable.wait(lock, [&]() {
+      return _memory_budget == 0 || _running_queries.empty() ||
+             _admitted_memory_usage + estimated_memory_usage <= _memory_budget;
+    });
+  }
+
+  _running_queries.emplace_back(query_context);
+  _total_weight += options.weight;
+  _admitted_memory_usage += estimated_memory_usage;
+  return query_context;
+}
+
+void WorkloadManager::end_query(const std::shared_ptr<QueryContext>& query_context) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto iter = std::find(_running_queries.begin(), _running_queries.end(), query_context);
+    Assert(iter != _running_queries.end(), "Query is not running.");
+    _running_queries.erase(iter);
+    _total_weight -= query_context->options().weight;
+    _admitted_memory_usage -= query_context->estimated_memory_usage();
+  }
+  _admission_condition_variable.notify_all();
+
+  // All tasks of the query are done. Tasks that are still deferred have been executed by waiting workers and are
+  // dropped. Otherwise, they would keep the QueryContext alive.
+  query_context->_clear_deferred_tasks();
+}
+
+std::vector<std::shared_ptr<QueryContext>> WorkloadManager::running_queries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _running_queries;
+}
+
+void WorkloadManager::set_memory_budget(const size_t memory_budget) {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _memory_budget = memory_budget;
+  }
+  _admission_condition_variable.notify_all();
+}
+
+size_t WorkloadManager::memory_budget() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_budget;
+}
+
+size_t WorkloadManager::admitted_memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _admitted_memory_usage;
+}
+
+uint32_t WorkloadManager::fair_share(const uint32_t weight) const {
+  const auto worker_count = static_cast<uint64_t>(Hyrise::get().topology.num_cpus());
+  const auto total_weight = std::max(_total_weight.load(std::memory_order_relaxed), uint64_t{weight});
+  // Round up so that the shares of all queries cover all workers.
+  const auto share = (worker_count * weight + total_weight - 1) / total_weight;
+  return static_cast<uint32_t>(std::max(share, uint64_t{1}));
+}
+
+std::shared_ptr<AbstractTask> WorkloadManager::take_deferred_task() {
+  if (_deferred_task_count.load(std::memory_order_relaxed) <= 0) {
+    return nullptr;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  for (const auto& query_context : _running_queries) {
+    auto task = query_context->take_deferred_task();
+    if (task) {
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace hyrise
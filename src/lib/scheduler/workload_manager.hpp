@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "scheduler/query_context.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractTask;
+
+/**
+ * Keeps track of the running queries (see QueryContext) for admission control and fair-share scheduling.
+ *
+ * Admission control: Queries announce their estimated memory usage when they begin. If a memory budget is set and the
+ * estimated memory usage of the admitted queries and the new query exceeds it, begin_query() blocks until enough
+ * queries have ended. A query is always admitted if no other query is running, so that queries that exceed the budget
+ * on their own can still be executed. As workers must not block (the admitted queries might need them to make
+ * progress), queries that begin on a worker thread (e.g., items of the BenchmarkRunner in scheduled mode) are admitted
+ * immediately but still account for the admitted memory.
+ *
+ * Fair-share scheduling: Each running query gets a share of the workers that is proportional to its weight (see
+ * fair_share()). QueryContexts defer tasks of queries that exceed their share while workers have other work to do.
+ */
+class WorkloadManager : public Noncopyable {
+ public:
+  /**
+   * Registers a query and blocks until it is admitted. Every query that began has to be ended using end_query(), even
+   * if its execution failed.
+   */
+  std::shared_ptr<QueryContext> begin_query(const std::string& description, const QuerySchedulingOptions& options,
+                                            const size_t estimated_memory_usage = 0);
+  void end_query(const std::shared_ptr<QueryContext>& query_context);
+
+  std::vector<std::shared_ptr<QueryContext>> running_queries() const;
+
+  /**
+   * Budget for the estimated memory usage of all admitted queries in bytes. 0 (the default) disables the admission
+   * control.
+   */
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+  size_t admitted_memory_usage() const;
+
+  // Number of workers a query with the given weight may occupy when all running queries have tasks to execute.
+  uint32_t fair_share(const uint32_t weight) const;
+
+  // Takes a deferred task of any running query whose hard limit permits (see QueryContext::take_deferred_task()). Used
+  // by workers that would otherwise be idle.
+  std::shared_ptr<AbstractTask> take_deferred_task();
+
+ protected:
+  friend class Hyrise;
+  friend class QueryContext;
+
+  WorkloadManager() = default;
+  WorkloadManager& operator=(WorkloadManager&& workload_manager) noexcept;
+
+  // Number of deferred tasks of all queries, so that idle workers do not have to acquire the mutex.
+  std::atomic_int64_t _deferred_task_count{0};
+
+ private:
+  mutable std::mutex _mutex;
+  std::condition_variable _admission_condition_variable;
+  std::vector<std::shared_ptr<QueryContext>> _running_queries;
+  std::atomic_uint64_t _total_weight{0};
+  size_t _memory_budget{0};
+  size_t _admitted_memory_usage{0};
+};
+
+}  // namespace hyrise
@@ -19,6 +19,7 @@
 #include "create_sql_parser_error_message.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
@@ -32,9 +33,12 @@ namespace hyrise {
 SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                         const QuerySchedulingOptions& scheduling_options,
+                         const std::shared_ptr<ResultCache>& init_result_cache)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      result_cache(init_result_cache),
       _sql(sql),
       _transaction_context(transaction_context),
       _optimizer(optimizer) {
@@ -95,8 +99,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<Transacti
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
-                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, optimizer, pqp_cache, lqp_cache, result_cache);
+    pipeline_statement->set_scheduling_options(scheduling_options);
     _sql_pipeline_statements.emplace_back(std::move(pipeline_statement));
   }
 
@@ -348,6 +353,7 @@ std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
   std::vector<bool> query_plan_cache_hits;
+  auto num_result_cache_hits = size_t{0};
 
   for (const auto& statement_metric : metrics.statement_metrics) {
     total_sql_translate_nanos += statement_metric->sql_translation_duration;
@@ -356,6 +362,9 @@ std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics
     total_execute_nanos += statement_metric->plan_execution_duration;
 
     query_plan_cache_hits.emplace_back(statement_metric->query_plan_cache_hit);
+    if (statement_metric->result_cache_hit) {
+      ++num_result_cache_hits;
+    }
   }
 
   const auto num_cache_hits = std::count(query_plan_cache_hits.begin(), query_plan_cache_hits.end(), true);
@@ -366,7 +375,8 @@ std::ostream& operator<<(std::ostream& stream, const SQLPipelineMetrics& metrics
   stream << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   stream << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   stream << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
-  stream << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
+  stream << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s), ";
+  stream << "RESULT CACHE HITS: " << num_result_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
   stream << "]\n";
 
   return stream;
@@ -11,6 +11,7 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/chunk.hpp"
 
@@ -39,7 +40,9 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const QuerySchedulingOptions& scheduling_options = {},
+              const std::shared_ptr<ResultCache>& init_result_cache = nullptr);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -99,6 +102,7 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<ResultCache> result_cache;
 
  private:
   friend class SQLPipelineStatementTest;
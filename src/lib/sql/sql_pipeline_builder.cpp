@@ -3,8 +3,10 @@
 #include <memory>
 #include <string>
 
+#include "cache/result_cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "types.hpp"
@@ -12,7 +14,10 @@
 namespace hyrise {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _result_cache(Hyrise::get().default_result_cache) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -42,13 +47,24 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<ResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_scheduling_options(const QuerySchedulingOptions& scheduling_options) {
+  _scheduling_options = scheduling_options;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
   return with_mvcc(UseMvcc::No);
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _scheduling_options, _result_cache);
   return pipeline;
 }
 
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "cache/result_cache.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql_pipeline.hpp"
 #include "sql_pipeline_statement.hpp"
@@ -41,6 +43,8 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<ResultCache>& result_cache);
+  SQLPipelineBuilder& with_scheduling_options(const QuerySchedulingOptions& scheduling_options);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -57,6 +61,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<ResultCache> _result_cache;
+  QuerySchedulingOptions _scheduling_options;
 };
 
 }  // namespace hyrise
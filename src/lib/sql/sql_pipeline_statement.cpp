@@ -3,6 +3,7 @@
 #include <chrono>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -13,11 +14,14 @@
 #include "SQLParser.h"
 #include "SQLParserResult.h"
 
+#include "cache/result_cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "create_sql_parser_error_message.hpp"
 #include "hyrise.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "operators/abstract_operator.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -25,12 +29,17 @@
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "operators/pqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/materialized_view.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -39,9 +48,11 @@ namespace hyrise {
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const std::shared_ptr<ResultCache>& init_result_cache)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      result_cache(init_result_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
@@ -62,6 +73,10 @@ void SQLPipelineStatement::set_transaction_context(const std::shared_ptr<Transac
   _transaction_context = transaction_context;
 }
 
+void SQLPipelineStatement::set_scheduling_options(const QuerySchedulingOptions& scheduling_options) {
+  _scheduling_options = scheduling_options;
+}
+
 const std::string& SQLPipelineStatement::get_sql_string() {
   return _sql_string;
 }
@@ -123,8 +138,12 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     return _optimized_logical_plan;
   }
 
+  // Plans that read materialized views are only valid for the statement's snapshot (see MaterializedViewRule). Thus,
+  // they are neither taken from nor stored in the plan caches.
+  _apply_materialized_view_rule();
+
   // Handle logical query plan if statement has been cached
-  if (lqp_cache) {
+  if (lqp_cache && !_reads_materialized_views) {
     if (const auto cached_plan = lqp_cache->try_get(_sql_string)) {
       const auto& plan = *cached_plan;
       DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
@@ -156,7 +175,7 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   _metrics->optimizer_rule_durations = *optimizer_rule_durations;
 
   // Cache newly created plan for the according sql statement
-  if (lqp_cache && _translation_info.cacheable) {
+  if (lqp_cache && _translation_info.cacheable && !_reads_materialized_views) {
     lqp_cache->set(_sql_string, _optimized_logical_plan);
   }
 
@@ -169,16 +188,20 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   }
 
   // If we need a transaction context but haven't passed one in, this is the last point where we can create it
-  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
-    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
-  }
+  _ensure_transaction_context();
 
   // Stores when the actual compilation started/ended
   auto started = std::chrono::steady_clock::now();
   auto done = started;  // dummy value needed for initialization
 
+  // Plans that read materialized views are not cached (see get_optimized_logical_plan()). Whether the plan reads them
+  // is only known after the rule was applied.
+  if (pqp_cache && _may_read_materialized_views()) {
+    (void)get_optimized_logical_plan();
+  }
+
   // Try to retrieve the PQP from cache
-  if (pqp_cache) {
+  if (pqp_cache && !_reads_materialized_views) {
     if (const auto cached_physical_plan = pqp_cache->try_get(_sql_string)) {
       if ((*cached_physical_plan)->transaction_context_is_set()) {
         Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
@@ -207,7 +230,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   }
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
+  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable && !_reads_materialized_views) {
     pqp_cache->set(_sql_string, _physical_plan);
   }
 
@@ -281,11 +304,48 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  // Try to retrieve the result from the result cache. The table versions are taken before the execution, so that
+  // concurrent modifications prevent caching the result.
+  auto result_cache_table_versions = std::optional<ResultCache::TableVersions>{};
+  auto snapshot_commit_id = std::optional<CommitID>{};
+  if (_uses_result_cache()) {
+    _ensure_transaction_context();
+    if (_use_mvcc == UseMvcc::Yes) {
+      snapshot_commit_id = _transaction_context->snapshot_commit_id();
+    }
+
+    const auto& lqp = get_optimized_logical_plan();
+    if (const auto cached_result = result_cache->try_get(lqp, snapshot_commit_id)) {
+      _result_table = cached_result;
+      _metrics->result_cache_hit = true;
+      if (_use_mvcc == UseMvcc::Yes) {
+        _transaction_context->commit();
+      }
+      return {SQLPipelineStatus::Success, _result_table};
+    }
+
+    result_cache_table_versions = ResultCache::table_versions(lqp);
+  }
+
   const auto& tasks = get_tasks();
 
   const auto started = std::chrono::steady_clock::now();
 
-  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  // Register the statement at the WorkloadManager, which might delay it until there is enough memory, and account all
+  // of its tasks to the statement's QueryContext.
+  auto& workload_manager = Hyrise::get().workload_manager;
+  const auto query_context = workload_manager.begin_query(_sql_string, _scheduling_options, _estimate_memory_usage());
+  for (const auto& task : tasks) {
+    task->set_query_context(query_context);
+  }
+
+  try {
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  } catch (...) {
+    workload_manager.end_query(query_context);
+    throw;
+  }
+  workload_manager.end_query(query_context);
 
   if (has_failed()) {
     return {SQLPipelineStatus::Failure, _result_table};
@@ -329,6 +389,11 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     _query_has_output = false;
   }
 
+  if (result_cache_table_versions && _result_table) {
+    result_cache->set(get_optimized_logical_plan(), *result_cache_table_versions, _result_table, snapshot_commit_id,
+                      _metrics->plan_execution_duration);
+  }
+
   return {SQLPipelineStatus::Success, _result_table};
 }
 
@@ -340,6 +405,84 @@ const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metric
   return _metrics;
 }
 
+void SQLPipelineStatement::_ensure_transaction_context() {
+  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  }
+}
+
+bool SQLPipelineStatement::_may_read_materialized_views() {
+  return _transaction_context && _transaction_context->is_auto_commit() &&
+         !Hyrise::get().storage_manager.materialized_views().empty();
+}
+
+void SQLPipelineStatement::_apply_materialized_view_rule() {
+  if (!_may_read_materialized_views()) {
+    return;
+  }
+
+  // Apply the rule to the unoptimized LQP (see MaterializedViewRule). Like the Optimizer, we add a root node so that
+  // the rule can replace the plan's root.
+  const auto root_node = LogicalPlanRootNode::make(get_unoptimized_logical_plan());
+  MaterializedViewRule{_transaction_context->snapshot_commit_id()}.apply_to_plan(root_node);
+  _unoptimized_logical_plan = root_node->left_input();
+  root_node->set_left_input(nullptr);
+
+  const auto materialized_views = Hyrise::get().storage_manager.materialized_views();
+  visit_lqp(_unoptimized_logical_plan, [&](const auto& node) {
+    if (node->type != LQPNodeType::StoredTable) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+    for (const auto& [materialized_view_name, materialized_view] : materialized_views) {
+      if (materialized_view->table_name() == table_name) {
+        _reads_materialized_views = true;
+      }
+    }
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+bool SQLPipelineStatement::_uses_result_cache() {
+  if (!result_cache || (_transaction_context && !_transaction_context->is_auto_commit())) {
+    return false;
+  }
+
+  if (!get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtSelect)) {
+    return false;
+  }
+
+  // Meta tables reflect the current system state and cannot be cached (see SQLTranslationInfo).
+  return get_sql_translation_info().cacheable;
+}
+
+size_t SQLPipelineStatement::_estimate_memory_usage() {
+  // Only SELECT statements have intermediate results worth mentioning.
+  if (Hyrise::get().workload_manager.memory_budget() == 0 ||
+      !get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtSelect)) {
+    return 0;
+  }
+
+  // Sum up the estimated sizes of all intermediate results, assuming eight bytes per value. Stored tables are not
+  // materialized. Operators without an LQP node (e.g., cached plans of prepared statements) are ignored.
+  const auto cardinality_estimator = CardinalityEstimator{};
+  auto estimated_memory_usage = size_t{0};
+  visit_pqp(get_physical_plan(), [&](const auto& op) {
+    const auto& lqp_node = op->lqp_node;
+    if (!lqp_node || lqp_node->type == LQPNodeType::StoredTable) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    const auto row_count = cardinality_estimator.estimate_cardinality(lqp_node);
+    const auto column_count = lqp_node->output_expressions().size();
+    estimated_memory_usage += static_cast<size_t>(row_count) * column_count * sizeof(int64_t);
+    return PQPVisitation::VisitInputs;
+  });
+
+  return estimated_memory_usage;
+}
+
 void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<AbstractOperator>& pqp) {
   const auto& storage_manager = Hyrise::get().storage_manager;
 
@@ -8,12 +8,14 @@
 #include "SQLParserResult.h"
 
 #include "cache/gdfs_cache.hpp"
+#include "cache/result_cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "sql/sql_translator.hpp"
 #include "sql_plan_cache.hpp"
 #include "storage/table.hpp"
@@ -29,6 +31,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
 };
 
 enum class SQLPipelineStatus {
@@ -53,6 +56,10 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  If a ResultCache is set, get_result_table() first looks up the optimized LQP of SELECT statements in the cache. On a
+ *  hit, the statement is not executed and get_tasks() and get_physical_plan() are not called.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -60,11 +67,15 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<ResultCache>& init_result_cache = nullptr);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  // Set the options for scheduling the tasks of this statement (see QueryContext).
+  void set_scheduling_options(const QuerySchedulingOptions& scheduling_options);
+
   // Returns the raw SQL string.
   const std::string& get_sql_string();
 
@@ -105,10 +116,25 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<ResultCache> result_cache;
 
  private:
   bool _is_transaction_statement();
 
+  // Creates an auto-commit transaction context if MVCC is used and no context was passed in.
+  void _ensure_transaction_context();
+
+  // Returns whether the statement runs in an auto-commit transaction and materialized views exist. Only then,
+  // MaterializedViewRule is applied.
+  bool _may_read_materialized_views();
+
+  // Applies the MaterializedViewRule to the unoptimized LQP and sets _reads_materialized_views if the LQP reads a view.
+  void _apply_materialized_view_rule();
+
+  // Returns whether the result of the statement may be taken from or stored in the result cache. This is the case for
+  // SELECT statements that do not read meta tables and are not part of an explicit transaction.
+  bool _uses_result_cache();
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -117,8 +143,13 @@ class SQLPipelineStatement : public Noncopyable {
   // Throws an InvalidInputException if an invalid PQP is detected.
   static void _precheck_ddl_operators(const std::shared_ptr<AbstractOperator>& pqp);
 
+  // Estimates the memory usage of the statement's intermediate results for the admission control of the
+  // WorkloadManager. Returns 0 if no memory budget is set, as the estimation is not free.
+  size_t _estimate_memory_usage();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  QuerySchedulingOptions _scheduling_options;
 
   const std::shared_ptr<Optimizer> _optimizer;
 
@@ -136,6 +167,9 @@ class SQLPipelineStatement : public Noncopyable {
   bool _query_has_output{true};
   SQLTranslationInfo _translation_info;
 
+  // Set if the optimized LQP reads a materialized view. The plan is only valid for the statement's snapshot.
+  bool _reads_materialized_views{false};
+
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
   // Either a multi-statement transaction context that was passed in using set_transaction_context or an auto-commit
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractSegment;
+
+/**
+ * Creates the segments of a chunk when they are accessed for the first time. Chunks that are created with a segment
+ * loader (see Table::append_chunk()) initially hold no segments. Chunk::get_segment() calls load_segment() once per
+ * column. This allows, e.g., the BinaryParser to return tables from memory-mapped files without reading the data of
+ * segments that are never accessed.
+ */
+class AbstractSegmentLoader : private Noncopyable {
+ public:
+  virtual ~AbstractSegmentLoader() = default;
+
+  // Returns the number of rows of the chunk, so that Chunk::size() does not need to load a segment.
+  virtual ChunkOffset row_count() const = 0;
+
+  // Creates the segment of the given column. Calls are serialized by the chunk.
+  virtual std::shared_ptr<AbstractSegment> load_segment(const ColumnID column_id) const = 0;
+};
+
+}  // namespace hyrise
@@ -16,6 +16,10 @@ class BaseValueSegment : public AbstractSegment {
   // returns true if segment supports null values
   virtual bool is_nullable() const = 0;
 
+  // returns true if at least one value of the segment is NULL. Nullable segments without NULL values can be scanned
+  // without checking each position for NULL.
+  virtual bool contains_null_values() const = 0;
+
   // appends the value at the end of the segment
   virtual void append(const AllTypeVariant& val) = 0;
 
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -13,13 +14,18 @@
 #include <boost/container/pmr/memory_resource.hpp>
 
 #include "abstract_segment.hpp"
+#include "abstract_segment_loader.hpp"
 #include "all_type_variant.hpp"
 #include "base_value_segment.hpp"
+#include "column_span.hpp"
 #include "index/abstract_chunk_index.hpp"
+#include "memory/numa_memory_resource.hpp"
 #include "reference_segment.hpp"
+#include "resolve_type.hpp"
 #include "storage/index/chunk_index_type.hpp"
 #include "storage/mvcc_data.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/atomic_max.hpp"
@@ -51,6 +57,14 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
   }
 }
 
+Chunk::Chunk(const ColumnCount column_count, const std::shared_ptr<AbstractSegmentLoader>& segment_loader,
+             const std::shared_ptr<MvccData>& mvcc_data)
+    : _segments(static_cast<size_t>(column_count)), _segment_loader(segment_loader), _mvcc_data(mvcc_data) {
+  DebugAssert(column_count > 0,
+              "Chunks without segments are not legal, as the row count of such a chunk cannot be determined.");
+  Assert(segment_loader, "Segment loader must not be nullptr.");
+}
+
 bool Chunk::is_mutable() const {
   return _is_mutable.load();
 }
@@ -81,8 +95,63 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
+void Chunk::append_columns(const std::vector<ColumnSpan>& columns, const size_t offset, const ChunkOffset row_count) {
+  DebugAssert(is_mutable(), "Cannot append to immutable chunk.");
+  DebugAssert(columns.size() == _segments.size(), "Number of columns does not match the number of segments.");
+
+  const auto begin_offset = size();
+  if (has_mvcc_data()) {
+    // Make the rows visible - mvcc_data has been pre-allocated.
+    _mvcc_data->set_begin_cids(begin_offset, ChunkOffset{begin_offset + row_count}, CommitID{0});
+  }
+
+  // Make sure the MVCC data is written before the first segment (and, thus, the chunk) grows.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Grow the segments in reverse column order so that the first segment, which determines the chunk's size, grows last.
+  const auto column_count = _segments.size();
+  for (auto reverse_column_id = size_t{0}; reverse_column_id < column_count; ++reverse_column_id) {
+    const auto column_id = column_count - reverse_column_id - 1;
+    const auto& column = columns[column_id];
+
+    resolve_data_type(column.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(_segments[column_id]);
+      Assert(value_segment, "Cannot append to segment that is not a ValueSegment of the column's data type.");
+
+      const auto null_values = column.null_values();
+      value_segment->append_values(column.values<ColumnDataType>().subspan(offset, row_count),
+                                   null_values.empty() ? null_values : null_values.subspan(offset, row_count));
+    });
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+}
+
 std::shared_ptr<AbstractSegment> Chunk::get_segment(ColumnID column_id) const {
-  return std::atomic_load(&_segments.at(column_id));
+  auto segment = std::atomic_load(&_segments.at(column_id));
+  if (!segment) {
+    // The chunk was created with a segment loader and the segment has not been accessed yet.
+    segment = _load_segment(column_id);
+  }
+  return segment;
+}
+
+std::shared_ptr<AbstractSegment> Chunk::_load_segment(const ColumnID column_id) const {
+  Assert(_segment_loader, "Segment must not be nullptr.");
+  const auto lock = std::lock_guard<std::mutex>{_segment_loader_mutex};
+
+  // Another thread might have loaded the segment while we waited for the lock.
+  auto& segment = _segments[column_id];
+  auto loaded_segment = std::atomic_load(&segment);
+  if (!loaded_segment) {
+    loaded_segment = _segment_loader->load_segment(column_id);
+    Assert(loaded_segment && loaded_segment->size() == _segment_loader->row_count(),
+           "Loaded segment does not match the chunk.");
+    std::atomic_store(&segment, loaded_segment);
+  }
+  return loaded_segment;
 }
 
 ColumnCount Chunk::column_count() const {
@@ -93,7 +162,11 @@ ChunkOffset Chunk::size() const {
   if (_segments.empty()) {
     return ChunkOffset{0};
   }
-  const auto first_segment = get_segment(ColumnID{0});
+  const auto first_segment = std::atomic_load(&_segments.front());
+  if (!first_segment) {
+    // Do not load a segment just to determine the chunk's size (see AbstractSegmentLoader).
+    return _segment_loader->row_count();
+  }
   return static_cast<ChunkOffset>(first_segment->size());
 }
 
@@ -154,6 +227,10 @@ std::shared_ptr<AbstractChunkIndex> Chunk::get_index(const ChunkIndexType index_
   return get_index(index_type, segments);
 }
 
+bool Chunk::has_indexes() const {
+  return !_indexes.empty();
+}
+
 void Chunk::remove_index(const std::shared_ptr<AbstractChunkIndex>& index) {
   auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
   DebugAssert(it != _indexes.cend(), "Trying to remove a non-existing index.");
@@ -198,8 +275,9 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
   Segments new_segments(_alloc);
-  for (const auto& segment : _segments) {
-    new_segments.push_back(segment->copy_using_allocator(_alloc));
+  const auto column_count = _segments.size();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    new_segments.push_back(get_segment(column_id)->copy_using_allocator(_alloc));
   }
   _segments = std::move(new_segments);
 }
@@ -208,11 +286,20 @@ const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const {
   return _alloc;
 }
 
+NodeID Chunk::node_id() const {
+  const auto* numa_memory_resource = dynamic_cast<const NumaMemoryResource*>(_alloc.resource());
+  return numa_memory_resource ? numa_memory_resource->node_id() : INVALID_NODE_ID;
+}
+
 size_t Chunk::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
   for (const auto& segment : _segments) {
-    bytes += segment->memory_usage(mode);
+    // Segments that have not been loaded yet do not use memory (see AbstractSegmentLoader).
+    const auto loaded_segment = std::atomic_load(&segment);
+    if (loaded_segment) {
+      bytes += loaded_segment->memory_usage(mode);
+    }
   }
 
   // TODO(anybody) Index memory usage missing
@@ -321,25 +408,32 @@ void Chunk::mark_as_full() {
   _reached_target_size = true;
 }
 
-void Chunk::try_set_immutable() {
+bool Chunk::is_marked_as_full() const {
+  return _reached_target_size;
+}
+
+bool Chunk::try_set_immutable() {
   DebugAssert(_mvcc_data, "Expected to be executed with MVCC enabled.");
   // Mark the chunk as immutable if (i) it reached the target size and a new chunk was added to the table, (ii) it is
   // still mutable, and (iii) all pending Insert operators are either committed or rolled back. We do not have to set
   // the `max_begin_cid` here because committed Insert operators already set it.
   if (!_reached_target_size || !is_mutable() || _mvcc_data->pending_inserts() != 0) {
-    return;
+    return false;
   }
 
   // Mark chunk as immutable. `fetch_and() is only defined for integral types, so we use `compare_exchange_strong()`.
   auto success = true;
   if (_is_mutable.compare_exchange_strong(success, false)) {
-    // We were the first ones to mark the chunk as immutable. Thus, we have to take care of anything else that needs to
-    // be done. In the future, this can mean to start background statistics generation, encoding, etc.
+    // We were the first ones to mark the chunk as immutable. Thus, the caller has to take care of anything else that
+    // needs to be done, such as indexing the chunk. In the future, this can mean to start background statistics
+    // generation, encoding, etc.
     Assert(success, "Value exchanged but value was actually false.");
-  } else {
-    // Another thread is about to mark this chunk as immutable. Do nothing.
-    Assert(!success, "Value not exchanged but value was actually true.");
+    return true;
   }
+
+  // Another thread is about to mark this chunk as immutable. Do nothing.
+  Assert(!success, "Value not exchanged but value was actually true.");
+  return false;
 }
 
 }  // namespace hyrise
@@ -4,6 +4,7 @@
 #include <atomic>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
@@ -24,7 +25,9 @@ namespace hyrise {
 
 class AbstractChunkIndex;
 class AbstractSegment;
+class AbstractSegmentLoader;
 class BaseAttributeStatistics;
+class ColumnSpan;
 
 using Segments = pmr_vector<std::shared_ptr<AbstractSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractChunkIndex>>;
@@ -55,6 +58,11 @@ class Chunk : private Noncopyable {
   Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data = nullptr,
         const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt, Indexes indexes = {});
 
+  // Creates a chunk whose segments are created by the segment loader when they are accessed for the first time (see
+  // AbstractSegmentLoader). As rows cannot be appended to such a chunk, it has to be set immutable by its creator.
+  Chunk(const ColumnCount column_count, const std::shared_ptr<AbstractSegmentLoader>& segment_loader,
+        const std::shared_ptr<MvccData>& mvcc_data = nullptr);
+
   // Returns whether new rows can be appended to this chunk. Chunks are set immutable during `set_immutable().
   bool is_mutable() const;
 
@@ -71,12 +79,18 @@ class Chunk : private Noncopyable {
   // for testing purposes only.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Adds the rows [offset, offset + row_count) of the given columns to the chunk. The rows are visible to all
+  // transactions. Not thread-safe, see Table::append_columns().
+  void append_columns(const std::vector<ColumnSpan>& columns, const size_t offset, const ChunkOffset row_count);
+
   /**
    * Atomically accesses and returns the segment at a given position.
    *
    * Note: Concurrently with the execution of operators, ValueSegments might be exchanged with encoded segments. Thus,
    *       if you hold a pointer to a segment, you can continue to use it without any inconsistencies. However, if you
    *       call `get_segment again`, be aware that the returned object might have changed.
+   *
+   * For chunks with a segment loader, the segment is loaded on the first access.
    */
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
@@ -93,6 +107,8 @@ class Chunk : private Noncopyable {
   std::shared_ptr<AbstractChunkIndex> get_index(const ChunkIndexType index_type,
                                                 const std::vector<ColumnID>& column_ids) const;
 
+  bool has_indexes() const;
+
   template <typename Index>
   std::shared_ptr<AbstractChunkIndex> create_index(
       const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index) {
@@ -122,6 +138,10 @@ class Chunk : private Noncopyable {
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  // Returns the NUMA node the chunk's segments were allocated on (see NumaMemoryResource) or INVALID_NODE_ID if they
+  // were not allocated on a specific node. Operators use it to process the chunk on the node that holds its data.
+  NodeID node_id() const;
+
   /**
    * To perform Chunk pruning, a Chunk can be associated with statistics.
    * @{
@@ -187,17 +207,30 @@ class Chunk : private Noncopyable {
    * Insert operators indicate that the chunk is full when appending a new chunk to the table. From this moment on, the
    * former last chunk can be marked as immutable as soon as all pending Inserts commit or roll back and try to mark the
    * chunks they interted into. If there are no pending Inserts, i.e., the chunk was filled to its target size and all
-   * Inserts are committed/rolled back, the chunk is immediately marked.
+   * Inserts are committed/rolled back, the chunk is immediately marked. `try_set_immutable()` returns whether the call
+   * marked the chunk as immutable. If so, the caller is responsible for adding the chunk to the table's indexes (see
+   * `Table::add_chunk_to_table_indexes()`).
    */
   void mark_as_full();
-  void try_set_immutable();
+  bool try_set_immutable();
+
+  // Returns whether an Insert operator marked the chunk as full, i.e., whether no further rows are appended to it.
+  bool is_marked_as_full() const;
 
  private:
   std::vector<std::shared_ptr<const AbstractSegment>> _get_segments_for_ids(
       const std::vector<ColumnID>& column_ids) const;
 
+  std::shared_ptr<AbstractSegment> _load_segment(const ColumnID column_id) const;
+
   PolymorphicAllocator<Chunk> _alloc;
-  Segments _segments;
+
+  // Segments that have not been loaded yet are nullptr (see AbstractSegmentLoader). They are mutable, as get_segment()
+  // stores loaded segments.
+  mutable Segments _segments;
+  std::shared_ptr<AbstractSegmentLoader> _segment_loader;
+  mutable std::mutex _segment_loader_mutex;
+
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
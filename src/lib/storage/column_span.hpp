@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+/**
+ * Non-owning view on the typed values of a column that are appended to a table in bulk (see Table::append_columns()).
+ * In contrast to appending rows of AllTypeVariants, the values are neither boxed nor dispatched per value. The data
+ * type is erased so that spans of different columns can be passed together.
+ *
+ * `null_values` is either empty, i.e., no value is NULL, or holds one entry per value that is true for NULLs. Values
+ * at NULL positions are copied but ignored.
+ */
+class ColumnSpan {
+ public:
+  template <std::ranges::contiguous_range Values>
+  explicit ColumnSpan(const Values& values, const std::span<const bool> null_values = {})
+      : _data_type{data_type_from_type<std::ranges::range_value_t<Values>>()},
+        _values{std::ranges::data(values)},
+        _size{std::ranges::size(values)},
+        _null_values{null_values} {
+    Assert(null_values.empty() || null_values.size() == _size, "Expected one NULL flag per value.");
+  }
+
+  DataType data_type() const {
+    return _data_type;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  template <typename T>
+  std::span<const T> values() const {
+    DebugAssert(data_type_from_type<T>() == _data_type, "Requested type does not match the column's data type.");
+    return {static_cast<const T*>(_values), _size};
+  }
+
+  std::span<const bool> null_values() const {
+    return _null_values;
+  }
+
+ private:
+  DataType _data_type;
+  const void* _values;
+  size_t _size;
+  std::span<const bool> _null_values;
+};
+
+}  // namespace hyrise
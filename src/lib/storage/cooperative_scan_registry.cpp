@@ -0,0 +1,41 @@
+#include "cooperative_scan_registry.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+ChunkID CooperativeScanCursor::position() const {
+  return ChunkID{_position.load(std::memory_order_relaxed)};
+}
+
+void CooperativeScanCursor::advance(const ChunkID chunk_id) {
+  // Scans that run in parallel advance the cursor concurrently. We do not care which one wins, as the attached scans
+  // only use the position to start somewhere close to the others.
+  _position.store(chunk_id, std::memory_order_relaxed);
+}
+
+CooperativeScanRegistry& CooperativeScanRegistry::operator=(
+    CooperativeScanRegistry&& cooperative_scan_registry) noexcept {
+  _cursors = std::move(cooperative_scan_registry._cursors);
+  return *this;
+}
+
+std::shared_ptr<CooperativeScanCursor> CooperativeScanRegistry::attach(const std::string& table_name) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  auto& cursor = _cursors[table_name];
+  if (auto ongoing_cursor = cursor.lock()) {
+    return ongoing_cursor;
+  }
+
+  // No scan of the table is running. Start a new circular scan.
+  auto new_cursor = std::make_shared<CooperativeScanCursor>();
+  cursor = new_cursor;
+  return new_cursor;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Shared position of the scans that concurrently read a stored table (see CooperativeScanRegistry).
+ */
+class CooperativeScanCursor : private Noncopyable {
+ public:
+  // ChunkID of the stored table that one of the attached scans started to scan most recently.
+  ChunkID position() const;
+  void advance(const ChunkID chunk_id);
+
+ private:
+  std::atomic<ChunkID::base_type> _position{0};
+};
+
+/**
+ * When many queries concurrently scan the same large table, each scan would read all chunks from memory on its own.
+ * With cooperative scans, the scans of a stored table share a circular scan instead: A scan attaches to the ongoing
+ * circular scan of the table and starts at its current position, i.e., at the chunk that the other scans currently
+ * read. It proceeds to the end of the table, wraps around, and stops before its first chunk. Every scan evaluates its
+ * own predicate, but as the scans read the same chunks at roughly the same time, the chunks are likely still cached
+ * when the next scan reads them. Chunks are thus loaded from memory once for all attached scans instead of once per
+ * scan, which matters most for tables that exceed the last-level cache.
+ *
+ * A circular scan ends when its last scan is done, i.e., when the last reference to its cursor is released. A scan
+ * that starts afterwards starts a new circular scan at the first chunk.
+ */
+class CooperativeScanRegistry : public Noncopyable {
+ public:
+  // Attaches a scan to the circular scan of the given stored table. The scan is attached until it releases the cursor.
+  std::shared_ptr<CooperativeScanCursor> attach(const std::string& table_name);
+
+ protected:
+  friend class Hyrise;
+
+  CooperativeScanRegistry() = default;
+  CooperativeScanRegistry& operator=(CooperativeScanRegistry&& cooperative_scan_registry) noexcept;
+
+ private:
+  std::mutex _mutex;
+  std::unordered_map<std::string, std::weak_ptr<CooperativeScanCursor>> _cursors;
+};
+
+}  // namespace hyrise
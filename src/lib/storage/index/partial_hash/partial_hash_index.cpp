@@ -1,6 +1,8 @@
 #include "partial_hash_index.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -22,17 +24,43 @@ PartialHashIndex::PartialHashIndex(const std::vector<std::pair<ChunkID, std::sha
                                    const ColumnID column_id)
     : _column_id{column_id} {
   Assert(!chunks_to_index.empty(), "PartialHashIndex requires chunks_to_index not to be empty.");
-  resolve_data_type(chunks_to_index.front().second->get_segment(column_id)->data_type(),
-                    [&](const auto column_data_type) {
-                      using ColumnDataType = typename decltype(column_data_type)::type;
-                      _impl = std::make_unique<PartialHashIndexImpl<ColumnDataType>>(chunks_to_index, _column_id);
-                    });
+  _impl = _create_impl(chunks_to_index, _column_id);
 }
 
 size_t PartialHashIndex::insert(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>& chunks_to_index) {
-  // Prevents multiple threads from indexing the same chunk concurrently.
+  auto new_chunks = std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>{};
+  {
+    const auto lock = std::shared_lock<std::shared_mutex>{_data_access_mutex};
+    const auto indexed_chunk_ids = _impl->get_indexed_chunk_ids();
+    std::copy_if(chunks_to_index.cbegin(), chunks_to_index.cend(), std::back_inserter(new_chunks),
+                 [&](const auto& chunk) {
+                   return !indexed_chunk_ids.contains(chunk.first);
+                 });
+  }
+
+  if (new_chunks.empty()) {
+    return 0;
+  }
+
+  // Building the entries of the new chunks is the expensive part. We do it without holding the lock so that concurrent
+  // lookups are only blocked while merging the entries.
+  auto new_entries = _create_impl(new_chunks, _column_id);
+
+  // Prevents multiple threads from modifying the index concurrently. If another thread indexed some of the chunks in
+  // the meantime, merge() skips them.
   const auto lock = std::lock_guard<std::shared_mutex>{_data_access_mutex};
-  return _impl->insert(chunks_to_index, _column_id);
+  return _impl->merge(std::move(*new_entries));
+}
+
+std::unique_ptr<BasePartialHashIndexImpl> PartialHashIndex::_create_impl(
+    const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>& chunks_to_index, const ColumnID column_id) {
+  auto impl = std::unique_ptr<BasePartialHashIndexImpl>{};
+  resolve_data_type(chunks_to_index.front().second->get_segment(column_id)->data_type(),
+                    [&](const auto column_data_type) {
+                      using ColumnDataType = typename decltype(column_data_type)::type;
+                      impl = std::make_unique<PartialHashIndexImpl<ColumnDataType>>(chunks_to_index, column_id);
+                    });
+  return impl;
 }
 
 size_t PartialHashIndex::remove(const std::vector<ChunkID>& chunks_to_remove) {
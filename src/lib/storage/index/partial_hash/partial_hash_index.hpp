@@ -94,7 +94,8 @@ class PartialHashIndex {
 
   /**
    * Inserts entries for the given chunks into this index. If index entries already exist for a given chunk, entries
-   * for that chunk are not inserted again.
+   * for that chunk are not inserted again. The entries are built without blocking concurrent readers, which are only
+   * blocked while the entries are merged into the index.
    *
    * @return The number of chunks for which index entries were inserted.
    */
@@ -143,6 +144,9 @@ class PartialHashIndex {
 
   IteratorRangePair _range_not_equals(const AllTypeVariant& value) const;
 
+  static std::unique_ptr<BasePartialHashIndexImpl> _create_impl(
+      const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>& chunks_to_index, const ColumnID column_id);
+
   /**
    * Concurrent index modifications or simultaneous access and modification would lead to data races. To prevent this,
    * we first tried to use concurrent data structures (namely tbb::concurrent_hash_map, tbb::concurrent_vector,
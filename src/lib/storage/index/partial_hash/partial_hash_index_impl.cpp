@@ -13,6 +13,7 @@
 #include "storage/index/partial_hash/flat_map_iterator.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
@@ -51,6 +52,51 @@ size_t PartialHashIndexImpl<DataType>::insert(
   return indexed_chunks;
 }
 
+template <typename DataType>
+size_t PartialHashIndexImpl<DataType>::merge(BasePartialHashIndexImpl&& other) {
+  DebugAssert(dynamic_cast<PartialHashIndexImpl<DataType>*>(&other), "Cannot merge indexes of different data types.");
+  auto& other_impl = static_cast<PartialHashIndexImpl<DataType>&>(other);
+
+  auto new_chunk_ids = std::unordered_set<ChunkID>{};
+  for (const auto chunk_id : other_impl._indexed_chunk_ids) {
+    if (_indexed_chunk_ids.insert(chunk_id).second) {
+      new_chunk_ids.insert(chunk_id);
+    }
+  }
+
+  if (new_chunk_ids.empty()) {
+    return 0;
+  }
+
+  // Usually, none of the chunks was indexed concurrently and we can take over all entries without checking them.
+  const auto skip_indexed_chunks = new_chunk_ids.size() != other_impl._indexed_chunk_ids.size();
+  const auto merge_positions = [&](auto& positions, auto& other_positions) {
+    for (auto other_iter = other_positions.begin(); other_iter != other_positions.end(); ++other_iter) {
+      auto& other_row_ids = other_iter.value();
+      if (skip_indexed_chunks) {
+        std::erase_if(other_row_ids, [&](const auto& row_id) {
+          return !new_chunk_ids.contains(row_id.chunk_id);
+        });
+        if (other_row_ids.empty()) {
+          continue;
+        }
+      }
+
+      auto& row_ids = positions[other_iter->first];
+      if (row_ids.empty()) {
+        row_ids = std::move(other_row_ids);
+      } else {
+        row_ids.insert(row_ids.end(), other_row_ids.cbegin(), other_row_ids.cend());
+      }
+    }
+  };
+
+  merge_positions(_positions, other_impl._positions);
+  merge_positions(_null_positions, other_impl._null_positions);
+
+  return new_chunk_ids.size();
+}
+
 template <typename DataType>
 size_t PartialHashIndexImpl<DataType>::remove(const std::vector<ChunkID>& chunks) {
   const size_t size_before = _indexed_chunk_ids.size();
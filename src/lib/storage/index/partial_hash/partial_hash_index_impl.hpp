@@ -36,6 +36,15 @@ class BasePartialHashIndexImpl : public Noncopyable {
    */
   virtual size_t insert(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>&, const ColumnID) = 0;
 
+  /**
+   * Moves the entries of another index implementation of the same data type into this index. Entries of chunks that
+   * are already indexed are skipped. This allows building the entries for new chunks without blocking concurrent
+   * readers and only merging them while holding the PartialHashIndex's exclusive lock.
+   *
+   * @return The number of added chunks.
+   */
+  virtual size_t merge(BasePartialHashIndexImpl&& other) = 0;
+
   /**
    * Removes the given chunks from this index. If a chunk is not indexed, nothing will happen.
    *
@@ -75,6 +84,7 @@ class PartialHashIndexImpl : public BasePartialHashIndexImpl {
   PartialHashIndexImpl(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>&, const ColumnID);
 
   size_t insert(const std::vector<std::pair<ChunkID, std::shared_ptr<Chunk>>>&, const ColumnID) final;
+  size_t merge(BasePartialHashIndexImpl&& other) final;
   size_t remove(const std::vector<ChunkID>&) final;
 
   bool indexed_null_values() const final;
@@ -0,0 +1,682 @@
+#include "materialized_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/window_function_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_wrapper.hpp"
+#include "optimizer/optimizer.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/lqp_view.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
+
+namespace {
+
+using namespace hyrise;                         // NOLINT(build/namespaces)
+using namespace hyrise::expression_functional;  // NOLINT(build/namespaces)
+
+std::shared_ptr<AbstractOperator> translate_lqp(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  return LQPTranslator{}.translate_node(Optimizer::create_default_optimizer()->optimize(lqp));
+}
+
+std::shared_ptr<const Table> execute_pqp(const std::shared_ptr<AbstractOperator>& pqp) {
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  return root_operator_task->get_operator()->get_output();
+}
+
+std::shared_ptr<Table> make_reference_table(const std::shared_ptr<const Table>& table,
+                                            const std::shared_ptr<RowIDPosList>& row_ids) {
+  auto segments = Segments{};
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, row_ids));
+  }
+
+  auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  reference_table->append_chunk(segments);
+  return reference_table;
+}
+
+void assert_supported_input(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  visit_lqp(lqp, [](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Alias:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::StoredTable:
+        break;
+      case LQPNodeType::Validate:
+        AssertInput(node->left_input()->type == LQPNodeType::StoredTable,
+                    "Materialized views expect the stored tables to be validated directly.");
+        break;
+      case LQPNodeType::Join: {
+        const auto join_mode = static_cast<const JoinNode&>(*node).join_mode;
+        AssertInput(join_mode == JoinMode::Inner || join_mode == JoinMode::Cross,
+                    "Materialized views only support inner joins.");
+      } break;
+      default:
+        FailInput("Materialized views do not support " + node->description() + ".");
+    }
+
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [](const auto& sub_expression) {
+        AssertInput(sub_expression->type != ExpressionType::LQPSubquery,
+                    "Materialized views do not support subqueries.");
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+AllTypeVariant negate(const AllTypeVariant& value) {
+  if (value.type() == typeid(int64_t)) {
+    return -boost::get<int64_t>(value);
+  }
+  return -boost::get<double>(value);
+}
+
+}  // namespace
+
+namespace hyrise {
+
+MaterializedView::MaterializedView(const std::string& name, const std::shared_ptr<AbstractLQPNode>& lqp)
+    : _name{name}, _table_name{name + "_materialized"} {
+  AssertInput(lqp_is_validated(lqp), "Materialized views require a validated LQP.");
+
+  // Column names of the view, see SQLTranslator::_translate_create_view().
+  auto column_names = std::unordered_map<ColumnID, std::string>{};
+  const auto output_expressions = lqp->output_expressions();
+  const auto output_expression_count = output_expressions.size();
+  for (auto column_id = ColumnID{0}; column_id < output_expression_count; ++column_id) {
+    column_names.emplace(column_id, lqp->type == LQPNodeType::Alias
+                                        ? static_cast<const AliasNode&>(*lqp).aliases[column_id]
+                                        : output_expressions[column_id]->as_column_name());
+  }
+  _lqp_view = std::make_shared<LQPView>(lqp->deep_copy(), column_names);
+
+  // Find the aggregate. The view may only project and rename its output.
+  auto node = lqp;
+  while (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Alias) {
+    node = node->left_input();
+  }
+  AssertInput(node->type == LQPNodeType::Aggregate, "Materialized views must aggregate their input.");
+  _aggregate_node = std::static_pointer_cast<AggregateNode>(node->deep_copy());
+  assert_supported_input(_aggregate_node->left_input());
+
+  const auto& aggregate_input = *_aggregate_node->left_input();
+  const auto group_by_count = _aggregate_node->aggregate_expressions_begin_idx;
+  const auto& node_expressions = _aggregate_node->node_expressions;
+  const auto column_count = node_expressions.size();
+  for (auto column_id = ColumnID{static_cast<ColumnID::base_type>(group_by_count)}; column_id < column_count;
+       ++column_id) {
+    const auto& aggregate = static_cast<const WindowFunctionExpression&>(*node_expressions[column_id]);
+    if (aggregate.window_function == WindowFunction::Sum) {
+      AssertInput(!aggregate.argument()->is_nullable_on_lqp(aggregate_input),
+                  "Materialized views only support SUM of non-nullable expressions.");
+    } else {
+      AssertInput(aggregate.window_function == WindowFunction::Count,
+                  "Materialized views only support SUM, COUNT, and COUNT(*).");
+    }
+
+    if (_row_count_column_id == INVALID_COLUMN_ID && WindowFunctionExpression::is_count_star(aggregate)) {
+      _row_count_column_id = column_id;
+    }
+  }
+
+  // Resolve the tables that the view reads.
+  visit_lqp(_aggregate_node, [&](const auto& input_node) {
+    if (input_node->type != LQPNodeType::StoredTable) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& table_name = static_cast<const StoredTableNode&>(*input_node).table_name;
+    for (const auto& [base_table_name, base_table] : _base_tables) {
+      AssertInput(base_table_name != table_name, "Materialized views must read each table only once.");
+    }
+    _base_tables.emplace_back(table_name, Hyrise::get().storage_manager.get_table(table_name));
+    return LQPVisitation::DoNotVisitInputs;
+  });
+
+  // Count the rows of each group if the view does not do so already.
+  _partial_aggregate_node = std::static_pointer_cast<AggregateNode>(_aggregate_node->deep_copy());
+  if (_row_count_column_id == INVALID_COLUMN_ID) {
+    _row_count_column_id = ColumnID{static_cast<ColumnID::base_type>(column_count)};
+    _partial_aggregate_node->node_expressions.emplace_back(count_star_(lqp_find_leaves(_partial_aggregate_node)[0]));
+  }
+
+  // The view's table stores the group-by columns followed by the partial aggregates.
+  auto column_definitions = TableColumnDefinitions{};
+  const auto& partial_aggregate_expressions = _partial_aggregate_node->node_expressions;
+  for (auto column_id = size_t{0}; column_id < partial_aggregate_expressions.size(); ++column_id) {
+    const auto& expression = partial_aggregate_expressions[column_id];
+    if (column_id == _row_count_column_id) {
+      column_definitions.emplace_back(ROW_COUNT_COLUMN_NAME, DataType::Long, false);
+    } else if (column_id < group_by_count) {
+      column_definitions.emplace_back(expression->as_column_name(), expression->data_type(),
+                                      expression->is_nullable_on_lqp(*_partial_aggregate_node));
+    } else {
+      column_definitions.emplace_back(expression->as_column_name(), expression->data_type(), false);
+    }
+  }
+  _table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+}
+
+const std::string& MaterializedView::name() const {
+  return _name;
+}
+
+const std::string& MaterializedView::table_name() const {
+  return _table_name;
+}
+
+const std::shared_ptr<Table>& MaterializedView::table() const {
+  return _table;
+}
+
+const std::shared_ptr<LQPView>& MaterializedView::lqp_view() const {
+  return _lqp_view;
+}
+
+const std::shared_ptr<AggregateNode>& MaterializedView::aggregate_node() const {
+  return _aggregate_node;
+}
+
+std::shared_ptr<AbstractLQPNode> MaterializedView::make_lqp() const {
+  const auto stored_table_node = StoredTableNode::make(_table_name);
+
+  const auto group_by_count = _aggregate_node->aggregate_expressions_begin_idx;
+  const auto column_count = _aggregate_node->node_expressions.size();
+
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_id = ColumnID{0}; column_id < group_by_count; ++column_id) {
+    group_by_expressions.emplace_back(lqp_column_(stored_table_node, column_id));
+  }
+
+  // Sum up the partial aggregates of each group.
+  auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_id = ColumnID{static_cast<ColumnID::base_type>(group_by_count)}; column_id < column_count;
+       ++column_id) {
+    aggregate_expressions.emplace_back(sum_(lqp_column_(stored_table_node, column_id)));
+  }
+
+  const auto row_count = sum_(lqp_column_(stored_table_node, _row_count_column_id));
+  if (_row_count_column_id == column_count) {
+    aggregate_expressions.emplace_back(row_count);
+  }
+
+  auto lqp = std::shared_ptr<AbstractLQPNode>{
+      AggregateNode::make(group_by_expressions, aggregate_expressions, ValidateNode::make(stored_table_node))};
+  auto output_expressions = group_by_expressions;
+  if (group_by_count > 0) {
+    // Groups whose rows were all deleted are not part of the result.
+    lqp = PredicateNode::make(greater_than_(row_count, value_(int64_t{0})), lqp);
+    output_expressions.insert(output_expressions.end(), aggregate_expressions.begin(),
+                              aggregate_expressions.begin() + static_cast<std::ptrdiff_t>(column_count));
+  } else {
+    // Without GROUP BY, the view's table always holds a row, so that COUNT returns zero for empty inputs. SUM, however,
+    // has to return NULL in this case.
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto& aggregate =
+          static_cast<const WindowFunctionExpression&>(*_aggregate_node->node_expressions[column_id]);
+      if (aggregate.window_function == WindowFunction::Sum) {
+        output_expressions.emplace_back(
+            case_(greater_than_(row_count, value_(int64_t{0})), aggregate_expressions[column_id], null_()));
+      } else {
+        output_expressions.emplace_back(aggregate_expressions[column_id]);
+      }
+    }
+  }
+
+  return ProjectionNode::make(output_expressions, lqp);
+}
+
+bool MaterializedView::reads_table(const std::shared_ptr<const Table>& table) const {
+  for (const auto& [base_table_name, base_table] : _base_tables) {
+    if (base_table.lock() == table) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MaterializedView::is_populated() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _is_populated;
+}
+
+bool MaterializedView::covers_snapshot(const CommitID snapshot_commit_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _is_populated && snapshot_commit_id >= _population_commit_id &&
+         (_pending_changes.empty() || _pending_changes.begin()->first > snapshot_commit_id);
+}
+
+void MaterializedView::populate() {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  // Modifications that obtain a commit ID from now on pass their changes to the view (see commit_changes()), as the
+  // view is already registered. We wait for the transactions with earlier commit IDs so that the snapshot includes
+  // their changes.
+  transaction_manager.wait_for_commit(transaction_manager.last_assigned_commit_id());
+  const auto transaction_context = transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto pqp = translate_lqp(_partial_aggregate_node->deep_copy());
+  pqp->set_transaction_context_recursively(transaction_context);
+  const auto partial_aggregates = execute_pqp(pqp);
+  transaction_context->commit();
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _population_commit_id = snapshot_commit_id;
+  _append(*partial_aggregates, snapshot_commit_id, ChangeType::Insert, false);
+  _is_populated = true;
+  for (const auto& buffered_changes : _buffered_changes) {
+    _append_changes(buffered_changes.partial_aggregates, buffered_changes.commit_id, buffered_changes.change_type);
+  }
+  _buffered_changes.clear();
+
+  _table->set_table_statistics(TableStatistics::from_table(*_table));
+}
+
+std::shared_ptr<const Table> MaterializedView::compute_partial_aggregates(
+    const std::shared_ptr<const Table>& table, const std::shared_ptr<RowIDPosList>& row_ids) const {
+  if (_base_tables.size() > 1) {
+    return nullptr;
+  }
+
+  return _compute_partial_aggregates(table, row_ids, MvccData::MAX_COMMIT_ID);
+}
+
+void MaterializedView::commit_changes(const std::shared_ptr<const Table>& table,
+                                      const std::shared_ptr<RowIDPosList>& row_ids, const ChangeType change_type,
+                                      const CommitID commit_id,
+                                      const std::shared_ptr<const Table>& partial_aggregates) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (partial_aggregates) {
+    _append_changes(partial_aggregates, commit_id, change_type);
+  } else {
+    _pending_changes[commit_id].changes.emplace_back(PendingChange{table, row_ids, change_type});
+  }
+
+  if (_compaction) {
+    _complete_compaction(commit_id);
+  }
+}
+
+void MaterializedView::apply_pending_changes() {
+  // Changes of commits that are not published yet are applied by the operators of later transactions. As commits are
+  // published in order, the other tables are readable as of the published commits.
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  while (true) {
+    auto commit_id = CommitID{0};
+    auto changes = std::vector<PendingChange>{};
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      for (auto& [pending_commit_id, pending_changes] : _pending_changes) {
+        if (pending_commit_id > last_commit_id) {
+          break;
+        }
+
+        if (!pending_changes.is_being_applied) {
+          pending_changes.is_being_applied = true;
+          commit_id = pending_commit_id;
+          changes = pending_changes.changes;
+          break;
+        }
+      }
+    }
+
+    if (changes.empty()) {
+      break;
+    }
+
+    auto partial_aggregates = std::vector<std::shared_ptr<const Table>>{};
+    partial_aggregates.reserve(changes.size());
+    for (const auto& change : changes) {
+      partial_aggregates.emplace_back(_compute_partial_aggregates(change.table, change.row_ids, commit_id));
+    }
+
+    // The partial aggregates are appended with the commit ID of the published commit. No snapshot has used the view
+    // for this commit, as it was pending until now.
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    const auto change_count = changes.size();
+    for (auto change_id = size_t{0}; change_id < change_count; ++change_id) {
+      _append_changes(partial_aggregates[change_id], commit_id, changes[change_id].change_type);
+    }
+    _pending_changes.erase(commit_id);
+  }
+
+  _prepare_compaction();
+}
+
+std::shared_ptr<const Table> MaterializedView::_compute_partial_aggregates(
+    const std::shared_ptr<const Table>& table, const std::shared_ptr<RowIDPosList>& row_ids,
+    const CommitID commit_id) const {
+  auto changed_table_id = _base_tables.size();
+  auto changed_table_name = std::string{};
+  for (auto table_id = size_t{0}; table_id < _base_tables.size(); ++table_id) {
+    if (_base_tables[table_id].second.lock() == table) {
+      changed_table_id = table_id;
+      changed_table_name = _base_tables[table_id].first;
+    }
+  }
+  Assert(changed_table_id < _base_tables.size(), "Changed table is not read by materialized view " + _name + ".");
+
+  // Replace the modified table (and its ValidateNode) with the changed rows.
+  const auto lqp = _partial_aggregate_node->deep_copy();
+  const auto static_table_node = StaticTableNode::make(make_reference_table(table, row_ids));
+  auto validate_node = std::shared_ptr<AbstractLQPNode>{};
+  auto stored_table_node = std::shared_ptr<AbstractLQPNode>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Validate) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    if (static_cast<const StoredTableNode&>(*node->left_input()).table_name == changed_table_name) {
+      validate_node = node;
+      stored_table_node = node->left_input();
+    }
+    return LQPVisitation::DoNotVisitInputs;
+  });
+
+  const auto outputs = validate_node->outputs();
+  const auto input_sides = validate_node->get_input_sides();
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], static_table_node);
+  }
+
+  auto column_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    column_mapping.emplace(lqp_column_(stored_table_node, column_id), lqp_column_(static_table_node, column_id));
+  }
+  column_mapping.emplace(lqp_column_(stored_table_node, INVALID_COLUMN_ID),
+                         lqp_column_(static_table_node, INVALID_COLUMN_ID));
+
+  visit_lqp(lqp, [&](const auto& node) {
+    for (auto& expression : node->node_expressions) {
+      expression_deep_replace(expression, column_mapping);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  const auto pqp = translate_lqp(lqp);
+  if (_base_tables.size() == 1) {
+    return execute_pqp(pqp);
+  }
+
+  // Read the tables that precede the changed table in the view's query as of the commit, and the following tables as of
+  // the preceding commit. The transaction ID is not used by any transaction, so that uncommitted rows remain invisible.
+  const auto transaction_id = TransactionID{std::numeric_limits<TransactionID::base_type>::max()};
+  const auto transaction_context = std::make_shared<TransactionContext>(transaction_id, commit_id, AutoCommit::No);
+  const auto previous_transaction_context =
+      std::make_shared<TransactionContext>(transaction_id, CommitID{commit_id - 1}, AutoCommit::No);
+  visit_pqp(pqp, [&](const auto& op) {
+    if (op->type() != OperatorType::Validate) {
+      return PQPVisitation::VisitInputs;
+    }
+
+    // The optimizer only pushes operators of the validated table below the Validate.
+    auto input = op->left_input();
+    while (input->type() != OperatorType::GetTable) {
+      input = input->left_input();
+    }
+
+    const auto& table_name = static_cast<const GetTable&>(*input).table_name();
+    auto table_id = size_t{0};
+    while (_base_tables[table_id].first != table_name) {
+      ++table_id;
+    }
+    op->set_transaction_context(table_id < changed_table_id ? transaction_context : previous_transaction_context);
+    return PQPVisitation::VisitInputs;
+  });
+
+  return execute_pqp(pqp);
+}
+
+void MaterializedView::_append_changes(const std::shared_ptr<const Table>& partial_aggregates,
+                                       const CommitID commit_id, const ChangeType change_type) {
+  if (!_is_populated) {
+    _buffered_changes.emplace_back(BufferedChanges{partial_aggregates, commit_id, change_type});
+    return;
+  }
+
+  if (commit_id <= _population_commit_id) {
+    return;
+  }
+
+  _append(*partial_aggregates, commit_id, change_type, true);
+}
+
+void MaterializedView::_append(const Table& partial_aggregates, const CommitID commit_id,
+                               const ChangeType change_type, const bool skip_empty_groups) {
+  const auto group_by_count = _aggregate_node->aggregate_expressions_begin_idx;
+  const auto& column_definitions = _table->column_definitions();
+  const auto column_count = column_definitions.size();
+
+  auto chunks = Table{column_definitions, TableType::Data, _table->target_chunk_size()};
+  for (auto row : partial_aggregates.get_rows()) {
+    if (skip_empty_groups && boost::get<int64_t>(row[_row_count_column_id]) == 0) {
+      continue;
+    }
+
+    for (auto column_id = group_by_count; column_id < column_count; ++column_id) {
+      auto& value = row[column_id];
+      // SUM is NULL if there are no rows to aggregate, which only happens without GROUP BY.
+      if (variant_is_null(value)) {
+        value = column_definitions[column_id].data_type == DataType::Long ? AllTypeVariant{int64_t{0}}
+                                                                          : AllTypeVariant{0.0};
+      }
+
+      if (change_type == ChangeType::Delete) {
+        value = negate(value);
+      }
+    }
+    chunks.append(row);
+  }
+
+  const auto chunk_count = chunks.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = chunks.get_chunk(chunk_id);
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+
+    _table->append_chunk(segments, std::make_shared<MvccData>(chunk->size(), commit_id));
+    _table->last_chunk()->set_immutable();
+    ++_appended_chunk_count;
+  }
+
+  // Cached results of queries that read the view are outdated (see ResultCache).
+  if (chunk_count > 0) {
+    _table->update_last_commit_id(commit_id);
+  }
+}
+
+void MaterializedView::_prepare_compaction() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (!_is_populated || _is_compacting || _appended_chunk_count < COMPACTION_INTERVAL) {
+      return;
+    }
+    _is_compacting = true;
+    _appended_chunk_count = 0;
+  }
+
+  // Collect the partial aggregates of published commits. Only compactions invalidate rows, so the collected rows remain
+  // valid until _complete_compaction() replaces them. Rows that are appended meanwhile are consolidated by a later
+  // compaction.
+  const auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto last_commit_id = transaction_manager.last_commit_id();
+  auto row_ids = std::make_shared<RowIDPosList>();
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) <= last_commit_id &&
+          mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) {
+        row_ids->emplace_back(chunk_id, chunk_offset);
+      }
+    }
+  }
+
+  // Remove the chunks whose rows are invisible for all active and future transactions.
+  const auto lowest_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (!chunk || chunk->invalid_row_count() < chunk->size()) {
+      continue;
+    }
+
+    const auto max_end_cid = chunk->mvcc_data()->max_end_cid.load();
+    if (max_end_cid <= last_commit_id && (!lowest_snapshot_commit_id || max_end_cid <= *lowest_snapshot_commit_id)) {
+      _table->remove_chunk(chunk_id);
+    }
+  }
+
+  if (row_ids->empty()) {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _is_compacting = false;
+    return;
+  }
+
+  const auto& column_definitions = _table->column_definitions();
+  const auto column_count = column_definitions.size();
+  const auto group_by_count = _aggregate_node->aggregate_expressions_begin_idx;
+
+  auto group_by_column_ids = std::vector<ColumnID>{};
+  auto aggregates = std::vector<std::shared_ptr<WindowFunctionExpression>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (column_id < group_by_count) {
+      group_by_column_ids.emplace_back(column_id);
+      continue;
+    }
+
+    const auto& column_definition = column_definitions[column_id];
+    aggregates.emplace_back(sum_(pqp_column_(column_id, column_definition.data_type, column_definition.nullable,
+                                             column_definition.name)));
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(make_reference_table(_table, row_ids));
+  table_wrapper->execute();
+  const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, group_by_column_ids);
+  aggregate->execute();
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _compaction = Compaction{aggregate->get_output(), row_ids};
+}
+
+void MaterializedView::_complete_compaction(const CommitID commit_id) {
+  // Without GROUP BY, the consolidated row is kept even if no rows are left (see make_lqp()).
+  const auto group_by_count = _aggregate_node->aggregate_expressions_begin_idx;
+  _append(*_compaction->partial_aggregates, commit_id, ChangeType::Insert, group_by_count > 0);
+
+  // Invalidate the consolidated rows. Like Delete, update max_end_cid before invalid_row_count.
+  for (const auto& row_id : *_compaction->row_ids) {
+    const auto chunk = _table->get_chunk(row_id.chunk_id);
+    const auto& mvcc_data = chunk->mvcc_data();
+    mvcc_data->set_end_cid(row_id.chunk_offset, commit_id);
+    set_atomic_max(mvcc_data->max_end_cid, commit_id);
+    chunk->increase_invalid_row_count(ChunkOffset{1});
+  }
+
+  _compaction.reset();
+  _is_compacting = false;
+}
+
+MaterializedViewChanges::MaterializedViewChanges(const std::shared_ptr<const Table>& table,
+                                                 const MaterializedView::ChangeType change_type,
+                                                 const RowIDsFunction& row_ids_function)
+    : _table{table}, _change_type{change_type}, _row_ids_function{row_ids_function} {
+  for (const auto& [materialized_view_name, materialized_view] : Hyrise::get().storage_manager.materialized_views()) {
+    if (!materialized_view->reads_table(_table)) {
+      continue;
+    }
+
+    const auto row_ids = _get_row_ids();
+    if (row_ids->empty()) {
+      return;
+    }
+    _partial_aggregates.emplace_back(materialized_view,
+                                     materialized_view->compute_partial_aggregates(_table, row_ids));
+  }
+}
+
+void MaterializedViewChanges::commit(const CommitID commit_id) {
+  for (const auto& [materialized_view_name, materialized_view] : Hyrise::get().storage_manager.materialized_views()) {
+    if (!materialized_view->reads_table(_table)) {
+      continue;
+    }
+
+    const auto row_ids = _get_row_ids();
+    if (row_ids->empty()) {
+      return;
+    }
+
+    auto partial_aggregates = std::shared_ptr<const Table>{};
+    for (const auto& [computed_materialized_view, computed_partial_aggregates] : _partial_aggregates) {
+      if (computed_materialized_view == materialized_view) {
+        partial_aggregates = computed_partial_aggregates;
+      }
+    }
+    materialized_view->commit_changes(_table, row_ids, _change_type, commit_id, partial_aggregates);
+    _committed_materialized_views.emplace_back(materialized_view);
+  }
+}
+
+void MaterializedViewChanges::finalize() const {
+  for (const auto& materialized_view : _committed_materialized_views) {
+    materialized_view->apply_pending_changes();
+  }
+}
+
+std::shared_ptr<RowIDPosList> MaterializedViewChanges::_get_row_ids() {
+  if (!_row_ids) {
+    _row_ids = _row_ids_function();
+  }
+  return _row_ids;
+}
+
+}  // namespace hyrise
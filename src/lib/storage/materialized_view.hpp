@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+class AggregateNode;
+class LQPView;
+class Table;
+
+/**
+ * A MaterializedView stores the result of a select-project-join-aggregate (SPJA) query and maintains it incrementally
+ * when the tables that the query reads are modified. Queries that contain the view's aggregate are rewritten to read
+ * the stored result instead (see MaterializedViewRule). Furthermore, the StorageManager registers an LQPView
+ * with the view's name, so that the view can be queried directly (e.g., SELECT * FROM view_name).
+ *
+ * Supported queries: The query has to aggregate (i.e., its root is an AggregateNode, optionally followed by
+ * projections and aliases) the result of selections, projections, and inner joins of stored tables. Each table may
+ * only be read once. Only SUM (of non-nullable expressions), COUNT, and COUNT(*) are supported, as these can be
+ * maintained from the changed rows alone. MIN and MAX would require the remaining rows once the minimum or maximum is
+ * deleted, AVG can be expressed as SUM / COUNT.
+ *
+ * Storage: The view's table stores partial aggregates, i.e., the aggregates of disjoint sets of rows, together with the
+ * number of aggregated rows (__row_count). The result of the view is obtained by summing up the partial aggregates per
+ * group, which only touches the (usually few) groups instead of the base tables (see make_lqp()). Groups whose row
+ * count becomes zero are removed.
+ *
+ * Maintenance: Insert, Delete, and PointUpdate pass the rows that they modify in tables that the view reads (see
+ * MaterializedViewChanges). When the operator is executed, the view evaluates its query with the changed rows instead
+ * of the modified table. When the transaction commits, the resulting partial aggregates (negated for deleted rows) are
+ * appended to the view's table. The appended rows become visible with the commit ID of the modifying transaction, so
+ * that the view is consistent with the base tables for each snapshot. Committing does not execute any query, so that it
+ * does not delay the commits of other transactions.
+ *
+ * Joins: The partial aggregates of changed rows that are joined with other tables depend on these tables as of the
+ * commit. Thus, committing only records the changes as pending, and they are applied once the transaction's commit is
+ * published (see apply_pending_changes()). The changes of a table are joined with the tables that precede it in the
+ * view's query as of the commit and with the following tables as of the preceding commit, so that the changes of a
+ * transaction that modifies multiple tables are joined with each other exactly once. The view cannot be used for
+ * snapshots that include pending changes (see covers_snapshot()). With asynchronous commits, the commit might not be
+ * published when the transaction's operators are finalized. Its changes are then applied by a later modification.
+ *
+ * Compaction: Every COMPACTION_INTERVAL appended chunks, the partial aggregates are consolidated into a single row per
+ * group. The consolidated rows are computed outside of the commit window and replace the original rows with the commit
+ * ID of the next transaction that modifies a table that the view reads.
+ *
+ * Limitations: Snapshots taken before the view was populated cannot use the view. As the view only reflects committed
+ * modifications, transactions that are not auto-committed do not use it (see MaterializedViewRule).
+ */
+class MaterializedView : public Noncopyable {
+ public:
+  enum class ChangeType { Insert, Delete };
+
+  static constexpr auto COMPACTION_INTERVAL = uint32_t{32};
+
+  static constexpr auto ROW_COUNT_COLUMN_NAME = "__row_count";
+
+  // @param lqp is the unoptimized and validated LQP of the view's query, as translated by the SQLTranslator.
+  MaterializedView(const std::string& name, const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  const std::string& name() const;
+
+  // The table that stores the partial aggregates and its name in the StorageManager.
+  const std::string& table_name() const;
+  const std::shared_ptr<Table>& table() const;
+
+  // The LQPView that the StorageManager registers with the view's name.
+  const std::shared_ptr<LQPView>& lqp_view() const;
+
+  // Copy of the AggregateNode of the view's query (including its inputs). Queries with an equal AggregateNode can read
+  // the view instead.
+  const std::shared_ptr<AggregateNode>& aggregate_node() const;
+
+  // Returns a new LQP that computes the output of aggregate_node() from the view's table.
+  std::shared_ptr<AbstractLQPNode> make_lqp() const;
+
+  bool reads_table(const std::shared_ptr<const Table>& table) const;
+  bool is_populated() const;
+
+  // Whether the view reflects all modifications that are visible for the snapshot, i.e., the view was populated before
+  // the snapshot was taken and no changes up to the snapshot are pending.
+  bool covers_snapshot(const CommitID snapshot_commit_id) const;
+
+  // Executes the view's query and stores its result. Called by StorageManager::add_materialized_view() after the view
+  // was registered, so that no modification is missed.
+  void populate();
+
+  /**
+   * Computes the partial aggregates of the changed rows @param row_ids of @param table, a table that the view reads
+   * (see reads_table()). Returns nullptr if the view joins multiple tables, as the partial aggregates then depend on
+   * the other tables as of the commit.
+   */
+  std::shared_ptr<const Table> compute_partial_aggregates(const std::shared_ptr<const Table>& table,
+                                                          const std::shared_ptr<RowIDPosList>& row_ids) const;
+
+  /**
+   * Called when the transaction that changed the rows commits. Appends the @param partial_aggregates that were computed
+   * by compute_partial_aggregates(). Without partial aggregates, the changes are pending until the commit is published
+   * (see apply_pending_changes()).
+   */
+  void commit_changes(const std::shared_ptr<const Table>& table, const std::shared_ptr<RowIDPosList>& row_ids,
+                      const ChangeType change_type, const CommitID commit_id,
+                      const std::shared_ptr<const Table>& partial_aggregates);
+
+  // Applies the pending changes of published commits and prepares a compaction if needed. Called by the modifying
+  // operators after their transaction left the commit window.
+  void apply_pending_changes();
+
+ private:
+  // For views that join multiple tables, the other tables are read as of @param commit_id (see class comment).
+  std::shared_ptr<const Table> _compute_partial_aggregates(const std::shared_ptr<const Table>& table,
+                                                           const std::shared_ptr<RowIDPosList>& row_ids,
+                                                           const CommitID commit_id) const;
+
+  // Appends the partial aggregates unless they are part of the populated result. Buffers them if the view is not
+  // populated yet. Requires _mutex to be locked.
+  void _append_changes(const std::shared_ptr<const Table>& partial_aggregates, const CommitID commit_id,
+                       const ChangeType change_type);
+
+  // Appends the partial aggregates as new chunks that become visible with the given commit ID. The aggregates are
+  // negated if change_type is ChangeType::Delete.
+  void _append(const Table& partial_aggregates, const CommitID commit_id, const ChangeType change_type,
+               const bool skip_empty_groups);
+
+  // Consolidates the partial aggregates of published commits and removes outdated chunks.
+  void _prepare_compaction();
+
+  // Replaces the consolidated partial aggregates with the result of _prepare_compaction(). Requires _mutex to be
+  // locked and @param commit_id to be in the commit window.
+  void _complete_compaction(const CommitID commit_id);
+
+  const std::string _name;
+  const std::string _table_name;
+
+  std::shared_ptr<LQPView> _lqp_view;
+  std::shared_ptr<AggregateNode> _aggregate_node;
+
+  // The view's aggregate with an additional COUNT(*) if the view does not count the rows itself. Computes the partial
+  // aggregates of the view's table.
+  std::shared_ptr<AggregateNode> _partial_aggregate_node;
+  ColumnID _row_count_column_id{INVALID_COLUMN_ID};
+
+  std::shared_ptr<Table> _table;
+  std::vector<std::pair<std::string, std::weak_ptr<const Table>>> _base_tables;
+
+  // Protects the following members and serializes appends to _table.
+  mutable std::mutex _mutex;
+  bool _is_populated{false};
+  CommitID _population_commit_id{0};
+  uint32_t _appended_chunk_count{0};
+
+  // Partial aggregates of modifications that were committed while the view was populated.
+  struct BufferedChanges {
+    std::shared_ptr<const Table> partial_aggregates;
+    CommitID commit_id;
+    ChangeType change_type;
+  };
+
+  std::vector<BufferedChanges> _buffered_changes;
+
+  // Changes of commits whose partial aggregates are not appended yet. The lowest pending commit ID is the view's
+  // watermark: Snapshots below it are covered by the view.
+  struct PendingChange {
+    std::shared_ptr<const Table> table;
+    std::shared_ptr<RowIDPosList> row_ids;
+    ChangeType change_type;
+  };
+
+  struct PendingChanges {
+    std::vector<PendingChange> changes;
+    bool is_being_applied{false};
+  };
+
+  std::map<CommitID, PendingChanges> _pending_changes;
+
+  // Consolidated partial aggregates and the rows that they replace once _complete_compaction() is called.
+  struct Compaction {
+    std::shared_ptr<const Table> partial_aggregates;
+    std::shared_ptr<RowIDPosList> row_ids;
+  };
+
+  bool _is_compacting{false};
+  std::optional<Compaction> _compaction;
+};
+
+/**
+ * The rows that a modifying operator (Insert, Delete, or PointUpdate) inserted into or deleted from a table, passed to
+ * the materialized views that read the table. The partial aggregates of the rows are computed when the object is
+ * created during the operator's execution, so that commit() only appends them.
+ */
+class MaterializedViewChanges {
+ public:
+  using RowIDsFunction = std::function<std::shared_ptr<RowIDPosList>()>;
+
+  // @param row_ids_function returns the changed rows. It is only called if a materialized view reads the table.
+  MaterializedViewChanges(const std::shared_ptr<const Table>& table, const MaterializedView::ChangeType change_type,
+                          const RowIDsFunction& row_ids_function);
+
+  // Called by the operator's _on_commit_records(). Views that were added after the operator was executed receive the
+  // changes as well.
+  void commit(const CommitID commit_id);
+
+  // Called by the operator's _on_finalize_records().
+  void finalize() const;
+
+ private:
+  std::shared_ptr<RowIDPosList> _get_row_ids();
+
+  std::shared_ptr<const Table> _table;
+  MaterializedView::ChangeType _change_type;
+  RowIDsFunction _row_ids_function;
+  std::shared_ptr<RowIDPosList> _row_ids;
+
+  std::vector<std::pair<std::shared_ptr<MaterializedView>, std::shared_ptr<const Table>>> _partial_aggregates;
+  std::vector<std::shared_ptr<MaterializedView>> _committed_materialized_views;
+};
+
+}  // namespace hyrise
@@ -1,17 +1,20 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <ostream>
+#include <vector>
 
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
 #include "utils/copyable_atomic.hpp"
 
 namespace hyrise {
 
-MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
+MvccData::MvccData(const size_t size, CommitID begin_commit_id) : min_begin_cid{begin_commit_id} {
   DebugAssert(size > 0, "No point in having empty MVCC data, as it cannot grow");
 
   _begin_cids.resize(size, begin_commit_id);
@@ -50,6 +53,16 @@ CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
 void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID commit_id) {
   DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _begin_cids[offset] = commit_id;
+  set_atomic_min(min_begin_cid, commit_id);
+}
+
+void MvccData::set_begin_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const CommitID commit_id) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= _begin_cids.size(),
+              "offsets out of bounds; MvccData insufficently preallocated?");
+  std::fill(_begin_cids.begin() + begin_offset, _begin_cids.begin() + end_offset, commit_id);
+  if (begin_offset < end_offset) {
+    set_atomic_min(min_begin_cid, commit_id);
+  }
 }
 
 CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
@@ -60,6 +73,29 @@ CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
   DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
   _end_cids[offset] = commit_id;
+  set_atomic_min(min_end_cid, commit_id);
+}
+
+void MvccData::get_committed_visibility(const ChunkOffset row_count, const CommitID snapshot_commit_id,
+                                        std::vector<uint8_t>& visible_rows) const {
+  DebugAssert(row_count <= _begin_cids.size(), "row_count out of bounds; MvccData insufficently preallocated?");
+  visible_rows.resize(row_count);
+
+  const auto* begin_cids = _begin_cids.data();
+  const auto* end_cids = _end_cids.data();
+  auto* visible = visible_rows.data();
+
+  // Make the compiler try harder to vectorize the trivial loop below.
+  // This empty block is used to convince clang-format to keep the pragma indented.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd
+  // clang-format on
+  // OpenMP directives do not work with strong type defs.
+  for (auto offset = ChunkOffset::base_type{0}; offset < static_cast<ChunkOffset::base_type>(row_count); ++offset) {
+    visible[offset] = static_cast<uint8_t>(begin_cids[offset] <= snapshot_commit_id) &
+                      static_cast<uint8_t>(snapshot_commit_id < end_cids[offset]);
+  }
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <limits>
 #include <shared_mutex>
+#include <vector>
 
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -25,6 +27,16 @@ struct MvccData {
   std::atomic<CommitID> max_begin_cid{MAX_COMMIT_ID};
   std::atomic<CommitID> max_end_cid{MAX_COMMIT_ID};
 
+  // The lowest end_cid of all rows, maintained by `set_end_cid()`. Rows that were deleted (or rolled back) are
+  // invalidated for all snapshots greater than or equal to `min_end_cid`. Older snapshots still see them, which allows
+  // Validate to treat chunks with invalidated rows as entirely visible for such snapshots.
+  std::atomic<CommitID> min_end_cid{MAX_COMMIT_ID};
+
+  // The lowest begin_cid of all rows, maintained by `set_begin_cid()` and `set_begin_cids()`. Together with
+  // `max_end_cid`, it bounds the snapshots for which rows of the chunk can be visible at all. GetTable uses this
+  // range to skip chunks that are invisible for a transaction's snapshot (see `GetTable::_on_execute()`).
+  std::atomic<CommitID> min_begin_cid;
+
   // Creates MVCC data that supports a maximum of `size` rows. If the underlying chunk has less rows, the extra rows
   // here are ignored. This is to avoid resizing the vectors, which would cause reallocations and require locking.
   explicit MvccData(const size_t size, CommitID begin_commit_id);
@@ -38,9 +50,22 @@ struct MvccData {
   CommitID get_begin_cid(const ChunkOffset offset) const;
   void set_begin_cid(const ChunkOffset offset, const CommitID commit_id);
 
+  // Sets the begin_cids of the rows [begin_offset, end_offset), e.g., for rows appended in bulk.
+  void set_begin_cids(const ChunkOffset begin_offset, const ChunkOffset end_offset, const CommitID commit_id);
+
   CommitID get_end_cid(const ChunkOffset offset) const;
   void set_end_cid(const ChunkOffset offset, const CommitID commit_id);
 
+  /**
+   * Determines for the rows [0, row_count) whether they were inserted before and not deleted before (or at) the given
+   * snapshot, i.e., whether begin_cid <= snapshot_commit_id < end_cid. `visible_rows` is resized to `row_count`. TIDs
+   * are not considered. Thus, the result only matches the visibility as checked by Validate::is_row_visible() if the
+   * rows have no uncommitted changes by the reading transaction. The loop works on the CID vectors directly and can
+   * thus be vectorized by the compiler.
+   */
+  void get_committed_visibility(const ChunkOffset row_count, const CommitID snapshot_commit_id,
+                                std::vector<uint8_t>& visible_rows) const;
+
   TransactionID get_tid(const ChunkOffset offset) const;
   void set_tid(const ChunkOffset offset, const TransactionID transaction_id,
                const std::memory_order memory_order = std::memory_order_seq_cst);
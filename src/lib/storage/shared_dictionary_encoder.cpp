@@ -0,0 +1,170 @@
+#include "shared_dictionary_encoder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+template <typename T>
+void encode_columns_with_shared_dictionary(const std::vector<SharedDictionaryEncoder::TableColumn>& columns,
+                                           const VectorCompressionType vector_compression_type) {
+  // Gather the segments of all immutable chunks. Mutable chunks are encoded once they have become immutable.
+  struct SegmentToEncode {
+    std::shared_ptr<Chunk> chunk;
+    ColumnID column_id;
+    std::shared_ptr<AbstractSegment> segment;
+  };
+
+  auto segments = std::vector<SegmentToEncode>{};
+  for (const auto& [table, column_id] : columns) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable()) {
+        continue;
+      }
+
+      segments.push_back({chunk, column_id, chunk->get_segment(column_id)});
+    }
+  }
+
+  if (segments.empty()) {
+    return;
+  }
+
+  // The dictionary of the first segment is the current shared dictionary. Segments using it only need to be remapped.
+  auto previous_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segments.front().segment)) {
+    previous_dictionary = dictionary_segment->dictionary();
+  }
+
+  const auto uses_previous_dictionary = [&](const AbstractSegment& segment) {
+    const auto* dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment);
+    return previous_dictionary && dictionary_segment && dictionary_segment->dictionary() == previous_dictionary;
+  };
+
+  // Collect the values of all segments that do not use the current dictionary yet.
+  auto new_values = std::vector<T>{};
+  for (const auto& segment_to_encode : segments) {
+    if (uses_previous_dictionary(*segment_to_encode.segment)) {
+      continue;
+    }
+
+    segment_iterate<T>(*segment_to_encode.segment, [&](const auto& position) {
+      if (!position.is_null()) {
+        new_values.push_back(position.value());
+      }
+    });
+  }
+
+  std::sort(new_values.begin(), new_values.end());
+  new_values.erase(std::unique(new_values.begin(), new_values.end()), new_values.end());
+
+  // Merge the new values into the previous dictionary. If all values are known, the previous dictionary is kept.
+  auto dictionary = previous_dictionary;
+  if (!previous_dictionary) {
+    dictionary = std::make_shared<const pmr_vector<T>>(new_values.cbegin(), new_values.cend());
+  } else if (!std::includes(previous_dictionary->cbegin(), previous_dictionary->cend(), new_values.cbegin(),
+                            new_values.cend())) {
+    auto merged_dictionary = pmr_vector<T>{};
+    merged_dictionary.reserve(previous_dictionary->size() + new_values.size());
+    std::set_union(previous_dictionary->cbegin(), previous_dictionary->cend(), new_values.cbegin(), new_values.cend(),
+                   std::back_inserter(merged_dictionary));
+    dictionary = std::make_shared<const pmr_vector<T>>(std::move(merged_dictionary));
+  }
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+
+  // As both dictionaries are sorted, the value IDs of the previous dictionary can be mapped to the value IDs of the new
+  // dictionary in a single pass. The previous null value ID is mapped to the new one.
+  auto value_id_mapping = std::vector<uint32_t>{};
+  if (previous_dictionary && dictionary != previous_dictionary) {
+    value_id_mapping.reserve(previous_dictionary->size() + 1);
+    auto dictionary_iter = dictionary->cbegin();
+    for (const auto& value : *previous_dictionary) {
+      dictionary_iter = std::lower_bound(dictionary_iter, dictionary->cend(), value);
+      value_id_mapping.push_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), dictionary_iter)));
+    }
+    value_id_mapping.push_back(null_value_id);
+  }
+
+  for (const auto& [chunk, column_id, segment] : segments) {
+    const auto previously_shared = uses_previous_dictionary(*segment);
+    if (previously_shared && dictionary == previous_dictionary) {
+      continue;
+    }
+
+    auto attribute_vector = pmr_vector<uint32_t>{};
+    attribute_vector.reserve(segment->size());
+
+    if (previously_shared) {
+      const auto& dictionary_segment = static_cast<const DictionarySegment<T>&>(*segment);
+      const auto decompressor = dictionary_segment.attribute_vector()->create_base_decompressor();
+      const auto segment_size = dictionary_segment.size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        attribute_vector.push_back(value_id_mapping[decompressor->get(chunk_offset)]);
+      }
+    } else {
+      segment_iterate<T>(*segment, [&](const auto& position) {
+        if (position.is_null()) {
+          attribute_vector.push_back(null_value_id);
+          return;
+        }
+
+        const auto dictionary_iter = std::lower_bound(dictionary->cbegin(), dictionary->cend(), position.value());
+        attribute_vector.push_back(static_cast<uint32_t>(std::distance(dictionary->cbegin(), dictionary_iter)));
+      });
+    }
+
+    const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+        compress_vector(attribute_vector, vector_compression_type, {}, {null_value_id})};
+    chunk->replace_segment(column_id, std::make_shared<DictionarySegment<T>>(dictionary, compressed_attribute_vector));
+
+    if (!chunk->pruning_statistics()) {
+      generate_chunk_pruning_statistics(chunk);
+    }
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+void SharedDictionaryEncoder::encode_columns(const std::vector<TableColumn>& columns,
+                                             const VectorCompressionType vector_compression_type) {
+  Assert(!columns.empty(), "Expected at least one column to encode.");
+
+  const auto& [first_table, first_column_id] = columns.front();
+  const auto data_type = first_table->column_data_type(first_column_id);
+  for (const auto& [table, column_id] : columns) {
+    Assert(table->type() == TableType::Data, "Only data tables can be encoded.");
+    Assert(table->column_data_type(column_id) == data_type, "Columns with a shared dictionary must have the same type.");
+  }
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    encode_columns_with_shared_dictionary<ColumnDataType>(columns, vector_compression_type);
+  });
+}
+
+void SharedDictionaryEncoder::encode_column(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                                            const VectorCompressionType vector_compression_type) {
+  encode_columns({{table, column_id}}, vector_compression_type);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/dictionary_segment/attribute_vector_iterable.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables/segment_positions.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+/**
+ * @brief Encodes columns as DictionarySegments that share a single, sorted dictionary
+ *
+ * Usually, each DictionarySegment has its own chunk-local dictionary. Value IDs of different segments are thus not
+ * comparable and operators such as JoinHash and AggregateHash have to materialize and hash the actual values, which is
+ * expensive for long strings. When all segments of one or more columns share a single sorted dictionary, value IDs are
+ * order-preserving codes that are valid across chunks (and across tables). AggregateHash then groups on value IDs and
+ * JoinHash joins on value IDs (see get_shared_dictionary_segments()).
+ *
+ * Encoding is incremental: the dictionary of the first immutable segment of the first column is the current shared
+ * dictionary. The values of all other segments that do not use this dictionary yet (e.g., chunks that have become
+ * immutable since the last call) are merged into it. Segments that already use the previous dictionary are not
+ * re-read; only their value IDs are remapped. If the added segments do not contain unknown values, the dictionary
+ * and the segments using it remain untouched. Mutable chunks are skipped.
+ *
+ * NOT thread-safe. As with the ChunkEncoder, concurrent operators keep using the segments they already hold. Operators
+ * that work on value IDs pin all segments that they read together with the dictionary (see SharedDictionarySegments).
+ */
+class SharedDictionaryEncoder {
+ public:
+  using TableColumn = std::pair<std::shared_ptr<Table>, ColumnID>;
+
+  /**
+   * Encodes the immutable chunks of all passed columns with one shared dictionary. All columns need to have the same
+   * data type. Passing the join columns of multiple tables (e.g., a primary key and its foreign keys) allows JoinHash
+   * to join on value IDs.
+   */
+  static void encode_columns(const std::vector<TableColumn>& columns,
+                             const VectorCompressionType vector_compression_type =
+                                 VectorCompressionType::FixedWidthInteger);
+
+  static void encode_column(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                            const VectorCompressionType vector_compression_type =
+                                VectorCompressionType::FixedWidthInteger);
+};
+
+/**
+ * The segments of a column that share a dictionary, as returned by get_shared_dictionary_segments(). Concurrent
+ * SharedDictionaryEncoder runs replace the segments of a chunk and remap their value IDs when the dictionary grows.
+ * Operators that work on value IDs thus have to read them from the segments of a single SharedDictionarySegments
+ * object, which all use the same dictionary, instead of getting the segments from the chunks again.
+ */
+struct SharedDictionarySegments {
+  // The shared dictionary (a pmr_vector<T>) and its size.
+  std::shared_ptr<const void> dictionary;
+  size_t dictionary_size{0};
+
+  // The segments of the column by ChunkID (DictionarySegments for data tables, ReferenceSegments for reference tables).
+  // nullptr for physically deleted chunks.
+  std::vector<std::shared_ptr<const AbstractSegment>> segments;
+
+  // For reference tables, the DictionarySegments of the referenced columns by referenced table and ChunkID.
+  std::unordered_map<const Table*, std::vector<std::shared_ptr<const BaseDictionarySegment>>> referenced_segments;
+};
+
+/**
+ * Returns the segments of the given column if they are all encoded with the same shared dictionary, nullptr otherwise.
+ * For reference tables, the referenced columns are checked. Empty tables and tables with mutable chunks (which hold
+ * ValueSegments) do not have a shared dictionary.
+ */
+template <typename T>
+std::shared_ptr<const SharedDictionarySegments> get_shared_dictionary_segments(const Table& table,
+                                                                               const ColumnID column_id) {
+  auto shared_dictionary_segments = std::make_shared<SharedDictionarySegments>();
+  auto shared_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+  const auto chunk_count = table.chunk_count();
+  shared_dictionary_segments->segments.resize(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    // The segment is only retrieved once, so that the checked segment is the one that is used later.
+    const auto segment = chunk->get_segment(column_id);
+    auto segment_dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      // Reference tables usually reference the same table in all of their chunks. Check each referenced table only
+      // once. Already checked tables use the shared dictionary.
+      const auto& referenced_table = reference_segment->referenced_table();
+      auto& referenced_segments = shared_dictionary_segments->referenced_segments;
+      if (referenced_segments.contains(referenced_table.get())) {
+        segment_dictionary = shared_dictionary;
+      } else {
+        const auto referenced_dictionary_segments =
+            get_shared_dictionary_segments<T>(*referenced_table, reference_segment->referenced_column_id());
+        if (!referenced_dictionary_segments) {
+          return nullptr;
+        }
+
+        auto& dictionary_segments = referenced_segments[referenced_table.get()];
+        dictionary_segments.reserve(referenced_dictionary_segments->segments.size());
+        for (const auto& referenced_segment : referenced_dictionary_segments->segments) {
+          dictionary_segments.emplace_back(std::static_pointer_cast<const BaseDictionarySegment>(referenced_segment));
+        }
+        segment_dictionary = std::static_pointer_cast<const pmr_vector<T>>(referenced_dictionary_segments->dictionary);
+      }
+    } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      segment_dictionary = dictionary_segment->dictionary();
+    }
+
+    if (!segment_dictionary || (shared_dictionary && segment_dictionary != shared_dictionary)) {
+      return nullptr;
+    }
+
+    shared_dictionary = segment_dictionary;
+    shared_dictionary_segments->segments[chunk_id] = segment;
+  }
+
+  if (!shared_dictionary) {
+    return nullptr;
+  }
+
+  shared_dictionary_segments->dictionary = shared_dictionary;
+  shared_dictionary_segments->dictionary_size = shared_dictionary->size();
+  return shared_dictionary_segments;
+}
+
+/**
+ * Returns the dictionary that is shared by all segments of the given column or nullptr if the column is not (entirely)
+ * encoded with a shared dictionary (see get_shared_dictionary_segments()).
+ */
+template <typename T>
+std::shared_ptr<const pmr_vector<T>> get_shared_dictionary(const Table& table, const ColumnID column_id) {
+  const auto shared_dictionary_segments = get_shared_dictionary_segments<T>(table, column_id);
+  if (!shared_dictionary_segments) {
+    return nullptr;
+  }
+
+  return std::static_pointer_cast<const pmr_vector<T>>(shared_dictionary_segments->dictionary);
+}
+
+/**
+ * Calls `functor` with a SegmentPosition<ValueID> for each position of the segment of the given chunk in
+ * `shared_dictionary_segments`. ReferenceSegments are dereferenced using the pinned referenced segments. The chunk
+ * offset of a position is the offset within the segment. NULL values have the null value ID of the shared dictionary,
+ * NULL_ROW_IDs of ReferenceSegments are passed as NULL positions with an INVALID_VALUE_ID.
+ */
+template <typename Functor>
+void iterate_shared_dictionary_value_ids(const SharedDictionarySegments& shared_dictionary_segments,
+                                         const ChunkID chunk_id, const Functor& functor) {
+  const auto& segment = shared_dictionary_segments.segments[chunk_id];
+  Assert(segment, "Chunk was not part of the shared dictionary segments.");
+
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&*segment)) {
+    AttributeVectorIterable{*dictionary_segment, dictionary_segment->null_value_id()}.for_each(functor);
+    return;
+  }
+
+  const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+  const auto& referenced_segments =
+      shared_dictionary_segments.referenced_segments.at(reference_segment.referenced_table().get());
+
+  // Decompressors are created lazily per referenced chunk. As all referenced segments share the dictionary, they also
+  // share the null value ID.
+  auto decompressors = std::vector<std::unique_ptr<BaseVectorDecompressor>>(referenced_segments.size());
+  const auto null_value_id = ValueID{static_cast<ValueID::base_type>(shared_dictionary_segments.dictionary_size)};
+
+  auto chunk_offset = ChunkOffset{0};
+  for (const auto& row_id : *reference_segment.pos_list()) {
+    if (row_id.is_null()) {
+      functor(SegmentPosition<ValueID>{INVALID_VALUE_ID, true, chunk_offset});
+      ++chunk_offset;
+      continue;
+    }
+
+    auto& decompressor = decompressors[row_id.chunk_id];
+    if (!decompressor) {
+      const auto& dictionary_segment = *referenced_segments[row_id.chunk_id];
+      DebugAssert(dictionary_segment.null_value_id() == null_value_id,
+                  "Referenced segments do not share a dictionary.");
+      decompressor = dictionary_segment.attribute_vector()->create_base_decompressor();
+    }
+
+    const auto value_id = ValueID{decompressor->get(row_id.chunk_offset)};
+    functor(SegmentPosition<ValueID>{value_id, value_id == null_value_id, chunk_offset});
+    ++chunk_offset;
+  }
+}
+
+}  // namespace hyrise
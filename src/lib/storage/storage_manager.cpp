@@ -17,6 +17,7 @@
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/lqp_view.hpp"
+#include "storage/materialized_view.hpp"
 #include "storage/prepared_plan.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -51,6 +52,13 @@ void StorageManager::drop_table(const std::string& name) {
   const auto table_iter = _tables.find(name);
   Assert(table_iter != _tables.end() && table_iter->second, "Error deleting table. No such table named '" + name + "'");
 
+  // Materialized views cannot be maintained without the tables that they read.
+  for (const auto& [materialized_view_name, materialized_view] : materialized_views()) {
+    if (materialized_view->reads_table(table_iter->second)) {
+      drop_materialized_view(materialized_view_name);
+    }
+  }
+
   // The concurrent_unordered_map does not support concurrency-safe erasure. Thus, we simply reset the table pointer.
   _tables[name] = nullptr;
 }
@@ -211,6 +219,66 @@ std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> StorageManager::p
   return result;
 }
 
+void StorageManager::add_materialized_view(const std::shared_ptr<MaterializedView>& materialized_view) {
+  const auto& name = materialized_view->name();
+  Assert(!has_materialized_view(name),
+         "Cannot add materialized view " + name + " - a materialized view with the same name already exists");
+
+  add_table(materialized_view->table_name(), materialized_view->table());
+  add_view(name, materialized_view->lqp_view());
+
+  // Register the view before populating it, so that it receives all changes that are not part of its initial contents.
+  _materialized_views[name] = materialized_view;
+  materialized_view->populate();
+
+  // Cached plans do not read from the view yet.
+  if (Hyrise::get().default_pqp_cache) {
+    Hyrise::get().default_pqp_cache->clear();
+  }
+  if (Hyrise::get().default_lqp_cache) {
+    Hyrise::get().default_lqp_cache->clear();
+  }
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  Assert(has_materialized_view(name),
+         "Error deleting materialized view. No such materialized view named '" + name + "'");
+
+  const auto materialized_view = _materialized_views[name];
+  _materialized_views[name] = nullptr;
+  drop_view(name);
+  drop_table(materialized_view->table_name());
+
+  // Cached plans might read from the dropped table.
+  if (Hyrise::get().default_pqp_cache) {
+    Hyrise::get().default_pqp_cache->clear();
+  }
+  if (Hyrise::get().default_lqp_cache) {
+    Hyrise::get().default_lqp_cache->clear();
+  }
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto iter = _materialized_views.find(name);
+  Assert(iter != _materialized_views.end() && iter->second, "No such materialized view named '" + name + "'");
+  return iter->second;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const {
+  const auto iter = _materialized_views.find(name);
+  return iter != _materialized_views.end() && iter->second;
+}
+
+std::unordered_map<std::string, std::shared_ptr<MaterializedView>> StorageManager::materialized_views() const {
+  auto result = std::unordered_map<std::string, std::shared_ptr<MaterializedView>>{};
+  for (const auto& [materialized_view_name, materialized_view] : _materialized_views) {
+    if (materialized_view) {
+      result[materialized_view_name] = materialized_view;
+    }
+  }
+  return result;
+}
+
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
   tasks.reserve(_tables.size());
@@ -18,6 +18,7 @@ namespace hyrise {
 
 class Table;
 class AbstractLQPNode;
+class MaterializedView;
 
 // The StorageManager is a class that maintains all tables by mapping table names to table instances.
 class StorageManager : public Noncopyable {
@@ -58,6 +59,19 @@ class StorageManager : public Noncopyable {
   std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> prepared_plans() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views (see MaterializedView), this is only thread-safe for operations on materialized
+   *           views with different names. Adding a materialized view registers its table and an LQPView with the
+   *           view's name before the view is populated. Dropping a table drops the materialized views that read it.
+   * @{
+   */
+  void add_materialized_view(const std::shared_ptr<MaterializedView>& materialized_view);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  std::unordered_map<std::string, std::shared_ptr<MaterializedView>> materialized_views() const;
+  /** @} */
+
   // For debugging purposes mostly, dump all tables as csv.
   void export_all_tables_as_csv(const std::string& path);
 
@@ -71,6 +85,7 @@ class StorageManager : public Noncopyable {
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<Table>> _tables{INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>> _views{INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans{INITIAL_MAP_SIZE};
+  tbb::concurrent_unordered_map<std::string, std::shared_ptr<MaterializedView>> _materialized_views{INITIAL_MAP_SIZE};
 };
 
 std::ostream& operator<<(std::ostream& stream, const StorageManager& storage_manager);
@@ -10,6 +10,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -21,6 +22,7 @@
 #include "resolve_type.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
+#include "storage/column_span.hpp"
 #include "storage/constraints/abstract_table_constraint.hpp"
 #include "storage/constraints/foreign_key_constraint.hpp"
 #include "storage/constraints/table_key_constraint.hpp"
@@ -37,6 +39,7 @@
 #include "storage/table_column_definition.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/atomic_max.hpp"
 #include "utils/performance_warning.hpp"
 #include "value_segment.hpp"
 
@@ -81,6 +84,7 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
       _append_mutex(std::make_unique<std::mutex>()),
+      _table_indexes_statistics_mutex(std::make_unique<std::mutex>()),
       _table_indexes(table_indexes) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum.");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables.");
@@ -147,6 +151,14 @@ UseMvcc Table::uses_mvcc() const {
   return _use_mvcc;
 }
 
+CommitID Table::last_commit_id() const {
+  return _last_commit_id.load();
+}
+
+void Table::update_last_commit_id(const CommitID commit_id) const {
+  set_atomic_max(_last_commit_id, commit_id);
+}
+
 ColumnCount Table::column_count() const {
   return ColumnCount{static_cast<ColumnCount::base_type>(_column_definitions.size())};
 }
@@ -202,21 +214,37 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  auto last_chunk = !_chunks.empty() ? get_chunk(ChunkID{chunk_count() - 1}) : nullptr;
-  if (!last_chunk || last_chunk->size() >= _target_chunk_size || !last_chunk->is_mutable()) {
-    // One chunk reached its capacity and was not marked as immutable before.
-    if (last_chunk && last_chunk->is_mutable()) {
-      last_chunk->set_immutable();
+  auto sealed_chunk_id = std::optional<ChunkID>{};
+  {
+    // Inserts with multiple insert chunks append chunks and update the insert chunks of their slots concurrently.
+    const auto append_lock = acquire_append_mutex();
+
+    auto last_chunk = !_chunks.empty() ? get_chunk(ChunkID{chunk_count() - 1}) : nullptr;
+    const auto last_is_insert_chunk = last_chunk && is_insert_chunk(ChunkID{chunk_count() - 1});
+    if (!last_chunk || last_chunk->size() >= _target_chunk_size || !last_chunk->is_mutable() || last_is_insert_chunk) {
+      // One chunk reached its capacity and was not marked as immutable before. Insert chunks are sealed by the Inserts.
+      if (last_chunk && last_chunk->is_mutable() && !last_is_insert_chunk) {
+        last_chunk->set_immutable();
+        sealed_chunk_id = ChunkID{chunk_count() - 1};
+      }
+
+      append_mutable_chunk();
+      last_chunk = get_chunk(ChunkID{chunk_count() - 1});
     }
 
-    append_mutable_chunk();
-    last_chunk = get_chunk(ChunkID{chunk_count() - 1});
+    last_chunk->append(values);
   }
 
-  last_chunk->append(values);
+  if (sealed_chunk_id) {
+    add_chunk_to_table_indexes(*sealed_chunk_id);
+  }
 }
 
 void Table::append_mutable_chunk() {
+  append_chunk(create_mutable_chunk());
+}
+
+std::shared_ptr<Chunk> Table::create_mutable_chunk() const {
   auto segments = Segments{};
   for (const auto& column_definition : _column_definitions) {
     resolve_data_type(column_definition.data_type, [&](auto type) {
@@ -231,7 +259,50 @@ void Table::append_mutable_chunk() {
     mvcc_data = std::make_shared<MvccData>(_target_chunk_size, MvccData::MAX_COMMIT_ID);
   }
 
-  append_chunk(segments, mvcc_data);
+  return std::make_shared<Chunk>(segments, mvcc_data);
+}
+
+void Table::append_columns(const std::vector<ColumnSpan>& columns) {
+  Assert(columns.size() == column_count(), "Number of columns does not match the table's column count.");
+  const auto row_count = columns.empty() ? size_t{0} : columns.front().size();
+  for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+    Assert(columns[column_id].size() == row_count, "All columns must have the same number of values.");
+    Assert(columns[column_id].data_type() == column_data_type(column_id), "Data type of column does not match.");
+  }
+
+  // Chunks marked as immutable here are indexed after releasing the append mutex, so that concurrent Inserts are not
+  // blocked while the indexes are updated.
+  auto sealed_chunk_ids = std::vector<ChunkID>{};
+  {
+    const auto append_lock = acquire_append_mutex();
+
+    auto appended_row_count = size_t{0};
+    while (appended_row_count < row_count) {
+      auto last_chunk = !_chunks.empty() ? get_chunk(ChunkID{chunk_count() - 1}) : nullptr;
+      const auto last_is_insert_chunk = last_chunk && is_insert_chunk(ChunkID{chunk_count() - 1});
+      if (!last_chunk || last_chunk->size() >= _target_chunk_size || !last_chunk->is_mutable() ||
+          last_chunk->is_marked_as_full() || last_is_insert_chunk) {
+        // Chunks that were marked as full by Insert operators are marked as immutable once their Inserts finish. Insert
+        // chunks of other slots are still written to and sealed by the Inserts.
+        if (last_chunk && last_chunk->is_mutable() && !last_chunk->is_marked_as_full() && !last_is_insert_chunk) {
+          last_chunk->set_immutable();
+          sealed_chunk_ids.emplace_back(chunk_count() - 1);
+        }
+
+        append_mutable_chunk();
+        last_chunk = get_chunk(ChunkID{chunk_count() - 1});
+      }
+
+      const auto chunk_row_count = static_cast<ChunkOffset>(
+          std::min(static_cast<size_t>(_target_chunk_size - last_chunk->size()), row_count - appended_row_count));
+      last_chunk->append_columns(columns, appended_row_count, chunk_row_count);
+      appended_row_count += chunk_row_count;
+    }
+  }
+
+  for (const auto chunk_id : sealed_chunk_ids) {
+    add_chunk_to_table_indexes(chunk_id);
+  }
 }
 
 uint64_t Table::row_count() const {
@@ -316,8 +387,6 @@ void Table::remove_chunk(ChunkID chunk_id) {
 
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
                          const std::optional<PolymorphicAllocator<Chunk>>& alloc) {
-  Assert(_type != TableType::Data || static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes),
-         "Supply MvccData to data Tables if MVCC is enabled.");
   AssertInput(static_cast<ColumnCount::base_type>(segments.size()) == column_count(),
               "Input does not have the same number of columns.");
 
@@ -326,17 +395,29 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
       const auto is_reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment) != nullptr;
       Assert(is_reference_segment == (_type == TableType::References), "Invalid Segment type.");
     }
+  }
 
+  append_chunk(std::make_shared<Chunk>(segments, mvcc_data, alloc));
+}
+
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(_type != TableType::Data || chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+         "Supply MvccData to data Tables if MVCC is enabled.");
+  AssertInput(chunk->column_count() == column_count(), "Input does not have the same number of columns.");
+
+  if constexpr (HYRISE_DEBUG) {
     // Check that existing chunks are not empty
     const auto chunk_count = _chunks.size();
     for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      const auto chunk = get_chunk(chunk_id);
-      if (!chunk) {
+      const auto existing_chunk = get_chunk(chunk_id);
+      if (!existing_chunk) {
         continue;
       }
 
-      // An empty, mutable chunk at the end is fine, but in that case, append_chunk shouldn't have to be called.
-      DebugAssert(chunk->size() > 0, "append_chunk called on a table that has an empty chunk.");
+      // An empty, mutable chunk at the end is fine, but in that case, append_chunk shouldn't have to be called. With
+      // multiple insert chunks, other slots might have appended chunks that have not received rows yet.
+      DebugAssert(existing_chunk->size() > 0 || (!_insert_chunk_ids.empty() && existing_chunk->is_mutable()),
+                  "append_chunk called on a table that has an empty chunk.");
     }
   }
 
@@ -346,7 +427,17 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
   // making sure that an uninitialized entry compares equal to nullptr and (2) insert the desired chunk atomically.
 
   auto new_chunk_iter = _chunks.push_back(nullptr);
-  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  std::atomic_store(&*new_chunk_iter, chunk);
+}
+
+void Table::append_chunk(const std::shared_ptr<AbstractSegmentLoader>& segment_loader,
+                         std::shared_ptr<MvccData> mvcc_data) {
+  Assert(_type == TableType::Data, "Only chunks of data tables can be loaded lazily.");
+  Assert(static_cast<bool>(mvcc_data) == (_use_mvcc == UseMvcc::Yes), "Supply MvccData to Tables if MVCC is enabled.");
+
+  // See above for why the chunk is inserted atomically.
+  auto new_chunk_iter = _chunks.push_back(nullptr);
+  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(column_count(), segment_loader, mvcc_data));
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -412,12 +503,101 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() {
   return std::unique_lock<std::mutex>(*_append_mutex);
 }
 
+void Table::set_insert_chunk_count(const uint32_t insert_chunk_count) {
+  Assert(_type == TableType::Data && _use_mvcc == UseMvcc::Yes, "Only data tables with MVCC data are inserted into.");
+  Assert(insert_chunk_count > 0, "Tables need at least one insert chunk.");
+  const auto append_lock = acquire_append_mutex();
+
+  _insert_chunk_ids.clear();
+  _insert_chunk_mutexes.clear();
+  if (insert_chunk_count == 1) {
+    return;
+  }
+
+  // The current last chunk is not adopted by a slot and is marked as full so that it becomes immutable once its
+  // pending Inserts are finished.
+  const auto chunk_count = this->chunk_count();
+  if (chunk_count > 0) {
+    const auto last_chunk = get_chunk(ChunkID{chunk_count - 1});
+    if (last_chunk && last_chunk->is_mutable() && last_chunk->size() > 0 && !last_chunk->is_marked_as_full()) {
+      last_chunk->mark_as_full();
+      if (last_chunk->try_set_immutable()) {
+        add_chunk_to_table_indexes(ChunkID{chunk_count - 1});
+      }
+    }
+  }
+
+  _insert_chunk_ids.resize(insert_chunk_count, INVALID_CHUNK_ID);
+  _insert_chunk_mutexes.reserve(insert_chunk_count);
+  for (auto slot = uint32_t{0}; slot < insert_chunk_count; ++slot) {
+    _insert_chunk_mutexes.emplace_back(std::make_unique<std::mutex>());
+  }
+}
+
+uint32_t Table::insert_chunk_count() const {
+  return _insert_chunk_ids.empty() ? 1 : static_cast<uint32_t>(_insert_chunk_ids.size());
+}
+
+uint32_t Table::insert_chunk_slot() const {
+  if (_insert_chunk_ids.empty()) {
+    return 0;
+  }
+
+  // Hashing the thread ID once per thread is sufficient, as the slot only depends on it and the insert chunk count.
+  thread_local const auto thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return static_cast<uint32_t>(thread_hash % _insert_chunk_ids.size());
+}
+
+std::unique_lock<std::mutex> Table::acquire_insert_chunk_mutex(const uint32_t slot) {
+  if (_insert_chunk_ids.empty()) {
+    DebugAssert(slot == 0, "Table has a single insert chunk.");
+    return acquire_append_mutex();
+  }
+
+  DebugAssert(slot < _insert_chunk_mutexes.size(), "Invalid insert chunk slot.");
+  return std::unique_lock<std::mutex>(*_insert_chunk_mutexes[slot]);
+}
+
+ChunkID Table::get_or_append_insert_chunk(const uint32_t slot) {
+  const auto is_usable = [&](const ChunkID chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    return chunk && chunk->is_mutable() && chunk->size() < _target_chunk_size && !chunk->is_marked_as_full();
+  };
+
+  if (_insert_chunk_ids.empty()) {
+    // The caller holds the append mutex. Inserts write to the last chunk.
+    const auto chunk_count = this->chunk_count();
+    if (chunk_count > 0 && is_usable(ChunkID{chunk_count - 1})) {
+      return ChunkID{chunk_count - 1};
+    }
+
+    append_mutable_chunk();
+    return ChunkID{chunk_count};
+  }
+
+  auto& insert_chunk_id = _insert_chunk_ids[slot];
+  if (insert_chunk_id != INVALID_CHUNK_ID && is_usable(insert_chunk_id)) {
+    return insert_chunk_id;
+  }
+
+  // Other slots and Table::append_columns() append chunks concurrently, so we determine the new ChunkID while holding
+  // the append mutex.
+  const auto append_lock = acquire_append_mutex();
+  append_mutable_chunk();
+  insert_chunk_id = ChunkID{chunk_count() - 1};
+  return insert_chunk_id;
+}
+
+bool Table::is_insert_chunk(const ChunkID chunk_id) const {
+  return std::find(_insert_chunk_ids.cbegin(), _insert_chunk_ids.cend(), chunk_id) != _insert_chunk_ids.cend();
+}
+
 std::shared_ptr<TableStatistics> Table::table_statistics() const {
-  return _table_statistics;
+  return std::atomic_load(&_table_statistics);
 }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
 }
 
 std::vector<ChunkIndexStatistics> Table::chunk_indexes_statistics() const {
@@ -425,6 +605,7 @@ std::vector<ChunkIndexStatistics> Table::chunk_indexes_statistics() const {
 }
 
 std::vector<TableIndexStatistics> Table::table_indexes_statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{*_table_indexes_statistics_mutex};
   return _table_indexes_statistics;
 }
 
@@ -658,9 +839,36 @@ void Table::create_partial_hash_index(const ColumnID column_id, const std::vecto
 
   _table_indexes.emplace_back(table_index);
 
+  const auto lock = std::lock_guard<std::mutex>{*_table_indexes_statistics_mutex};
   _table_indexes_statistics.emplace_back(TableIndexStatistics{{column_id}, chunks_to_index});
 }
 
+void Table::add_chunk_to_table_indexes(const ChunkID chunk_id) {
+  const auto table_indexes = get_table_indexes();
+  if (table_indexes.empty()) {
+    return;
+  }
+
+  const auto chunk = get_chunk(chunk_id);
+  Assert(chunk && !chunk->is_mutable(), "Only existing immutable chunks can be indexed.");
+  for (const auto& table_index : table_indexes) {
+    table_index->insert({{chunk_id, chunk}});
+  }
+
+  // Only list the chunk once it is indexed, as the optimizer assigns the listed chunks to IndexScans. Each table index
+  // has its statistics, and the chunk might already be listed if it was indexed by a concurrent call.
+  const auto lock = std::lock_guard<std::mutex>{*_table_indexes_statistics_mutex};
+  for (auto& table_index_statistics : _table_indexes_statistics) {
+    auto& indexed_chunks = table_index_statistics.chunk_ids;
+    const auto is_listed = std::any_of(indexed_chunks.cbegin(), indexed_chunks.cend(), [&](const auto& indexed_chunk) {
+      return indexed_chunk.first == chunk_id;
+    });
+    if (!is_listed) {
+      indexed_chunks.emplace_back(chunk_id, chunk);
+    }
+  }
+}
+
 template void Table::create_chunk_index<GroupKeyIndex>(const std::vector<ColumnID>& column_ids,
                                                        const std::string& name);
 template void Table::create_chunk_index<CompositeGroupKeyIndex>(const std::vector<ColumnID>& column_ids,
@@ -31,6 +31,7 @@
 
 namespace hyrise {
 
+class ColumnSpan;
 class TableStatistics;
 
 /**
@@ -80,6 +81,18 @@ class Table : private Noncopyable {
 
   UseMvcc uses_mvcc() const;
 
+  /**
+   * Returns the highest CommitID of the transactions that inserted or invalidated rows of this table (CommitID{0} if
+   * there are none). Allows detecting modifications without visiting the MvccData of all chunks (see ResultCache).
+   */
+  CommitID last_commit_id() const;
+
+  /**
+   * Atomically raises last_commit_id() to @param commit_id. Read/write operators call it when they commit, after they
+   * updated the MvccData. The function is marked as const, as otherwise it could not be called by the Delete operator.
+   */
+  void update_last_commit_id(const CommitID commit_id) const;
+
   // For data tables, returns the target chunk size (i.e., the number of rows pre-allocated in the ValueSegment).
   ChunkOffset target_chunk_size() const;
 
@@ -127,8 +140,26 @@ class Table : private Noncopyable {
   void append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data = nullptr,
                     const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt);
 
+  // Appends a chunk of a data table that was created and filled beforehand (see create_mutable_chunk()), e.g., to
+  // encode or index it before other threads can access it.
+  void append_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // Appends a chunk of a data table whose segments are loaded on first access (see AbstractSegmentLoader). The caller
+  // has to set the chunk immutable.
+  void append_chunk(const std::shared_ptr<AbstractSegmentLoader>& segment_loader,
+                    std::shared_ptr<MvccData> mvcc_data = nullptr);
+
   // Create and append a Chunk consisting of ValueSegments.
   void append_mutable_chunk();
+
+  // Creates a Chunk consisting of ValueSegments (with the target chunk size reserved) without appending it.
+  std::shared_ptr<Chunk> create_mutable_chunk() const;
+
+  // Appends rows given column-wise, with one ColumnSpan of the column's data type per column. In contrast to append(),
+  // values are not boxed into AllTypeVariants, and whole batches are copied into the ValueSegments. As append(), it
+  // fills the last chunk (unless it is full or marked as full by an Insert) and marks full chunks as immutable when
+  // appending new ones. The rows are visible to all transactions. Appends are serialized via the append mutex.
+  void append_columns(const std::vector<ColumnSpan>& columns);
   /** @} */
 
   /**
@@ -136,7 +167,7 @@ class Table : private Noncopyable {
    * @{
    */
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and should be used for testing purposes only. Appends are serialized via the append mutex.
   void append(const std::vector<AllTypeVariant>& values);
 
   // Returns one materialized value using an easy, but inefficient AllTypeVariant approach.
@@ -185,9 +216,42 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  /**
+   * Insert chunks are the mutable chunks that Insert operators (and PointUpdates) allocate rows in. By default, a table
+   * has a single insert chunk: the last chunk, which is shared by all Inserts that allocate rows while holding the
+   * append mutex. Under many concurrent inserts, the mutex and the last chunk become a bottleneck. With more than one
+   * insert chunk, the table keeps several mutable chunks open, each protected by its own mutex. Each thread writes to
+   * the insert chunk of its slot (see insert_chunk_slot()), and the append mutex is only acquired to append a new
+   * chunk once an insert chunk is full. Full insert chunks are marked as full and become immutable once their pending
+   * Inserts commit or roll back, as usual.
+   *
+   * set_insert_chunk_count() must not be called while rows are inserted concurrently.
+   * @{
+   */
+  void set_insert_chunk_count(const uint32_t insert_chunk_count);
+  uint32_t insert_chunk_count() const;
+
+  // Slot of the insert chunk the calling thread writes to. Threads keep their slot, so that worker threads spread
+  // across the insert chunks.
+  uint32_t insert_chunk_slot() const;
+
+  // The lock that must be held while allocating rows in the insert chunk of the given slot. With a single insert chunk,
+  // this is the append mutex.
+  std::unique_lock<std::mutex> acquire_insert_chunk_mutex(const uint32_t slot);
+
+  // Returns the insert chunk of the given slot. If it does not exist, is immutable, or is (marked as) full, a new
+  // mutable chunk is appended and becomes the slot's insert chunk. Requires the lock of the slot.
+  ChunkID get_or_append_insert_chunk(const uint32_t slot);
+
+  // Returns whether the chunk is the insert chunk of a slot. Always false for tables with a single insert chunk, whose
+  // last chunk can also be written to by append() and append_columns(). Requires the append mutex.
+  bool is_insert_chunk(const ChunkID chunk_id) const;
+  /** @} */
+
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. The statistics can be replaced while other threads read them (e.g., by
+   * plugins that refresh them in the background).
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -205,6 +269,14 @@ class Table : private Noncopyable {
    */
   void create_partial_hash_index(const ColumnID column_id, const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * Adds an immutable chunk to all table indexes of this table. Chunks that become immutable after an index was created
+   * are added when they are sealed (i.e., by the operator or method that marks them as immutable), so that lookups on
+   * recently inserted rows do not have to fall back to scans. The chunk is added to the index statistics once it is
+   * indexed, so that the optimizer assigns it to IndexScans (see IndexScanRule).
+   */
+  void add_chunk_to_table_indexes(const ChunkID chunk_id);
+
   template <typename Index>
   void create_chunk_index(const std::vector<ColumnID>& column_ids, const std::string& name = "");
 
@@ -288,12 +360,22 @@ class Table : private Noncopyable {
   std::vector<ColumnID> _value_clustered_by;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+
+  // Insert chunks of the slots if the table has more than one insert chunk (otherwise, both vectors are empty). A
+  // ChunkID is only modified while holding both the slot's mutex and the append mutex. INVALID_CHUNK_ID means that the
+  // slot has no insert chunk yet.
+  std::vector<ChunkID> _insert_chunk_ids;
+  std::vector<std::unique_ptr<std::mutex>> _insert_chunk_mutexes;
   std::vector<ChunkIndexStatistics> _chunk_indexes_statistics;
+  // Chunks are added to the statistics of table indexes concurrently (see add_chunk_to_table_indexes()).
+  std::unique_ptr<std::mutex> _table_indexes_statistics_mutex;
   std::vector<TableIndexStatistics> _table_indexes_statistics;
   pmr_vector<std::shared_ptr<PartialHashIndex>> _table_indexes;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
   mutable std::optional<uint64_t> _cached_row_count;
+
+  mutable std::atomic<CommitID> _last_commit_id{CommitID{0}};
 };
 }  // namespace hyrise
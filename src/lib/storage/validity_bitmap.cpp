@@ -0,0 +1,89 @@
+#include "validity_bitmap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+ValidityBitmap ValidityBitmap::from_null_values(const pmr_vector<bool>& null_values) {
+  const auto size = null_values.size();
+  auto bitmap = ValidityBitmap{size, false};
+
+  // Iterating over the vector<bool> is cheaper than indexing it, which recomputes the word and bit of each position.
+  auto null_value_it = null_values.cbegin();
+  const auto word_count = bitmap._words.size();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    const auto bit_count = std::min(WORD_SIZE, size - word_id * WORD_SIZE);
+    auto word = Word{0};
+    for (auto bit = size_t{0}; bit < bit_count; ++bit, ++null_value_it) {
+      word |= static_cast<Word>(!*null_value_it) << bit;
+    }
+    bitmap._words[word_id] = word;
+  }
+
+  return bitmap;
+}
+
+ValidityBitmap::ValidityBitmap(const size_t size, const bool is_valid)
+    : _size{size}, _words((size + WORD_SIZE - 1) / WORD_SIZE, is_valid ? ~Word{0} : Word{0}) {
+  _clear_padding();
+}
+
+size_t ValidityBitmap::size() const {
+  return _size;
+}
+
+const std::vector<ValidityBitmap::Word>& ValidityBitmap::words() const {
+  return _words;
+}
+
+bool ValidityBitmap::is_valid(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _size, "Position is out of range.");
+  return (_words[chunk_offset / WORD_SIZE] >> (chunk_offset % WORD_SIZE)) & 1;
+}
+
+size_t ValidityBitmap::count() const {
+  return std::accumulate(_words.cbegin(), _words.cend(), size_t{0}, [](const auto sum, const auto word) {
+    return sum + std::popcount(word);
+  });
+}
+
+ValidityBitmap& ValidityBitmap::operator&=(const ValidityBitmap& other) {
+  Assert(_size == other._size, "Bitmaps must have the same size.");
+  const auto word_count = _words.size();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    _words[word_id] &= other._words[word_id];
+  }
+  return *this;
+}
+
+ValidityBitmap& ValidityBitmap::operator|=(const ValidityBitmap& other) {
+  Assert(_size == other._size, "Bitmaps must have the same size.");
+  const auto word_count = _words.size();
+  for (auto word_id = size_t{0}; word_id < word_count; ++word_id) {
+    _words[word_id] |= other._words[word_id];
+  }
+  return *this;
+}
+
+void ValidityBitmap::invert() {
+  for (auto& word : _words) {
+    word = ~word;
+  }
+  _clear_padding();
+}
+
+void ValidityBitmap::_clear_padding() {
+  const auto used_bit_count = _size % WORD_SIZE;
+  if (used_bit_count != 0) {
+    _words.back() &= (Word{1} << used_bit_count) - 1;
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Word-aligned bitmap that marks the positions of a segment that are not NULL. Segments store their NULL values as
+ * pmr_vector<bool>, which is bit-packed, but does not expose its words. Scans convert the NULL values into a
+ * ValidityBitmap once (see from_null_values()) and then combine it with their matches 64 positions at a time (see
+ * AbstractTableScanImpl::_scan_with_validity_bitmap()) instead of checking every position for NULL.
+ *
+ * Bit `offset % WORD_SIZE` of word `offset / WORD_SIZE` belongs to position `offset`. Bits beyond size() are always
+ * unset, so that the words can be combined and counted without special handling of the last word.
+ */
+class ValidityBitmap {
+ public:
+  using Word = uint64_t;
+  static constexpr auto WORD_SIZE = sizeof(Word) * 8;
+
+  // Creates a bitmap in which all positions that are not NULL in @param null_values are set.
+  static ValidityBitmap from_null_values(const pmr_vector<bool>& null_values);
+
+  // Creates a bitmap of @param size positions that are either all set or all unset.
+  ValidityBitmap(const size_t size, const bool is_valid);
+
+  size_t size() const;
+  const std::vector<Word>& words() const;
+
+  bool is_valid(const ChunkOffset chunk_offset) const;
+
+  // Number of set positions.
+  size_t count() const;
+
+  // Bitwise combination with a bitmap of the same size, e.g., to combine the validity of two columns.
+  ValidityBitmap& operator&=(const ValidityBitmap& other);
+  ValidityBitmap& operator|=(const ValidityBitmap& other);
+
+  // Inverts all positions, so that the bitmap marks the NULL values.
+  void invert();
+
+ private:
+  // Unsets the bits beyond size() in the last word.
+  void _clear_padding();
+
+  size_t _size;
+  std::vector<Word> _words;
+};
+
+}  // namespace hyrise
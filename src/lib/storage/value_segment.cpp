@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <memory>
@@ -40,6 +41,8 @@ ValueSegment<T>::ValueSegment(pmr_vector<T>&& values, pmr_vector<bool>&& null_va
   // We cannot check for the capacity being equal because of the implementation details of vector<bool>
   DebugAssert(_values.capacity() <= _null_values->capacity(),
               "The capacity of values and null_values should be compatible");
+
+  _contains_null_values = std::find(_null_values->cbegin(), _null_values->cend(), true) != _null_values->cend();
 }
 
 template <typename T>
@@ -79,6 +82,9 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   access_counter[SegmentAccessCounter::AccessType::Point] += 1;
 
   if (is_nullable()) {
+    if (is_null) {
+      _contains_null_values = true;
+    }
     (*_null_values).push_back(is_null);
     _values.push_back(is_null ? T{} : boost::get<T>(val));
     return;
@@ -89,6 +95,31 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   _values.push_back(boost::get<T>(val));
 }
 
+template <typename T>
+void ValueSegment<T>::append_values(const std::span<const T> values, const std::span<const bool> null_values) {
+  Assert(_values.size() + values.size() <= _values.capacity(), "ValueSegment is full");
+  DebugAssert(null_values.empty() || null_values.size() == values.size(), "Expected one NULL flag per value.");
+  access_counter[SegmentAccessCounter::AccessType::Sequential] += values.size();
+
+  const auto contains_null_values = std::find(null_values.begin(), null_values.end(), true) != null_values.end();
+  if (is_nullable()) {
+    if (contains_null_values) {
+      _contains_null_values = true;
+    }
+
+    if (null_values.empty()) {
+      _null_values->resize(_null_values->size() + values.size(), false);
+    } else {
+      _null_values->insert(_null_values->end(), null_values.begin(), null_values.end());
+    }
+  } else {
+    Assert(!contains_null_values, "ValueSegment is not nullable but values passed are null.");
+  }
+
+  // As for append(), the NULL flags are written before the values, which determine the segment's size.
+  _values.insert(_values.end(), values.begin(), values.end());
+}
+
 template <typename T>
 const pmr_vector<T>& ValueSegment<T>::values() const {
   return _values;
@@ -104,6 +135,11 @@ bool ValueSegment<T>::is_nullable() const {
   return static_cast<bool>(_null_values);
 }
 
+template <typename T>
+bool ValueSegment<T>::contains_null_values() const {
+  return _contains_null_values;
+}
+
 template <typename T>
 const pmr_vector<bool>& ValueSegment<T>::null_values() const {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
@@ -116,6 +152,7 @@ void ValueSegment<T>::set_null_value(const ChunkOffset chunk_offset) {
   Assert(is_nullable(), "This ValueSegment does not support null values.");
 
   const auto lock = std::lock_guard<std::mutex>{_null_value_modification_mutex};
+  _contains_null_values = true;
   (*_null_values)[chunk_offset] = true;
 }
 
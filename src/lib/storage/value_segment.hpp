@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -46,6 +48,11 @@ class ValueSegment : public BaseValueSegment {
   // sufficient capacity.
   void append(const AllTypeVariant& val) final;
 
+  // Add values to the end of the segment without boxing them into AllTypeVariants. `null_values` is either empty (no
+  // value is NULL) or holds one entry per value. Not thread-safe. May fail if ValueSegment was not initially created
+  // with sufficient capacity.
+  void append_values(const std::span<const T> values, const std::span<const bool> null_values = {});
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = segment.values(); and then: values.at(i); in your loop.
@@ -55,6 +62,10 @@ class ValueSegment : public BaseValueSegment {
   // Return whether segment supports null values.
   bool is_nullable() const final;
 
+  // Return whether at least one value is NULL. As NULL values are never removed, this is false for segments that are
+  // not nullable and for nullable segments to which no NULL value has been written (yet).
+  bool contains_null_values() const final;
+
   // Return null value vector that indicates whether a value is null with true at position i.
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
@@ -82,8 +93,15 @@ class ValueSegment : public BaseValueSegment {
 
  protected:
   pmr_vector<T> _values;
+
+  // vector<bool> is bit-packed, but it does not expose its words. Scans that combine NULL values with their matches
+  // word by word convert it into a ValidityBitmap. contains_null_values() lets readers skip the vector entirely for
+  // segments without NULL values. Encoded segments use their own NULL representations.
   std::optional<pmr_vector<bool>> _null_values;
 
+  // Set before a NULL value is written so that readers that observe the NULL value also observe the flag.
+  std::atomic_bool _contains_null_values{false};
+
   // Protects set_null_value. Does not need to be acquired for reads, as we expect modifications to vector<bool> to be
   // atomic.
   std::mutex _null_value_modification_mutex;
@@ -20,7 +20,9 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
-    if (_segment.is_nullable()) {
+    // Nullable segments without NULL values are iterated as if they were not nullable. This way, the compiler can drop
+    // NULL checks of the functor as NonNullSegmentPosition::is_null() always returns false.
+    if (_segment.contains_null_values()) {
       auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values().cbegin()};
       auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values().cend()};
       functor(begin, end);
@@ -37,7 +39,7 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
     using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
 
-    if (_segment.is_nullable()) {
+    if (_segment.contains_null_values()) {
       auto begin = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values().cbegin(),
                                                             position_filter->cbegin(), position_filter->cbegin()};
       auto end = PointAccessIterator<PosListIteratorType>{_segment.values().cbegin(), _segment.null_values().cbegin(),
@@ -20,4 +20,12 @@ inline void set_atomic_max(std::atomic<CommitID>& maximum_value, const CommitID&
          !maximum_value.compare_exchange_weak(prev_value, value)) {}
 }
 
+// std::min()-like assignment for std::atomic<T>. For CommitIDs, MAX_COMMIT_ID is the highest value and thus treated
+// like it was unset without requiring a specialization.
+template <typename T>
+inline void set_atomic_min(std::atomic<T>& minimum_value, const T& value) noexcept {
+  auto prev_value = minimum_value.load();
+  while (value < prev_value && !minimum_value.compare_exchange_weak(prev_value, value)) {}
+}
+
 }  // namespace hyrise
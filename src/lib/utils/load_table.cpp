@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <fstream>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,7 @@
 
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
+#include "storage/column_span.hpp"
 #include "storage/table.hpp"
 #include "storage/table_column_definition.hpp"
 #include "string_utils.hpp"
@@ -61,30 +63,66 @@ std::shared_ptr<Table> load_table(const std::string& file_name, ChunkOffset chun
 
   auto table = create_table_from_header(infile, chunk_size);
 
+  // Rows are parsed column-wise into typed vectors and appended in batches of up to `chunk_size` rows. This avoids
+  // boxing every value into an AllTypeVariant.
+  auto rows = std::vector<std::vector<std::string>>{};
+  rows.reserve(chunk_size);
+
+  const auto append_rows = [&]() {
+    const auto row_count = rows.size();
+    const auto column_count = table->column_count();
+    auto column_spans = std::vector<ColumnSpan>{};
+    column_spans.reserve(column_count);
+
+    // Keep the parsed values alive until they are appended.
+    auto column_values = std::vector<std::shared_ptr<const void>>(column_count);
+    auto column_null_values = std::vector<std::unique_ptr<bool[]>>(column_count);  // NOLINT(modernize-avoid-c-arrays)
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        auto values = std::make_shared<std::vector<ColumnDataType>>(row_count);
+        auto null_values = std::span<const bool>{};
+        auto& nulls = column_null_values[column_id];
+        if (table->column_is_nullable(column_id)) {
+          nulls = std::make_unique<bool[]>(row_count);  // NOLINT(modernize-avoid-c-arrays)
+          null_values = {nulls.get(), row_count};
+        }
+
+        for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+          const auto& string_value = rows[row_id][column_id];
+          if (nulls && string_value == "null") {
+            nulls[row_id] = true;
+            continue;
+          }
+          (*values)[row_id] = boost::lexical_cast<ColumnDataType>(string_value);
+        }
+
+        column_spans.emplace_back(*values, null_values);
+        column_values[column_id] = values;
+      });
+    }
+
+    table->append_columns(column_spans);
+    rows.clear();
+  };
+
   auto line = std::string{};
   while (std::getline(infile, line)) {
-    const auto string_values = split_string_by_delimiter(line, '|');
-    auto variant_values = std::vector<AllTypeVariant>(string_values.size());
-
-    const auto string_value_count = string_values.size();
-    for (auto column_id = ColumnID{0}; column_id < string_value_count; ++column_id) {
-      if (table->column_is_nullable(column_id) && string_values[column_id] == "null") {
-        variant_values[column_id] = NULL_VALUE;
-      } else {
-        resolve_data_type(table->column_data_type(column_id), [&](auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-          variant_values[column_id] = AllTypeVariant{boost::lexical_cast<ColumnDataType>(string_values[column_id])};
-        });
-      }
-    }
+    rows.emplace_back(split_string_by_delimiter(line, '|'));
+    Assert(rows.back().size() == table->column_count(), "load_table: Unexpected number of values in '" + line + "'.");
 
-    table->append(variant_values);
+    if (rows.size() == chunk_size) {
+      append_rows();
+    }
+  }
 
-    const auto mvcc_data = table->last_chunk()->mvcc_data();
-    mvcc_data->set_begin_cid(ChunkOffset{table->last_chunk()->size() - 1}, CommitID{0});
+  if (!rows.empty()) {
+    append_rows();
   }
 
-  // All other chunks have been marked as immutable by `Table::append()` when they reached their capacity.
+  // All other chunks have been marked as immutable by `Table::append_columns()` when they reached their capacity.
   if (!table->empty() && mark_last_chunk_immutable == SetLastChunkImmutable::Yes) {
     table->last_chunk()->set_immutable();
   }
@@ -16,12 +16,15 @@
 #include "utils/meta_tables/meta_exec_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_running_queries_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
 #include "utils/meta_tables/meta_system_information_table.hpp"
 #include "utils/meta_tables/meta_system_utilization_table.hpp"
 #include "utils/meta_tables/meta_tables_table.hpp"
+#include "utils/meta_tables/meta_task_queues_table.hpp"
+#include "utils/meta_tables/meta_workers_table.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace {
@@ -53,9 +56,12 @@ MetaTableManager::MetaTableManager() {
                                                       std::make_shared<MetaSegmentsTable>(),
                                                       std::make_shared<MetaSegmentsAccurateTable>(),
                                                       std::make_shared<MetaPluginsTable>(),
+                                                      std::make_shared<MetaRunningQueriesTable>(),
                                                       std::make_shared<MetaSettingsTable>(),
                                                       std::make_shared<MetaSystemInformationTable>(),
-                                                      std::make_shared<MetaSystemUtilizationTable>()};
+                                                      std::make_shared<MetaSystemUtilizationTable>(),
+                                                      std::make_shared<MetaTaskQueuesTable>(),
+                                                      std::make_shared<MetaWorkersTable>()};
 
   _table_names.reserve(_meta_tables.size());
   for (const auto& table : meta_tables) {
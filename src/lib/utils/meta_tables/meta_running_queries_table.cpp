@@ -0,0 +1,62 @@
+#include "meta_running_queries_table.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "storage/table.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+MetaRunningQueriesTable::MetaRunningQueriesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"query_id", DataType::Long, false},
+                                               {"description", DataType::String, false},
+                                               {"weight", DataType::Int, false},
+                                               {"max_parallelism", DataType::Int, false},
+                                               {"elapsed_time_ns", DataType::Long, false},
+                                               {"estimated_memory_usage", DataType::Long, false},
+                                               {"scheduled_tasks", DataType::Long, false},
+                                               {"finished_tasks", DataType::Long, false},
+                                               {"outstanding_tasks", DataType::Long, false},
+                                               {"running_tasks", DataType::Long, false},
+                                               {"deferred_tasks", DataType::Long, false},
+                                               {"execution_time_ns", DataType::Long, false}}) {}
+
+const std::string& MetaRunningQueriesTable::name() const {
+  static const auto name = std::string{"running_queries"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaRunningQueriesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+
+  const auto now = std::chrono::steady_clock::now();
+  for (const auto& query_context : Hyrise::get().workload_manager.running_queries()) {
+    const auto& options = query_context->options();
+    const auto elapsed_time = std::chrono::duration_cast<std::chrono::nanoseconds>(now - query_context->start_time());
+    // The counters are read one after another while tasks finish concurrently.
+    const auto scheduled_task_count = query_context->scheduled_task_count();
+    const auto finished_task_count = query_context->finished_task_count();
+    const auto outstanding_task_count =
+        scheduled_task_count > finished_task_count ? scheduled_task_count - finished_task_count : 0;
+    output_table->append({static_cast<int64_t>(query_context->id()), pmr_string{query_context->description()},
+                          static_cast<int32_t>(options.weight), static_cast<int32_t>(options.max_parallelism),
+                          static_cast<int64_t>(elapsed_time.count()),
+                          static_cast<int64_t>(query_context->estimated_memory_usage()),
+                          static_cast<int64_t>(scheduled_task_count), static_cast<int64_t>(finished_task_count),
+                          static_cast<int64_t>(outstanding_task_count),
+                          static_cast<int64_t>(query_context->running_task_count()),
+                          static_cast<int64_t>(query_context->deferred_task_count()),
+                          static_cast<int64_t>(query_context->execution_duration().count())});
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+/**
+ * This is a class for showing the queries that are currently registered at the WorkloadManager and their task
+ * statistics (see QueryContext).
+ */
+class MetaRunningQueriesTable : public AbstractMetaTable {
+ public:
+  MetaRunningQueriesTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaRunningQueriesTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,65 @@
+#include "meta_task_queues_table.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+#include "storage/table.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+MetaTaskQueuesTable::MetaTaskQueuesTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"node_id", DataType::Int, false},
+                                               {"worker_count", DataType::Int, false},
+                                               {"idle_workers", DataType::Int, false},
+                                               {"high_priority_tasks", DataType::Long, false},
+                                               {"default_priority_tasks", DataType::Long, false},
+                                               {"worker_deque_tasks", DataType::Long, false},
+                                               {"estimated_load", DataType::Long, false}}) {}
+
+const std::string& MetaTaskQueuesTable::name() const {
+  static const auto name = std::string{"task_queues"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaTaskQueuesTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler());
+  if (!scheduler) {
+    return output_table;
+  }
+
+  for (const auto& queue : scheduler->queues()) {
+    // Nodes without workers do not have a queue.
+    if (!queue) {
+      continue;
+    }
+
+    // Tasks that workers push to their own deques (e.g., successors of finished tasks) bypass the node's queue.
+    auto worker_deque_task_count = size_t{0};
+    for (const auto& deque : queue->worker_deques()) {
+      worker_deque_task_count += deque->size_approx();
+    }
+
+    output_table->append({static_cast<int32_t>(queue->node_id()),
+                          static_cast<int32_t>(queue->worker_deques().size()),
+                          static_cast<int32_t>(queue->idle_worker_count()),
+                          static_cast<int64_t>(queue->task_count(SchedulePriority::High)),
+                          static_cast<int64_t>(queue->task_count(SchedulePriority::Default)),
+                          static_cast<int64_t>(worker_deque_task_count),
+                          static_cast<int64_t>(queue->estimate_load())});
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
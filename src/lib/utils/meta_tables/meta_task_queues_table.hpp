@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+/**
+ * This is a class for showing the TaskQueues of the NodeQueueScheduler (one per node) and how many tasks are waiting in
+ * them. As the queues are not locked, the numbers are estimations. The table is empty if no NodeQueueScheduler is
+ * active.
+ */
+class MetaTaskQueuesTable : public AbstractMetaTable {
+ public:
+  MetaTaskQueuesTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaTaskQueuesTableTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace hyrise
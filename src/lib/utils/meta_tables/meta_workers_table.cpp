@@ -0,0 +1,53 @@
+#include "meta_workers_table.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/table.hpp"
+#include "storage/table_column_definition.hpp"
+#include "types.hpp"
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+MetaWorkersTable::MetaWorkersTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"worker_id", DataType::Int, false},
+                                               {"node_id", DataType::Int, false},
+                                               {"cpu_id", DataType::Int, false},
+                                               {"finished_tasks", DataType::Long, false},
+                                               {"stolen_tasks", DataType::Long, false},
+                                               {"idle_time_ns", DataType::Long, false},
+                                               {"current_task_id", DataType::Long, true}}) {}
+
+const std::string& MetaWorkersTable::name() const {
+  static const auto name = std::string{"workers"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaWorkersTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+
+  const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler());
+  if (!scheduler) {
+    return output_table;
+  }
+
+  for (const auto& worker : scheduler->workers()) {
+    const auto current_task_id = worker->current_task_id();
+    output_table->append({static_cast<int32_t>(worker->id()), static_cast<int32_t>(worker->queue()->node_id()),
+                          static_cast<int32_t>(worker->cpu_id()), static_cast<int64_t>(worker->num_finished_tasks()),
+                          static_cast<int64_t>(worker->num_stolen_tasks()),
+                          static_cast<int64_t>(worker->idle_duration().count()),
+                          current_task_id ? AllTypeVariant{static_cast<int64_t>(*current_task_id)} : NULL_VALUE});
+  }
+
+  return output_table;
+}
+
+}  // namespace hyrise
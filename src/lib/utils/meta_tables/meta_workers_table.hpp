@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace hyrise {
+
+/**
+ * This is a class for showing the workers of the NodeQueueScheduler and their statistics, e.g., how many tasks they
+ * executed or stole and how long they have been idle. The table is empty if no NodeQueueScheduler is active.
+ */
+class MetaWorkersTable : public AbstractMetaTable {
+ public:
+  MetaWorkersTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaWorkersTableTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,67 @@
+#include "numa_placement.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+size_t place_table_on_numa_nodes(Table& table, const NumaPlacement placement) {
+  Assert(table.type() == TableType::Data, "Only data tables can be placed on NUMA nodes.");
+
+  const auto& topology = Hyrise::get().topology;
+  auto node_ids = std::vector<NodeID>{};
+  const auto& nodes = topology.nodes();
+  for (auto node_id = NodeID{0}; node_id < nodes.size(); ++node_id) {
+    if (!nodes[node_id].cpus.empty()) {
+      node_ids.emplace_back(node_id);
+    }
+  }
+
+  const auto node_count = node_ids.size();
+  if (node_count < 2) {
+    return 0;
+  }
+
+  const auto chunk_count = table.chunk_count();
+  const auto chunks_per_node = (static_cast<size_t>(chunk_count) + node_count - 1) / node_count;
+
+  auto migrated_chunk_count = std::atomic_size_t{0};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->has_indexes()) {
+      continue;
+    }
+
+    const auto node_index = placement == NumaPlacement::RoundRobin ? chunk_id % node_count : chunk_id / chunks_per_node;
+    const auto node_id = node_ids[node_index];
+    if (chunk->node_id() == node_id) {
+      continue;
+    }
+
+    auto job_task = std::make_shared<JobTask>([&, chunk, node_id]() {
+      chunk->migrate(topology.get_memory_resource(node_id));
+      ++migrated_chunk_count;
+    });
+    job_task->set_preferred_node_id(node_id);
+    jobs.emplace_back(job_task);
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return migrated_chunk_count;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+enum class NumaPlacement {
+  // Chunk i is placed on the (i % node_count)-th node.
+  RoundRobin,
+  // The chunks are split into node_count ranges of consecutive chunks. For tables that are clustered by a key (e.g.,
+  // by their primary key or a date), this partitions the table by key ranges, so that scans with selective predicates
+  // on the key only touch few nodes.
+  Contiguous
+};
+
+/**
+ * Partitions the chunks of a data table across the nodes of the topology that have CPUs and migrates their segments to
+ * node-local memory (see NumaMemoryResource and Chunk::migrate()). Operators then process each chunk on the node that
+ * holds its data (see Chunk::node_id()). The migration of a chunk is scheduled on its target node, so that the
+ * segments are copied by a worker of that node.
+ *
+ * Only immutable chunks are placed, as rows might be concurrently appended to mutable chunks. Chunks with chunk indexes
+ * are skipped as well, as they cannot be migrated. As the migration replaces the chunks' segments, it must not run
+ * concurrently with queries on the table. Thus, tables should be placed right after they have been loaded.
+ *
+ * Returns the number of migrated chunks, which is zero if the topology has fewer than two nodes with CPUs.
+ */
+size_t place_table_on_numa_nodes(Table& table, NumaPlacement placement = NumaPlacement::RoundRobin);
+
+}  // namespace hyrise
@@ -0,0 +1,137 @@
+#include "point_lookup.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "tsl/sparse_set.h"
+
+#include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+std::optional<RowID> find_visible_row(const Table& table, const PointLookupKey& key,
+                                      const TransactionContext& transaction_context) {
+  Assert(!key.empty(), "Expected at least one key column.");
+  Assert(table.uses_mvcc() == UseMvcc::Yes, "Point lookups require MVCC data to check the visibility of rows.");
+  if constexpr (HYRISE_DEBUG) {
+    for (const auto& [column_id, value] : key) {
+      Assert(!variant_is_null(value) && data_type_from_all_type_variant(value) == table.column_data_type(column_id),
+             "Key values must be non-NULL and of the columns' data types.");
+    }
+  }
+
+  const auto our_tid = transaction_context.transaction_id();
+  const auto snapshot_commit_id = transaction_context.snapshot_commit_id();
+
+  // Checks the visibility of a candidate row whose first key column matches and compares the remaining key columns.
+  const auto is_match = [&](const RowID row_id) {
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    if (!chunk) {
+      // The chunk was physically deleted.
+      return false;
+    }
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_offset = row_id.chunk_offset;
+    if (!Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->get_tid(chunk_offset),
+                                  mvcc_data->get_begin_cid(chunk_offset), mvcc_data->get_end_cid(chunk_offset))) {
+      return false;
+    }
+
+    const auto key_column_count = key.size();
+    for (auto key_column_idx = size_t{1}; key_column_idx < key_column_count; ++key_column_idx) {
+      const auto& [column_id, value] = key[key_column_idx];
+      if ((*chunk->get_segment(column_id))[chunk_offset] != value) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const auto& [first_column_id, first_value] = key.front();
+  auto result = std::optional<RowID>{};
+
+  // Resolve the candidates of indexed chunks using the table index. The indexed chunks are retrieved before accessing
+  // the index so that chunks indexed in the meantime are scanned.
+  auto indexed_chunk_ids = tsl::sparse_set<ChunkID>{};
+  const auto table_indexes = table.get_table_indexes(first_column_id);
+  if (!table_indexes.empty()) {
+    const auto& table_index = table_indexes.front();
+    indexed_chunk_ids = table_index->get_indexed_chunk_ids();
+    table_index->range_equals_with_iterators(
+        [&](auto index_iter, const auto index_end) {
+          for (; index_iter != index_end; ++index_iter) {
+            if (is_match(*index_iter)) {
+              result = *index_iter;
+              return;
+            }
+          }
+        },
+        first_value);
+
+    if (result) {
+      return result;
+    }
+  }
+
+  // Scan the remaining chunks, which are usually the mutable ones that recently received inserts.
+  resolve_data_type(table.column_data_type(first_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto& search_value = boost::get<ColumnDataType>(first_value);
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && !result; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk || indexed_chunk_ids.contains(chunk_id)) {
+        continue;
+      }
+
+      // Segments of mutable chunks might already have been grown by concurrent Inserts. Rows beyond the chunk's size
+      // are not yet completely written, so we stop there.
+      const auto chunk_size = chunk->size();
+      segment_with_iterators<ColumnDataType>(
+          *chunk->get_segment(first_column_id), [&](auto segment_iter, const auto segment_end) {
+            for (; segment_iter != segment_end; ++segment_iter) {
+              const auto chunk_offset = segment_iter->chunk_offset();
+              if (chunk_offset >= chunk_size) {
+                return;
+              }
+
+              if (!segment_iter->is_null() && segment_iter->value() == search_value &&
+                  is_match(RowID{chunk_id, chunk_offset})) {
+                result = RowID{chunk_id, chunk_offset};
+                return;
+              }
+            }
+          });
+    }
+  });
+
+  return result;
+}
+
+std::vector<AllTypeVariant> materialize_row(const Table& table, const RowID row_id) {
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  Assert(chunk && row_id.chunk_offset < chunk->size(), "Row does not exist.");
+
+  const auto column_count = table.column_count();
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    values.emplace_back((*chunk->get_segment(column_id))[row_id.chunk_offset]);
+  }
+  return values;
+}
+
+}  // namespace hyrise
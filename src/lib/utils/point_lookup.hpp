@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+class TransactionContext;
+
+// Equality predicates on (ColumnID, value) pairs that identify a single row, usually by its primary key. The values
+// must be of the columns' data types.
+using PointLookupKey = std::vector<std::pair<ColumnID, AllTypeVariant>>;
+
+/**
+ * Point lookups for single-row OLTP statements. In contrast to a query plan of GetTable, TableScan/IndexScan, and
+ * Validate, no intermediate tables are created: The candidate rows are resolved from a PartialHashIndex on the first
+ * key column (or by scanning the chunks not covered by such an index), their visibility is checked inline, and the
+ * remaining key columns are compared for the visible candidates only. Thus, the first key column should be the most
+ * selective indexed one.
+ *
+ * Returns the RowID of the first row that matches the key and is visible to the transaction, or std::nullopt.
+ */
+std::optional<RowID> find_visible_row(const Table& table, const PointLookupKey& key,
+                                      const TransactionContext& transaction_context);
+
+// Returns the values of all columns of the given row.
+std::vector<AllTypeVariant> materialize_row(const Table& table, RowID row_id);
+
+}  // namespace hyrise
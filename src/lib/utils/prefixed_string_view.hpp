@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+/**
+ * Non-owning, 16-byte view on a string that keeps the string's length and its first four characters inline (similar to
+ * the string representation of Umbra, also known as "German strings"). Strings of up to twelve characters are stored
+ * entirely inline. For longer strings, the remaining eight bytes hold a pointer to the characters, which need to
+ * outlive the view.
+ *
+ * Comparisons first compare the inlined prefixes and only dereference the pointer if the prefixes are equal. Thus,
+ * sorting a vector of PrefixedStringViews mostly works on contiguous memory, whereas sorting pmr_strings chases a
+ * pointer for every comparison of strings that do not fit into the small string buffer (and copies 32 bytes per
+ * move). The ordering is the same as the one of std::string_view.
+ *
+ * The Sort operator sorts PrefixedStringViews on the strings it materialized. The sort-merge join materializes string
+ * columns as PrefixedStringViews whose characters are owned by a PrefixedStringHeap per segment (see
+ * ColumnMaterializer). Segments still store pmr_strings, and scans compare them directly.
+ */
+class PrefixedStringView {
+ public:
+  static constexpr auto PREFIX_SIZE = size_t{4};
+  static constexpr auto INLINE_SIZE = size_t{12};
+
+  PrefixedStringView() = default;
+
+  explicit PrefixedStringView(const std::string_view string) : _size{static_cast<uint32_t>(string.size())} {
+    DebugAssert(string.size() <= std::numeric_limits<uint32_t>::max(), "String is too long.");
+    if (string.size() <= INLINE_SIZE) {
+      std::memcpy(_inlined.data(), string.data(), string.size());
+      return;
+    }
+
+    std::memcpy(_inlined.data(), string.data(), PREFIX_SIZE);
+    const auto* const data = string.data();
+    std::memcpy(_inlined.data() + PREFIX_SIZE, &data, sizeof(data));
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  const char* data() const {
+    if (_size <= INLINE_SIZE) {
+      return _inlined.data();
+    }
+
+    const char* data = nullptr;
+    std::memcpy(&data, _inlined.data() + PREFIX_SIZE, sizeof(data));
+    return data;
+  }
+
+  std::string_view view() const {
+    return {data(), _size};
+  }
+
+  friend bool operator==(const PrefixedStringView& lhs, const PrefixedStringView& rhs) {
+    // Compare the length and the prefix first. Unused bytes of the prefix are zero.
+    if (lhs._size != rhs._size || std::memcmp(lhs._inlined.data(), rhs._inlined.data(), PREFIX_SIZE) != 0) {
+      return false;
+    }
+
+    if (lhs._size <= PREFIX_SIZE) {
+      return true;
+    }
+
+    return std::memcmp(lhs.data() + PREFIX_SIZE, rhs.data() + PREFIX_SIZE, lhs._size - PREFIX_SIZE) == 0;
+  }
+
+  friend std::strong_ordering operator<=>(const PrefixedStringView& lhs, const PrefixedStringView& rhs) {
+    // Unused bytes of the prefix are zero. If the prefixes differ, a shorter string thus compares as smaller than a
+    // longer string it is a prefix of, which matches the lexicographical order.
+    const auto prefix_comparison = std::memcmp(lhs._inlined.data(), rhs._inlined.data(), PREFIX_SIZE);
+    if (prefix_comparison != 0) {
+      return prefix_comparison <=> 0;
+    }
+
+    return lhs.view() <=> rhs.view();
+  }
+
+ private:
+  uint32_t _size{0};
+
+  // The first PREFIX_SIZE bytes hold the prefix. The remaining bytes either hold the rest of an inlined string or the
+  // pointer to the characters of a longer string.
+  std::array<char, INLINE_SIZE> _inlined{};
+};
+
+static_assert(sizeof(PrefixedStringView) == 16, "PrefixedStringView is expected to fit into 16 bytes.");
+
+/**
+ * Owns the characters of PrefixedStringViews that do not fit inline. Strings are copied into large blocks, so that
+ * materializing a segment performs a few allocations instead of one per long string, and the strings of a segment are
+ * stored close to each other. Blocks are never reallocated: The views stay valid until the heap is destroyed, also when
+ * the heap is moved.
+ */
+class PrefixedStringHeap {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{64 * 1024};
+
+  PrefixedStringView add(const std::string_view string) {
+    if (string.size() <= PrefixedStringView::INLINE_SIZE) {
+      return PrefixedStringView{string};
+    }
+
+    if (_blocks.empty() || _blocks.back().capacity() - _blocks.back().size() < string.size()) {
+      _blocks.emplace_back().reserve(std::max(BLOCK_SIZE, string.size()));
+    }
+
+    // Inserting within the capacity does not reallocate the block.
+    auto& block = _blocks.back();
+    const auto offset = block.size();
+    block.insert(block.end(), string.begin(), string.end());
+    return PrefixedStringView{std::string_view{block.data() + offset, string.size()}};
+  }
+
+  size_t block_count() const {
+    return _blocks.size();
+  }
+
+ private:
+  std::vector<std::vector<char>> _blocks;
+};
+
+}  // namespace hyrise
+
+namespace std {
+
+template <>
+struct hash<hyrise::PrefixedStringView> {
+  size_t operator()(const hyrise::PrefixedStringView& string) const {
+    return std::hash<std::string_view>{}(string.view());
+  }
+};
+
+}  // namespace std
@@ -0,0 +1,307 @@
+#include "chunk_compaction_plugin.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/assert.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+std::string ChunkCompactionPlugin::description() const {
+  return "Chunk compaction plugin";
+}
+
+void ChunkCompactionPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t /*unused*/) {
+    _compaction_loop();
+  });
+}
+
+void ChunkCompactionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+  _compacted_chunks.clear();
+  _written_chunks.clear();
+}
+
+void ChunkCompactionPlugin::_compaction_loop() {
+  _delete_compacted_chunks();
+
+  const auto tables = Hyrise::get().storage_manager.tables();
+  std::erase_if(_written_chunks, [&](const auto& table_and_written_chunks) {
+    return std::none_of(tables.cbegin(), tables.cend(), [&](const auto& table_name_and_table) {
+      return table_name_and_table.second == table_and_written_chunks.first;
+    });
+  });
+
+  for (const auto& [table_name, table] : tables) {
+    if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    auto& written_chunks = _written_chunks[table];
+    auto compacted_chunk_count = size_t{0};
+    auto new_chunk_count = size_t{0};
+    for (const auto& chunk_ids : _select_chunks(*table, written_chunks)) {
+      if (!_try_compact_chunks(table_name, chunk_ids, written_chunks)) {
+        continue;
+      }
+
+      for (const auto chunk_id : chunk_ids) {
+        _compacted_chunks.emplace_back(table, chunk_id);
+        written_chunks.erase(chunk_id);
+      }
+      compacted_chunk_count += chunk_ids.size();
+      ++new_chunk_count;
+    }
+
+    if (compacted_chunk_count > 0) {
+      auto message = std::ostringstream{};
+      message << "Compacted " << compacted_chunk_count << " chunk(s) of " << table_name << " into " << new_chunk_count
+              << " chunk(s)";
+      Hyrise::get().log_manager.add_message("ChunkCompactionPlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
+
+void ChunkCompactionPlugin::_delete_compacted_chunks() {
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+
+  std::erase_if(_compacted_chunks, [&](const auto& table_and_chunk_id) {
+    const auto& [table, chunk_id] = table_and_chunk_id;
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) {
+      // Another plugin already removed the chunk.
+      return true;
+    }
+
+    const auto cleanup_commit_id = chunk->get_cleanup_commit_id();
+    DebugAssert(cleanup_commit_id, "Compacted chunks must be deleted logically before deleting them physically.");
+    if (lowest_snapshot_commit_id && *cleanup_commit_id > *lowest_snapshot_commit_id) {
+      // Active transactions might still use the chunk.
+      return false;
+    }
+
+    for (const auto& table_index : table->get_table_indexes()) {
+      if (table_index->get_indexed_chunk_ids().contains(chunk_id)) {
+        table_index->remove({chunk_id});
+      }
+    }
+    table->remove_chunk(chunk_id);
+    return true;
+  });
+}
+
+std::vector<std::vector<ChunkID>> ChunkCompactionPlugin::_select_chunks(const Table& table,
+                                                                       const WrittenChunks& written_chunks) {
+  const auto target_chunk_size = static_cast<size_t>(table.target_chunk_size());
+  const auto max_valid_row_count = static_cast<double>(target_chunk_size) * OCCUPANCY_THRESHOLD;
+
+  auto chunk_groups = std::vector<std::vector<ChunkID>>{};
+  auto chunk_ids = std::vector<ChunkID>{};
+  auto valid_row_count = size_t{0};
+
+  const auto close_group = [&]() {
+    if (chunk_ids.size() >= MIN_CHUNKS_PER_COMPACTION) {
+      chunk_groups.emplace_back(std::move(chunk_ids));
+    }
+    chunk_ids = {};
+    valid_row_count = 0;
+  };
+
+  // The last chunk is skipped as it usually receives the inserted rows.
+  const auto max_chunk_id = static_cast<ChunkID>(table.chunk_count() - 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id()) {
+      continue;
+    }
+
+    const auto invalid_row_count = chunk->invalid_row_count();
+    const auto chunk_valid_row_count = static_cast<size_t>(chunk->size() - invalid_row_count);
+    if (static_cast<double>(chunk_valid_row_count) >= max_valid_row_count) {
+      continue;
+    }
+
+    const auto written_chunk_it = written_chunks.find(chunk_id);
+    if (written_chunk_it != written_chunks.end() && written_chunk_it->second == invalid_row_count) {
+      continue;
+    }
+
+    if (valid_row_count + chunk_valid_row_count > target_chunk_size) {
+      close_group();
+    }
+    chunk_ids.emplace_back(chunk_id);
+    valid_row_count += chunk_valid_row_count;
+  }
+  close_group();
+
+  return chunk_groups;
+}
+
+bool ChunkCompactionPlugin::_try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                                WrittenChunks& written_chunks) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  DebugAssert(std::is_sorted(chunk_ids.cbegin(), chunk_ids.cend()), "Expected sorted ChunkIDs.");
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto get_table = std::make_shared<GetTable>(table_name);
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  // Create a table that contains the given chunks only. The other chunks are excluded after GetTable pinned the
+  // table's chunks, as chunks that were appended in the meantime must not be compacted. If GetTable skipped one of the
+  // given chunks (e.g., because it was deleted in the meantime), we try again in the next iteration.
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  chunks.reserve(chunk_ids.size());
+  for (const auto stored_chunk_id : get_table->stored_chunk_ids()) {
+    if (std::binary_search(chunk_ids.cbegin(), chunk_ids.cend(), stored_chunk_id)) {
+      const auto chunk = table->get_chunk(stored_chunk_id);
+      if (chunk) {
+        chunks.emplace_back(chunk);
+      }
+    }
+  }
+
+  if (chunks.size() != chunk_ids.size()) {
+    transaction_context->rollback(RollbackReason::User);
+    return false;
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(
+      std::make_shared<Table>(table->column_definitions(), TableType::Data, chunks, UseMvcc::Yes));
+  table_wrapper->execute();
+
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(transaction_context);
+  validate->never_clear_output();
+  validate->execute();
+
+  // Keep the sort order if all chunks share it.
+  const auto& sort_definitions = table->get_chunk(chunk_ids.front())->individually_sorted_by();
+  const auto chunks_share_sort_order =
+      !sort_definitions.empty() && std::all_of(chunk_ids.cbegin(), chunk_ids.cend(), [&](const auto chunk_id) {
+        return table->get_chunk(chunk_id)->individually_sorted_by() == sort_definitions;
+      });
+
+  auto rows_to_insert = std::shared_ptr<const AbstractOperator>{validate};
+  if (chunks_share_sort_order) {
+    const auto sort = std::make_shared<Sort>(validate, sort_definitions, table->target_chunk_size());
+    sort->execute();
+    rows_to_insert = sort;
+  }
+
+  const auto delete_operator = std::make_shared<Delete>(validate);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+
+  if (delete_operator->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed Delete directly, that is
+    // our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  auto insert = std::shared_ptr<Insert>{};
+  if (validate->get_output()->row_count() > 0) {
+    insert = std::make_shared<Insert>(table_name, rows_to_insert, InsertChunkMode::NewChunk);
+    insert->set_transaction_context(transaction_context);
+    // Other threads can access the new chunk once it is added to the table. Thus, it is sorted, encoded, and indexed
+    // beforehand.
+    insert->set_new_chunk_preparation([&](const std::shared_ptr<Chunk>& chunk) {
+      if (chunks_share_sort_order) {
+        chunk->set_individually_sorted_by(sort_definitions);
+      }
+      _prepare_chunk(*table, chunk, chunk_ids.front());
+    });
+    insert->execute();
+  }
+
+  transaction_context->commit();
+
+  // Mark the compacted chunks as logically deleted.
+  const auto commit_id = transaction_context->commit_id();
+  for (const auto chunk_id : chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(commit_id);
+  }
+
+  if (insert) {
+    const auto new_chunk_ids = insert->target_chunk_ids();
+    DebugAssert(new_chunk_ids.size() == 1, "Expected the rows to be inserted into a single chunk.");
+    written_chunks[new_chunk_ids.front()] = table->get_chunk(new_chunk_ids.front())->invalid_row_count();
+    if (const auto full_chunk_id = insert->full_chunk_id()) {
+      written_chunks[*full_chunk_id] = table->get_chunk(*full_chunk_id)->invalid_row_count();
+    }
+  }
+
+  return true;
+}
+
+void ChunkCompactionPlugin::_prepare_chunk(const Table& table, const std::shared_ptr<Chunk>& chunk,
+                                           const ChunkID compacted_chunk_id) {
+  // The chunk is not part of the table yet and still mutable until the Insert commits. Thus, ChunkEncoder::
+  // encode_chunk() cannot be used, but we can replace its segments without other threads noticing.
+  // Use the encoding of the first compacted chunk. Encoding the chunk also generates its pruning statistics.
+  const auto& compacted_chunk = table.get_chunk(compacted_chunk_id);
+  const auto column_count = chunk->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment_encoding_spec = get_segment_encoding_spec(compacted_chunk->get_segment(column_id));
+    if (segment_encoding_spec.encoding_type == EncodingType::Unencoded) {
+      continue;
+    }
+
+    chunk->replace_segment(column_id, ChunkEncoder::encode_segment(chunk->get_segment(column_id),
+                                                                   table.column_data_type(column_id),
+                                                                   segment_encoding_spec));
+  }
+  generate_chunk_pruning_statistics(chunk);
+
+  // Indexes reference the segments, so they are created after encoding the chunk.
+  for (const auto& chunk_index_statistics : table.chunk_indexes_statistics()) {
+    switch (chunk_index_statistics.type) {
+      case ChunkIndexType::GroupKey:
+        chunk->create_index<GroupKeyIndex>(chunk_index_statistics.column_ids);
+        break;
+      case ChunkIndexType::CompositeGroupKey:
+        chunk->create_index<CompositeGroupKeyIndex>(chunk_index_statistics.column_ids);
+        break;
+      case ChunkIndexType::AdaptiveRadixTree:
+        chunk->create_index<AdaptiveRadixTreeIndex>(chunk_index_statistics.column_ids);
+        break;
+    }
+  }
+
+  // Table indexes store RowIDs rather than segments. The Insert adds the chunk to them once it is immutable.
+}
+
+EXPORT_PLUGIN(ChunkCompactionPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+/*
+ * Deletes and updates leave chunks with few valid rows behind. Every operator still has to process these chunks, so
+ * the per-chunk overhead grows with the number of sparse chunks. The MvccDeletePlugin re-inserts the valid rows of a
+ * single chunk through the ordinary Insert path, which adds them to the shared last chunk of the table. In contrast,
+ * this plugin merges several sparsely populated chunks into one new chunk.
+ *
+ * A chunk is a candidate for compaction if it is immutable, not logically deleted, and its valid rows occupy less than
+ * OCCUPANCY_THRESHOLD of the table's target chunk size. Adjacent candidates are grouped such that the valid rows of
+ * each group fit into a single chunk. Within one transaction, the plugin deletes the valid rows of a group and inserts
+ * them into a dedicated chunk (see InsertChunkMode::NewChunk). If all chunks of the group are sorted by the same
+ * columns, the rows are sorted accordingly. As the deletes and inserts are committed atomically, concurrent
+ * transactions either see the rows in their original chunks or in the new chunk. Conflicts with concurrent
+ * transactions roll back the compaction.
+ *
+ * Before the new chunk is added to the table, it is encoded like the first chunk of its group (which also generates
+ * its pruning statistics), and the table's chunk indexes are created for it. Thus, concurrent queries never see the
+ * chunk while it is modified. Once the Insert commits, the chunk is added to the table indexes. The compacted chunks
+ * are logically deleted by setting their cleanup commit ID. They are physically removed once no active transaction
+ * can see them anymore.
+ *
+ * The new chunk may be sparse itself, and the Insert marks the previous last chunk as full, which leaves a partially
+ * filled chunk behind. The plugin remembers both chunks and does not compact them again unless rows of them have been
+ * deleted since. Otherwise, each iteration would merge the chunks written by the previous one and mark the next last
+ * chunk as full.
+ */
+class ChunkCompactionPlugin : public AbstractPlugin {
+  friend class ChunkCompactionPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY: sleep after each iteration of the compaction loop
+   * OCCUPANCY_THRESHOLD: the share of valid rows (relative to the target chunk size) below which a chunk is compacted
+   * MIN_CHUNKS_PER_COMPACTION: the minimum number of chunks that are merged into a new chunk
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY = std::chrono::milliseconds(1000);
+  constexpr static double OCCUPANCY_THRESHOLD = 0.5;
+  constexpr static size_t MIN_CHUNKS_PER_COMPACTION = 2;
+
+ private:
+  using TableAndChunkID = std::pair<std::shared_ptr<Table>, ChunkID>;
+
+  void _compaction_loop();
+
+  // Physically removes compacted chunks that are not visible to any active transaction anymore.
+  void _delete_compacted_chunks();
+
+  // Invalid row counts of the chunks written or marked as full by the plugin, at the time of the compaction.
+  using WrittenChunks = std::unordered_map<ChunkID, ChunkOffset>;
+
+  // Returns groups of chunks whose valid rows fit into a single chunk. Written chunks are skipped unless they have more
+  // invalid rows than before.
+  static std::vector<std::vector<ChunkID>> _select_chunks(const Table& table, const WrittenChunks& written_chunks = {});
+
+  // Adds the new chunk and the chunk marked as full to `written_chunks` if the compaction succeeds.
+  static bool _try_compact_chunks(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                  WrittenChunks& written_chunks);
+
+  // Encodes the new chunk like the compacted chunk and creates the table's chunk indexes for it. Called by the Insert
+  // before the chunk is added to the table (see Insert::set_new_chunk_preparation()).
+  static void _prepare_chunk(const Table& table, const std::shared_ptr<Chunk>& chunk, ChunkID compacted_chunk_id);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+
+  std::vector<TableAndChunkID> _compacted_chunks;
+
+  std::unordered_map<std::shared_ptr<const Table>, WrittenChunks> _written_chunks;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,115 @@
+#include "chunk_finalization_plugin.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "hyrise.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/log_manager.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+std::string ChunkFinalizationPlugin::description() const {
+  return "Chunk finalization plugin";
+}
+
+void ChunkFinalizationPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t /*unused*/) {
+    _finalization_loop();
+  });
+}
+
+void ChunkFinalizationPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread.
+  _loop_thread.reset();
+}
+
+void ChunkFinalizationPlugin::_finalization_loop() {
+  auto remaining_chunk_count = MAX_CHUNKS_PER_ITERATION;
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto finalized_chunk_count = _finalize_chunks(table, remaining_chunk_count);
+    if (finalized_chunk_count == 0) {
+      continue;
+    }
+
+    auto message = std::ostringstream{};
+    message << "Finalized " << finalized_chunk_count << " chunk(s) of " << table_name;
+    if (_try_refresh_table_statistics(table)) {
+      message << " and refreshed its statistics";
+    }
+    Hyrise::get().log_manager.add_message("ChunkFinalizationPlugin", message.str(), LogLevel::Info);
+
+    remaining_chunk_count -= finalized_chunk_count;
+    if (remaining_chunk_count == 0) {
+      return;
+    }
+  }
+}
+
+size_t ChunkFinalizationPlugin::_finalize_chunks(const std::shared_ptr<Table>& table, const size_t max_chunk_count) {
+  auto finalized_chunk_count = size_t{0};
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && finalized_chunk_count < max_chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || !_chunk_requires_finalization(*chunk)) {
+      continue;
+    }
+
+    // Encoding the chunk also generates its pruning statistics.
+    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    ++finalized_chunk_count;
+  }
+
+  return finalized_chunk_count;
+}
+
+bool ChunkFinalizationPlugin::_chunk_requires_finalization(const Chunk& chunk) {
+  // Mutable chunks might still receive inserts or have pending inserts. Logically deleted chunks are about to be
+  // removed by the MvccDeletePlugin.
+  if (chunk.is_mutable() || chunk.get_cleanup_commit_id()) {
+    return false;
+  }
+
+  if (!chunk.pruning_statistics()) {
+    return true;
+  }
+
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (std::dynamic_pointer_cast<const BaseValueSegment>(chunk.get_segment(column_id))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ChunkFinalizationPlugin::_try_refresh_table_statistics(const std::shared_ptr<Table>& table) {
+  const auto table_statistics = table->table_statistics();
+  if (table_statistics) {
+    const auto row_count = static_cast<double>(table->row_count());
+    if (row_count <= table_statistics->row_count * (1.0 + STATISTICS_REFRESH_THRESHOLD)) {
+      return false;
+    }
+  }
+
+  // TableStatistics are immutable. Thus, we create new statistics and replace the old ones, which might still be used
+  // by concurrently running optimizations.
+  table->set_table_statistics(TableStatistics::from_table(*table));
+  return true;
+}
+
+EXPORT_PLUGIN(ChunkFinalizationPlugin);
+
+}  // namespace hyrise
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace hyrise {
+
+/*
+ * Chunks that are filled by Insert operators consist of unencoded ValueSegments and do not have pruning statistics.
+ * Furthermore, the table statistics used for cardinality estimation only reflect the rows that existed when they were
+ * created (usually, when the table was added to the StorageManager). This plugin periodically looks for chunks that
+ * have been finalized, i.e., chunks that are full and whose Inserts have all been committed or rolled back (see
+ * Chunk::mark_as_full()). Such chunks are immutable. The plugin encodes them with the default encoding, which also
+ * generates their pruning statistics. Once the row count of a table has grown by more than
+ * STATISTICS_REFRESH_THRESHOLD since its table statistics were created, the table statistics are recreated.
+ *
+ * To keep the impact on concurrently running queries low, the plugin finalizes at most MAX_CHUNKS_PER_ITERATION chunks
+ * before it sleeps for IDLE_DELAY. Chunks that are logically deleted by the MvccDeletePlugin are skipped. As with the
+ * ChunkEncoder, concurrently running operators keep using the segments they already hold.
+ */
+class ChunkFinalizationPlugin : public AbstractPlugin {
+  friend class ChunkFinalizationPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  /**
+   * IDLE_DELAY: sleep after each iteration of the finalization loop
+   * MAX_CHUNKS_PER_ITERATION: the maximum number of chunks that are encoded per iteration
+   * STATISTICS_REFRESH_THRESHOLD: the growth of a table's row count (relative to the row count of its table statistics)
+   * after which its table statistics are recreated
+   */
+  constexpr static std::chrono::milliseconds IDLE_DELAY = std::chrono::milliseconds(1000);
+  constexpr static size_t MAX_CHUNKS_PER_ITERATION = 8;
+  constexpr static double STATISTICS_REFRESH_THRESHOLD = 0.1;
+
+ private:
+  void _finalization_loop();
+
+  // Encodes up to `max_chunk_count` finalized chunks of the table and returns the number of encoded chunks.
+  static size_t _finalize_chunks(const std::shared_ptr<Table>& table, const size_t max_chunk_count);
+
+  static bool _chunk_requires_finalization(const Chunk& chunk);
+
+  // Recreates the table statistics if they are missing or outdated. Returns true if they were recreated.
+  static bool _try_refresh_table_statistics(const std::shared_ptr<Table>& table);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace hyrise
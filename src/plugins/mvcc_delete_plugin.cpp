@@ -62,11 +62,12 @@ void MvccDeletePlugin::_logical_delete_loop() {
     auto saved_memory = size_t{0};
     auto num_chunks = size_t{0};
 
-    // Check all chunks, except for the last one, which is currently used for insertions
+    // Check all chunks, except for the last one and other mutable chunks, which are currently used for insertions
+    // (see Table::set_insert_chunk_count()).
     const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
     for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; ++chunk_id) {
       const auto& chunk = table->get_chunk(chunk_id);
-      if (chunk && !chunk->get_cleanup_commit_id()) {
+      if (chunk && !chunk->is_mutable() && !chunk->get_cleanup_commit_id()) {
         const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
 
         // Calculate metric 1 – Chunk invalidation level
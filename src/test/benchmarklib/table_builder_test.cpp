@@ -38,4 +38,24 @@ TEST_F(TableBuilderTest, AppendsRows) {
   EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
 }
 
+TEST_F(TableBuilderTest, SplitsRowsIntoChunks) {
+  auto table_builder = TableBuilder(ChunkOffset{2}, table_builder_test_types, table_builder_test_names);
+  for (auto value = int32_t{0}; value < 5; ++value) {
+    table_builder.append_row(value, value % 2 == 0 ? std::optional<float>{} : std::optional<float>{1.0f}, "a");
+  }
+  const auto table = table_builder.finish_table();
+
+  ASSERT_EQ(table->chunk_count(), 3);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 2);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1);
+
+  // Full chunks are marked as immutable once the next chunk is appended.
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 4), 4);
+  EXPECT_FALSE(table->get_value<float>(ColumnID{1}, 2));
+  EXPECT_EQ(table->get_value<float>(ColumnID{1}, 3), 1.0f);
+}
+
 }  // namespace hyrise
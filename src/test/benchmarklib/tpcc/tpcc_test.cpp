@@ -8,6 +8,7 @@
 #include "tpcc/procedures/tpcc_new_order.hpp"
 #include "tpcc/procedures/tpcc_order_status.hpp"
 #include "tpcc/procedures/tpcc_payment.hpp"
+#include "tpcc/tpcc_benchmark_item_runner.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 
 namespace hyrise {
@@ -323,6 +324,29 @@ TEST_F(TPCCTest, NewOrder) {
   }
 }
 
+TEST_F(TPCCTest, NewOrderWithInsertChunks) {
+  auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  auto item_runner = TPCCBenchmarkItemRunner{benchmark_config, NUM_WAREHOUSES, false, 4};
+  item_runner.on_tables_loaded();
+  for (const auto& table_name : {"NEW_ORDER", "ORDER", "ORDER_LINE"}) {
+    EXPECT_EQ(Hyrise::get().storage_manager.get_table(table_name)->insert_chunk_count(), 4);
+  }
+
+  const auto old_order_line_size = Hyrise::get().storage_manager.get_table("ORDER_LINE")->row_count();
+  BenchmarkSQLExecutor sql_executor{nullptr, std::nullopt};
+  auto new_order = TPCCNewOrder{NUM_WAREHOUSES, sql_executor};
+  while (new_order.order_lines.back().ol_i_id == TPCCNewOrder::UNUSED_ITEM_ID) {
+    new_order = TPCCNewOrder{NUM_WAREHOUSES, sql_executor};
+  }
+  EXPECT_TRUE(new_order.execute());
+
+  auto new_sizes = initial_sizes;
+  new_sizes["NEW_ORDER"] += 1;
+  new_sizes["ORDER"] += 1;
+  new_sizes["ORDER_LINE"] = old_order_line_size + new_order.order_lines.size();
+  verify_table_sizes(new_sizes);
+}
+
 TEST_F(TPCCTest, NewOrderUnusedItemId) {
   BenchmarkSQLExecutor sql_executor{nullptr, std::nullopt};
   auto new_order = TPCCNewOrder{NUM_WAREHOUSES, sql_executor};
@@ -430,6 +454,36 @@ TEST_F(TPCCTest, PaymentCustomerByName) {
   }
 }
 
+TEST_F(TPCCTest, PaymentPointOperations) {
+  // The warehouse is resolved using the table index, the district by scanning the table.
+  Hyrise::get().storage_manager.get_table("WAREHOUSE")->create_partial_hash_index(ColumnID{0}, {ChunkID{0}});
+
+  BenchmarkSQLExecutor sql_executor{nullptr, std::nullopt};
+  auto payment = TPCCPayment{NUM_WAREHOUSES, sql_executor, true};
+  EXPECT_TRUE(payment.execute());
+
+  // Verify that W_YTD and D_YTD are updated exactly once
+  {
+    auto pipeline = SQLPipelineBuilder{std::string{"SELECT W_YTD FROM WAREHOUSE WHERE W_ID = "} +
+                                       std::to_string(payment.w_id)}
+                        .create_pipeline();
+    const auto [_, table] = pipeline.get_result_table();
+    ASSERT_TRUE(table);
+    ASSERT_EQ(table->row_count(), 1);
+    EXPECT_FLOAT_EQ(*table->get_value<float>("W_YTD", 0), 300'000.0f + payment.h_amount);
+  }
+
+  {
+    auto pipeline = SQLPipelineBuilder{std::string{"SELECT D_YTD FROM DISTRICT WHERE D_W_ID = "} +
+                                       std::to_string(payment.w_id) + " AND D_ID = " + std::to_string(payment.d_id)}
+                        .create_pipeline();
+    const auto [_, table] = pipeline.get_result_table();
+    ASSERT_TRUE(table);
+    ASSERT_EQ(table->row_count(), 1);
+    EXPECT_FLOAT_EQ(*table->get_value<float>("D_YTD", 0), 30'000.0f + payment.h_amount);
+  }
+}
+
 TEST_F(TPCCTest, OrderStatusCustomerById) {
   // We have covered customer selection by name in PaymentCustomerByName
   // As Order-Status has no externally visible changes, we create a new order and test for correct return values
@@ -0,0 +1,166 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "cache/result_cache.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class ResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl",
+                                                                  ChunkOffset{2}));
+    _result_cache = std::make_shared<ResultCache>();
+  }
+
+  // Executes the query and returns whether its result was taken from the cache.
+  bool execute(const std::string& query, const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{query}.with_result_cache(_result_cache);
+    if (transaction_context) {
+      builder.with_transaction_context(transaction_context);
+    }
+
+    auto sql_pipeline = builder.create_pipeline();
+    const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    _result_table = result_table;
+    return sql_pipeline.metrics().statement_metrics.back()->result_cache_hit;
+  }
+
+  std::shared_ptr<ResultCache> _result_cache;
+  std::shared_ptr<const Table> _result_table;
+};
+
+TEST_F(ResultCacheTest, CacheHit) {
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  const auto first_result = _result_table;
+  EXPECT_EQ(_result_cache->size(), 1);
+  EXPECT_GT(_result_cache->memory_usage(), 0);
+
+  // Queries with the same LQP share the cached result.
+  EXPECT_TRUE(execute("select  sum(a)  from table_a;"));
+  EXPECT_EQ(_result_table, first_result);
+  EXPECT_EQ(_result_table->get_value<int64_t>(ColumnID{0}, 0), 13702);
+
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a WHERE a > 200"));
+  EXPECT_EQ(_result_cache->size(), 2);
+
+  // Without a cache, the query is executed.
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT SUM(a) FROM table_a"}.create_pipeline();
+  EXPECT_NE(sql_pipeline.get_result_table().second, first_result);
+  EXPECT_FALSE(sql_pipeline.metrics().statement_metrics.back()->result_cache_hit);
+}
+
+TEST_F(ResultCacheTest, InvalidationByWriters) {
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_TRUE(execute("SELECT SUM(a) FROM table_a"));
+
+  // Writers invalidate the results of their tables once they commit.
+  execute("INSERT INTO table_a VALUES (1, 1.0)");
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_EQ(_result_table->get_value<int64_t>(ColumnID{0}, 0), 13703);
+  EXPECT_TRUE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_EQ(_result_cache->size(), 1);
+
+  execute("DELETE FROM table_a WHERE a = 123");
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_EQ(_result_table->get_value<int64_t>(ColumnID{0}, 0), 13580);
+
+  // Uncommitted and rolled back modifications do not invalidate the result.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (2, 2.0)", transaction_context);
+  EXPECT_TRUE(execute("SELECT SUM(a) FROM table_a"));
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_TRUE(execute("SELECT SUM(a) FROM table_a"));
+
+  // Replacing the table invalidates the result as well.
+  Hyrise::get().storage_manager.drop_table("table_a");
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl",
+                                                                ChunkOffset{2}));
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_EQ(_result_table->get_value<int64_t>(ColumnID{0}, 0), 13702);
+}
+
+TEST_F(ResultCacheTest, NoCachingWithinTransactions) {
+  // Transactions might see their own modifications, so they neither use nor fill the cache.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a", transaction_context));
+  EXPECT_EQ(_result_cache->size(), 0);
+
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a"));
+  EXPECT_FALSE(execute("SELECT SUM(a) FROM table_a", transaction_context));
+  transaction_context->commit();
+}
+
+TEST_F(ResultCacheTest, NoCachingOfMetaTables) {
+  EXPECT_FALSE(execute("SELECT * FROM meta_tables"));
+  EXPECT_FALSE(execute("SELECT * FROM meta_tables"));
+  EXPECT_EQ(_result_cache->size(), 0);
+}
+
+TEST_F(ResultCacheTest, MaterializeReferenceResults) {
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 200"));
+  auto expected_result = _result_table;
+  EXPECT_EQ(expected_result->type(), TableType::References);
+
+  // The cached result holds the values itself instead of referencing table_a.
+  EXPECT_TRUE(execute("SELECT * FROM table_a WHERE a > 200"));
+  EXPECT_EQ(_result_table->type(), TableType::Data);
+  EXPECT_TABLE_EQ_UNORDERED(_result_table, expected_result);
+
+  // Thus, the cache does not keep dropped tables alive. Their entries are removed when the next result is cached.
+  const auto table = std::weak_ptr<const Table>{Hyrise::get().storage_manager.get_table("table_a")};
+  expected_result = nullptr;
+  _result_table = nullptr;
+  Hyrise::get().storage_manager.drop_table("table_a");
+  EXPECT_TRUE(table.expired());
+  EXPECT_EQ(_result_cache->size(), 1);
+
+  Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_float.tbl"));
+  EXPECT_FALSE(execute("SELECT * FROM table_b WHERE a > 200"));
+  EXPECT_EQ(_result_cache->size(), 1);
+}
+
+TEST_F(ResultCacheTest, MemoryBoundedEviction) {
+  // Both queries return all rows of the table, so that their results have the same size.
+  execute("SELECT * FROM table_a WHERE a > 0");
+  const auto result_size = _result_cache->memory_usage();
+
+  // Only a single result fits into the cache.
+  _result_cache->resize(result_size);
+  execute("SELECT * FROM table_a WHERE a > 1");
+  EXPECT_EQ(_result_cache->size(), 1);
+  EXPECT_LE(_result_cache->memory_usage(), _result_cache->capacity());
+  EXPECT_TRUE(execute("SELECT * FROM table_a WHERE a > 1"));
+  EXPECT_FALSE(execute("SELECT * FROM table_a WHERE a > 0"));
+
+  // Results that exceed the capacity are not cached.
+  _result_cache->resize(1);
+  EXPECT_EQ(_result_cache->size(), 0);
+  EXPECT_EQ(_result_cache->memory_usage(), 0);
+  execute("SELECT * FROM table_a");
+  EXPECT_EQ(_result_cache->size(), 0);
+
+  _result_cache->resize(ResultCache::DEFAULT_CAPACITY);
+  execute("SELECT * FROM table_a");
+  EXPECT_EQ(_result_cache->size(), 1);
+  _result_cache->clear();
+  EXPECT_EQ(_result_cache->size(), 0);
+  EXPECT_EQ(_result_cache->memory_usage(), 0);
+}
+
+TEST_F(ResultCacheTest, DefaultResultCache) {
+  Hyrise::get().default_result_cache = _result_cache;
+  SQLPipelineBuilder{"SELECT SUM(a) FROM table_a"}.create_pipeline().get_result_table();
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT SUM(a) FROM table_a"}.create_pipeline();
+  sql_pipeline.get_result_table();
+  EXPECT_TRUE(sql_pipeline.metrics().statement_metrics.back()->result_cache_hit);
+}
+
+}  // namespace hyrise
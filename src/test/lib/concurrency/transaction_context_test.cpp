@@ -103,6 +103,64 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
   EXPECT_EQ(context_2->commit_id(), manager().last_commit_id());
 }
 
+TEST_F(TransactionContextTest, GroupCommitPublishesConsecutivePendingTransactions) {
+  auto context_1 = manager().new_transaction_context(AutoCommit::No);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No);
+  auto context_3 = manager().new_transaction_context(AutoCommit::No);
+
+  auto last_commit_id_on_callback_2 = CommitID{0};
+  const auto callback_2 = [&](TransactionID) {
+    last_commit_id_on_callback_2 = manager().last_commit_id();
+  };
+
+  auto try_commit_contexts_2_and_3 = [&]() {
+    context_2->commit_async(callback_2);
+    context_3->commit_async([](TransactionID) {});
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(try_commit_contexts_2_and_3);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  // Committing context_1 publishes the commit IDs of context_1 to context_3 at once. Thus, context_3's commit ID is
+  // already visible when the callback of context_2 fires.
+  context_1->commit_async([](TransactionID) {});
+
+  EXPECT_EQ(manager().last_commit_id(), context_3->commit_id());
+  EXPECT_EQ(last_commit_id_on_callback_2, context_3->commit_id());
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Committed);
+}
+
+TEST_F(TransactionContextTest, AsynchronousCommit) {
+  manager().set_commit_mode(CommitMode::Asynchronous);
+
+  auto context_1 = manager().new_transaction_context(AutoCommit::No);
+  auto context_2 = manager().new_transaction_context(AutoCommit::No);
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto commit_context_2 = [&]() {
+    const auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+    commit_op->set_transaction_context(context_2);
+    commit_op->execute();
+
+    // With synchronous commits, this would wait for context_1 forever.
+    context_2->commit();
+    EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(commit_context_2);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit();
+  EXPECT_EQ(manager().last_commit_id(), context_2->commit_id());
+
+  manager().set_commit_mode(CommitMode::Synchronous);
+}
+
 TEST_F(TransactionContextTest, CommitShouldIncreaseCommitIDIfReadWrite) {
   auto context = manager().new_transaction_context(AutoCommit::No);
 
@@ -1,7 +1,12 @@
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
+#include "concurrency/commit_context.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 
@@ -11,24 +16,43 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::unordered_multiset<CommitID> get_active_snapshot_commit_ids() {
+    auto& manager = Hyrise::get().transaction_manager;
+    auto active_snapshot_commit_ids = manager._overflow_snapshot_commit_ids;
+    for (const auto& slot : manager._snapshot_slots) {
+      const auto snapshot_commit_id = slot.snapshot_commit_id.load();
+      if (snapshot_commit_id != TransactionManager::UNUSED_SNAPSHOT_COMMIT_ID) {
+        active_snapshot_commit_ids.insert(snapshot_commit_id);
+      }
+    }
+    return active_snapshot_commit_ids;
   }
 
-  static void register_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  static size_t register_transaction(CommitID snapshot_commit_id) {
+    return Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
   }
 
-  static void deregister_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id);
+  static void deregister_transaction(size_t snapshot_slot, CommitID snapshot_commit_id) {
+    Hyrise::get().transaction_manager._deregister_transaction(snapshot_slot, snapshot_commit_id);
   }
+
+  static std::shared_ptr<CommitContext> new_commit_context() {
+    return Hyrise::get().transaction_manager._new_commit_context();
+  }
+
+  static void publish_commit(const std::shared_ptr<CommitContext>& commit_context) {
+    commit_context->make_pending(TransactionID{1});
+    Hyrise::get().transaction_manager._try_increment_last_commit_id(commit_context);
+  }
+
+  static constexpr auto SNAPSHOT_SLOT_COUNT = TransactionManager::SNAPSHOT_SLOT_COUNT;
+  static constexpr auto OVERFLOW_SNAPSHOT_SLOT = TransactionManager::OVERFLOW_SNAPSHOT_SLOT;
 };
 
 /** Check if all active snapshot commit ids of uncommitted
  * transaction contexts are tracked correctly.
  * Normally, deregister_transaction() is called in the
- * destructor of the transaction context but is called
- * manually for this test.
+ * destructor of the transaction context.
  */
 TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   auto& manager = Hyrise::get().transaction_manager;
@@ -36,52 +60,114 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 
-  const auto t1_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t2_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t3_context = manager.new_transaction_context(AutoCommit::No);
+  auto t1_context = manager.new_transaction_context(AutoCommit::No);
+  t1_context->commit();
+  auto t2_context = manager.new_transaction_context(AutoCommit::No);
+  auto t3_context = manager.new_transaction_context(AutoCommit::No);
+  t3_context->commit();
 
-  const CommitID t1_snapshot_commit_id = t1_context->snapshot_commit_id();
-  const CommitID t2_snapshot_commit_id = t2_context->snapshot_commit_id();
-  const CommitID t3_snapshot_commit_id = t3_context->snapshot_commit_id();
-  const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
+  const auto t1_snapshot_commit_id = t1_context->snapshot_commit_id();
+  const auto t2_snapshot_commit_id = t2_context->snapshot_commit_id();
+  const auto t3_snapshot_commit_id = t3_context->snapshot_commit_id();
+  EXPECT_LT(t1_snapshot_commit_id, t2_snapshot_commit_id);
+  EXPECT_LT(t2_snapshot_commit_id, t3_snapshot_commit_id);
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
+  EXPECT_EQ(get_active_snapshot_commit_ids(),
+            std::unordered_multiset<CommitID>({t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t1_snapshot_commit_id);
 
-  t1_context->commit();
-  deregister_transaction(t1_context->snapshot_commit_id());
+  t1_context = nullptr;
+  EXPECT_EQ(get_active_snapshot_commit_ids(),
+            std::unordered_multiset<CommitID>({t2_snapshot_commit_id, t3_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_snapshot_commit_id);
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+  t3_context = nullptr;
+  EXPECT_EQ(get_active_snapshot_commit_ids(), std::unordered_multiset<CommitID>({t2_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_snapshot_commit_id);
 
-  t3_context->commit();
-  deregister_transaction(t3_context->snapshot_commit_id());
+  t2_context->commit();
+  t2_context = nullptr;
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+TEST_F(TransactionManagerTest, OverflowSnapshotSlots) {
+  auto& manager = Hyrise::get().transaction_manager;
 
-  t2_context->commit();
-  deregister_transaction(t2_context->snapshot_commit_id());
+  // Occupy all slots. The lowest snapshot commit id is registered last, so it ends up in the overflow set.
+  auto snapshot_slots = std::vector<size_t>{};
+  for (auto index = size_t{0}; index < SNAPSHOT_SLOT_COUNT; ++index) {
+    snapshot_slots.push_back(register_transaction(CommitID{5}));
+  }
+  EXPECT_EQ(std::unordered_set<size_t>(snapshot_slots.cbegin(), snapshot_slots.cend()).size(), SNAPSHOT_SLOT_COUNT);
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  const auto overflow_slot = register_transaction(CommitID{3});
+  EXPECT_EQ(overflow_slot, OVERFLOW_SNAPSHOT_SLOT);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{3});
+
+  deregister_transaction(overflow_slot, CommitID{3});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+
+  for (const auto snapshot_slot : snapshot_slots) {
+    deregister_transaction(snapshot_slot, CommitID{5});
+  }
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto first_snapshot_commit_id = manager.last_commit_id();
+
+  // Each thread keeps a long-running transaction while it starts and commits short ones.
+  constexpr auto THREAD_COUNT = size_t{8};
+  constexpr auto TRANSACTIONS_PER_THREAD = size_t{200};
+  auto long_running_transactions = std::vector<std::shared_ptr<TransactionContext>>(THREAD_COUNT);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      long_running_transactions[thread_id] = manager.new_transaction_context(AutoCommit::No);
+      for (auto transaction_id = size_t{0}; transaction_id < TRANSACTIONS_PER_THREAD; ++transaction_id) {
+        manager.new_transaction_context(AutoCommit::No)->commit();
+      }
+    });
+  }
 
-  // To prevent exceptions in TransactionContext destructor
-  register_transaction(t1_snapshot_commit_id);
-  register_transaction(t2_snapshot_commit_id);
-  register_transaction(t3_snapshot_commit_id);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), THREAD_COUNT);
+  EXPECT_GE(manager.get_lowest_active_snapshot_commit_id(), first_snapshot_commit_id);
+
+  long_running_transactions.clear();
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, WaitForCommit) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto first_commit_context = new_commit_context();
+  const auto second_commit_context = new_commit_context();
+
+  // Already published commit IDs do not block.
+  manager.wait_for_commit(manager.last_commit_id());
+
+  auto has_waited = std::atomic_flag{};
+  auto waiting_thread = std::thread{[&]() {
+    manager.wait_for_commit(second_commit_context->commit_id());
+    EXPECT_GE(manager.last_commit_id(), second_commit_context->commit_id());
+    has_waited.test_and_set();
+  }};
+
+  // The second commit cannot be published before the first one.
+  publish_commit(second_commit_context);
+  EXPECT_LT(manager.last_commit_id(), second_commit_context->commit_id());
+  EXPECT_FALSE(has_waited.test());
+
+  publish_commit(first_commit_context);
+  waiting_thread.join();
+  EXPECT_EQ(manager.last_commit_id(), second_commit_context->commit_id());
+  EXPECT_TRUE(has_waited.test());
 }
 
 }  // namespace hyrise
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,6 +8,7 @@
 #include "base_test.hpp"
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -240,6 +244,39 @@ TEST_P(BinaryParserMultiEncodingTest, RunNullValues) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_P(BinaryParserMultiEncodingTest, LazySegmentLoading) {
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data,
+      ChunkOffset{3});
+  expected_table->append({1, "one"});
+  expected_table->append({2, NULL_VALUE});
+  expected_table->append({3, "three"});
+  expected_table->append({4, "four"});
+  expected_table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(expected_table, SegmentEncodingSpec{GetParam()});
+
+  const auto filename = test_data_path + "lazy_segment_loading.bin";
+  BinaryWriter::write(*expected_table, filename, true);
+  auto table = BinaryParser::parse(filename);
+
+  // Only the chunk headers are read while parsing. Segments are loaded when they are accessed.
+  ASSERT_EQ(table->chunk_count(), 2);
+  const auto chunk = table->get_chunk(ChunkID{1});
+  EXPECT_EQ(chunk->size(), 1);
+  EXPECT_FALSE(chunk->is_mutable());
+  const auto memory_usage_before_loading = chunk->memory_usage(MemoryUsageCalculationMode::Full);
+  const auto segment = chunk->get_segment(ColumnID{1});
+  EXPECT_EQ(segment->size(), 1);
+  EXPECT_EQ(chunk->get_segment(ColumnID{1}), segment);
+  EXPECT_GT(chunk->memory_usage(MemoryUsageCalculationMode::Full), memory_usage_before_loading);
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // The mapping outlives the file.
+  std::remove(filename.c_str());
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{0}, 3), 4);
+}
+
 TEST_F(BinaryParserTest, LZ4MultipleBlocks) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("a", DataType::String, false);
@@ -361,6 +398,21 @@ TEST_F(BinaryParserTest, FileDoesNotExist) {
   EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception);
 }
 
+TEST_F(BinaryParserTest, TruncatedFile) {
+  // Reading beyond the end of the memory-mapped file must fail instead of reading arbitrary memory.
+  auto reference_file = std::ifstream{_reference_filepath + "int_float.bin", std::ios::binary};
+  const auto content = std::string{std::istreambuf_iterator<char>{reference_file}, std::istreambuf_iterator<char>{}};
+  ASSERT_GT(content.size(), 10);
+
+  const auto filename = test_data_path + "truncated.bin";
+  auto truncated_file = std::ofstream{filename, std::ios::binary};
+  truncated_file.write(content.data(), static_cast<std::streamsize>(content.size() - 10));
+  truncated_file.close();
+
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+  std::remove(filename.c_str());
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
@@ -1,5 +1,9 @@
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <utility>
@@ -546,4 +550,46 @@ TEST_P(BinaryWriterMultiEncodingTest, RunNullValues) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_P(BinaryWriterMultiEncodingTest, SegmentIndexAlignsSegments) {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data,
+      ChunkOffset{3});
+  table->append({1, "one"});
+  table->append({2, NULL_VALUE});
+  table->append({3, "three"});
+  table->append({4, "four"});
+  table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{GetParam()});
+  BinaryWriter::write(*table, filename, true);
+
+  auto file = std::ifstream{filename, std::ios::binary};
+  const auto content = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  const auto read_offset = [&](const size_t position) {
+    auto offset = uint64_t{0};
+    std::memcpy(&offset, content.data() + position, sizeof(offset));
+    return offset;
+  };
+
+  // Each chunk has an entry for its header, followed by the entries of its two segments.
+  const auto segment_index_offset = read_offset(content.size() - 2 * sizeof(uint64_t));
+  ASSERT_EQ(segment_index_offset + 6 * sizeof(uint64_t) + 2 * sizeof(uint64_t), content.size());
+  for (auto entry = size_t{0}; entry < 6; ++entry) {
+    const auto offset = read_offset(segment_index_offset + entry * sizeof(uint64_t));
+    if (entry % 3 != 0) {
+      EXPECT_EQ(offset % BinaryWriter::SEGMENT_ALIGNMENT, 0);
+    }
+  }
+}
+
+TEST_F(BinaryWriterTest, RemoveTemporaryFileOnError) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  table->append({1});
+
+  // The temporary file is written, but it cannot replace a directory.
+  std::filesystem::create_directory(filename);
+  EXPECT_THROW(BinaryWriter::write(*table, filename), std::filesystem::filesystem_error);
+  EXPECT_FALSE(std::filesystem::exists(filename + ".tmp"));
+  EXPECT_TRUE(std::filesystem::is_directory(filename));
+}
+
 }  // namespace hyrise
@@ -272,8 +272,44 @@ TEST_F(OperatorsGetTableTest, PrunedChunksCombined) {
   // 3. --- Set pruned chunk ids
   get_table_2->set_transaction_context(context2);
 
+  // 4. --- All rows of the remaining chunk were deleted (CommitID 2) before the snapshot (CommitID 3)
   get_table_2->execute();
-  EXPECT_EQ(get_table_2->get_output()->chunk_count(), 1);
+  EXPECT_EQ(get_table_2->get_output()->chunk_count(), 0);
+}
+
+TEST_F(OperatorsGetTableTest, ExcludeChunksInvisibleForSnapshot) {
+  const auto& table = Hyrise::get().storage_manager.get_table("int_int_float");
+  const auto execute_get_table = [](const CommitID snapshot_commit_id) {
+    const auto context = std::make_shared<TransactionContext>(TransactionID{1}, snapshot_commit_id, AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>("int_int_float");
+    get_table->set_transaction_context(context);
+    get_table->execute();
+    return get_table->get_output();
+  };
+
+  // Chunk 0: The only row was deleted at CommitID 3.
+  const auto& mvcc_data_0 = table->get_chunk(ChunkID{0})->mvcc_data();
+  mvcc_data_0->set_end_cid(ChunkOffset{0}, CommitID{3});
+  mvcc_data_0->max_end_cid = CommitID{3};
+  table->get_chunk(ChunkID{0})->increase_invalid_row_count(ChunkOffset{1});
+
+  // Chunk 1: The only row was inserted at CommitID 5.
+  table->get_chunk(ChunkID{1})->mvcc_data()->set_begin_cid(ChunkOffset{0}, CommitID{5});
+  table->get_chunk(ChunkID{1})->mvcc_data()->min_begin_cid = CommitID{5};
+
+  EXPECT_EQ(execute_get_table(CommitID{2})->chunk_count(), 3);
+  EXPECT_EQ(execute_get_table(CommitID{3})->chunk_count(), 2);
+  EXPECT_EQ(execute_get_table(CommitID{5})->chunk_count(), 3);
+
+  // Chunks with pending Inserts are not excluded, as the rows might have been inserted by the transaction itself.
+  table->get_chunk(ChunkID{1})->mvcc_data()->register_insert();
+  EXPECT_EQ(execute_get_table(CommitID{3})->chunk_count(), 3);
+  table->get_chunk(ChunkID{1})->mvcc_data()->deregister_insert();
+
+  // Without a transaction context, all chunks are forwarded.
+  const auto get_table = std::make_shared<GetTable>("int_int_float");
+  get_table->execute();
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 4);
 }
 
 TEST_F(OperatorsGetTableTest, Copy) {
@@ -5,6 +5,8 @@
 #include <vector>
 
 #include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -19,6 +21,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -34,6 +37,8 @@ std::shared_ptr<std::vector<ChunkID>> shared_chunk_id_vector(std::vector<ChunkID
 
 namespace hyrise {
 
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
 class OperatorsIndexScanTest : public BaseTest {
  protected:
   void SetUp() override {
@@ -222,6 +227,54 @@ TEST_F(OperatorsIndexScanTest, DynamicallyPrunedChunks) {
   Hyrise::get().storage_manager.drop_table("table");
 }
 
+TEST_F(OperatorsIndexScanTest, ChunksExcludedDuringExecution) {
+  // GetTable does not forward chunks whose rows are all invisible. Such a chunk in front of the indexed chunk shifts
+  // the ChunkIDs of GetTable's output, which both the IndexScan and the TableScan for the remaining chunks have to map.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{2}, UseMvcc::Yes);
+  for (const auto value : {1, 2, 3, 2, 2, 4}) {
+    table->append({value});
+  }
+  table->last_chunk()->set_immutable();
+  table->create_partial_hash_index(ColumnID{0}, {ChunkID{1}});
+  Hyrise::get().storage_manager.add_table("table", table);
+
+  // All rows of chunk 0 were deleted at CommitID 1.
+  const auto& mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  mvcc_data->set_end_cid(ChunkOffset{0}, CommitID{1});
+  mvcc_data->set_end_cid(ChunkOffset{1}, CommitID{1});
+  mvcc_data->max_end_cid = CommitID{1};
+  table->get_chunk(ChunkID{0})->increase_invalid_row_count(ChunkOffset{2});
+
+  const auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{1}, AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->set_transaction_context(context);
+  get_table->execute();
+  ASSERT_EQ(get_table->get_output()->chunk_count(), 2);
+
+  // The LQPTranslator assigns chunk 1 to the IndexScan and all other chunks to the TableScan.
+  const auto indexed_chunk_ids = shared_chunk_id_vector({ChunkID{1}});
+  const auto index_scan = std::make_shared<IndexScan>(get_table, ColumnID{0}, PredicateCondition::Equals, 2);
+  index_scan->included_chunk_ids = indexed_chunk_ids;
+  const auto table_scan =
+      std::make_shared<TableScan>(get_table, equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 2));
+  table_scan->excluded_chunk_ids = indexed_chunk_ids;
+  index_scan->execute();
+  table_scan->execute();
+
+  const auto expected_index_scan_result = std::vector<AllTypeVariant>{2};
+  ASSERT_COLUMN_EQ(index_scan->get_output(), ColumnID{0}, expected_index_scan_result);
+  const auto& index_scan_segment = index_scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ((*std::static_pointer_cast<const ReferenceSegment>(index_scan_segment)->pos_list())[0],
+            (RowID{ChunkID{0}, ChunkOffset{1}}));
+
+  const auto expected_table_scan_result = std::vector<AllTypeVariant>{2};
+  ASSERT_COLUMN_EQ(table_scan->get_output(), ColumnID{0}, expected_table_scan_result);
+  const auto& table_scan_segment = table_scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ((*std::static_pointer_cast<const ReferenceSegment>(table_scan_segment)->pos_list())[0],
+            (RowID{ChunkID{1}, ChunkOffset{0}}));
+}
+
 TEST_F(OperatorsIndexScanTest, OperatorName) {
   const auto scan =
       std::make_shared<IndexScan>(_int_int, _column_id, PredicateCondition::GreaterThanEquals, AllTypeVariant{0});
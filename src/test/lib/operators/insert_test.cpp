@@ -496,4 +496,150 @@ TEST_F(OperatorsInsertTest, MarkMultipleChunksImmutable) {
   }
 }
 
+// Rows inserted with InsertChunkMode::NewChunk are written to a chunk that is not shared with other Inserts.
+TEST_F(OperatorsInsertTest, InsertIntoNewChunk) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("target_table", target_table);
+  target_table->append({int32_t{1}});
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({int32_t{2}});
+  values_to_insert->append({int32_t{3}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  const auto insert = std::make_shared<Insert>("target_table", table_wrapper, InsertChunkMode::NewChunk);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(transaction_context);
+
+  // The new chunk is prepared after the rows were written to it and before it is added to the table.
+  auto prepared_chunk = std::shared_ptr<Chunk>{};
+  insert->set_new_chunk_preparation([&](const std::shared_ptr<Chunk>& chunk) {
+    EXPECT_EQ(chunk->size(), 2);
+    EXPECT_EQ(target_table->chunk_count(), 1);
+    prepared_chunk = chunk;
+  });
+
+  execute_all({table_wrapper, insert});
+  EXPECT_EQ(insert->target_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+  EXPECT_EQ(target_table->get_chunk(ChunkID{1}), prepared_chunk);
+
+  // The former last chunk has no pending Inserts and is immutable right away. The new chunk is immutable on commit.
+  ASSERT_EQ(target_table->chunk_count(), 2);
+  EXPECT_FALSE(target_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(target_table->get_chunk(ChunkID{1})->is_marked_as_full());
+  EXPECT_EQ(target_table->get_chunk(ChunkID{1})->size(), 2);
+
+  // Other Inserts do not write to the new chunk.
+  const auto other_insert = std::make_shared<Insert>("target_table", table_wrapper);
+  const auto other_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  other_insert->set_transaction_context(other_transaction_context);
+  other_insert->execute();
+  EXPECT_EQ(other_insert->target_chunk_ids(), std::vector<ChunkID>{ChunkID{2}});
+
+  transaction_context->commit();
+  other_transaction_context->commit();
+  EXPECT_FALSE(target_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(target_table->get_chunk(ChunkID{2})->is_mutable());
+}
+
+TEST_F(OperatorsInsertTest, InsertIntoInsertChunks) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("target_table", target_table);
+  target_table->append({int32_t{1}});
+  target_table->set_insert_chunk_count(4);
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({int32_t{2}});
+  values_to_insert->append({int32_t{3}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  // Inserts executed by the same thread write to the insert chunk of its slot.
+  auto transaction_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto insert_idx = 0; insert_idx < 2; ++insert_idx) {
+    const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+    transaction_contexts.emplace_back(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+    insert->set_transaction_context(transaction_contexts.back());
+    insert->execute();
+    EXPECT_EQ(insert->target_chunk_ids(), std::vector<ChunkID>{ChunkID{1}});
+  }
+
+  // Rows appended to the table and Inserts in NewChunk mode do not write to the insert chunk.
+  target_table->append({int32_t{4}});
+  const auto new_chunk_insert = std::make_shared<Insert>("target_table", table_wrapper, InsertChunkMode::NewChunk);
+  transaction_contexts.emplace_back(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  new_chunk_insert->set_transaction_context(transaction_contexts.back());
+  new_chunk_insert->execute();
+  EXPECT_EQ(new_chunk_insert->target_chunk_ids(), std::vector<ChunkID>{ChunkID{3}});
+  EXPECT_EQ(target_table->chunk_count(), 4);
+  EXPECT_TRUE(target_table->get_chunk(ChunkID{1})->is_marked_as_full());
+  EXPECT_TRUE(target_table->get_chunk(ChunkID{2})->is_marked_as_full());
+
+  // The full insert chunk becomes immutable once its Inserts commit.
+  for (const auto& transaction_context : transaction_contexts) {
+    transaction_context->commit();
+  }
+  EXPECT_FALSE(target_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_FALSE(target_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_FALSE(target_table->get_chunk(ChunkID{3})->is_mutable());
+  EXPECT_EQ(target_table->row_count(), 8);
+}
+
+// Chunks that become immutable are added to the table indexes, so that index lookups cover recently inserted rows.
+TEST_F(OperatorsInsertTest, AddImmutableChunksToTableIndexes) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("target_table", target_table);
+  target_table->append({int32_t{1}});
+  target_table->append({int32_t{2}});
+  target_table->last_chunk()->set_immutable();
+  target_table->create_partial_hash_index(ColumnID{0}, {ChunkID{0}});
+  const auto table_index = target_table->get_table_indexes().front();
+
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({int32_t{3}});
+  values_to_insert->append({int32_t{4}});
+  values_to_insert->append({int32_t{5}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(transaction_context);
+  execute_all({table_wrapper, insert});
+  ASSERT_EQ(target_table->chunk_count(), 3);
+  EXPECT_EQ(table_index->get_indexed_chunk_ids().size(), 1);
+
+  const auto get_statistics_chunk_ids = [&]() {
+    const auto table_indexes_statistics = target_table->table_indexes_statistics();
+    EXPECT_EQ(table_indexes_statistics.size(), 1);
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (const auto& [chunk_id, chunk] : table_indexes_statistics.front().chunk_ids) {
+      EXPECT_EQ(chunk, target_table->get_chunk(chunk_id));
+      chunk_ids.emplace_back(chunk_id);
+    }
+    return chunk_ids;
+  };
+  EXPECT_EQ(get_statistics_chunk_ids(), std::vector<ChunkID>{ChunkID{0}});
+
+  // The full chunk becomes immutable on commit and is indexed. The last chunk is still mutable and is not indexed. The
+  // index statistics list the indexed chunks.
+  transaction_context->commit();
+  EXPECT_EQ(table_index->get_indexed_chunk_ids(), (tsl::sparse_set<ChunkID>{ChunkID{0}, ChunkID{1}}));
+  EXPECT_EQ(get_statistics_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+
+  // Adding an indexed chunk again does not list it twice.
+  target_table->add_chunk_to_table_indexes(ChunkID{1});
+  EXPECT_EQ(get_statistics_chunk_ids(), (std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}));
+
+  auto matches = std::vector<RowID>{};
+  table_index->range_equals_with_iterators(
+      [&](auto begin, const auto end) {
+        matches.insert(matches.end(), begin, end);
+      },
+      int32_t{4});
+  EXPECT_EQ(matches, std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{1})});
+}
+
 }  // namespace hyrise
@@ -5,6 +5,7 @@
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/shared_dictionary_encoder.hpp"
 
 namespace hyrise {
 
@@ -328,4 +329,33 @@ TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
                std::logic_error);
 }
 
+TEST_F(JoinHashStepsTest, MaterializeSharedDictionaryValueIDsOfPinnedChunks) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data,
+                                             ChunkOffset{2}, UseMvcc::Yes);
+  for (const auto* value : {"b", "a", "c"}) {
+    table->append({pmr_string{value}});
+  }
+  table->last_chunk()->set_immutable();
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+
+  const auto shared_dictionary_segments = get_shared_dictionary_segments<pmr_string>(*table, ColumnID{0});
+  ASSERT_TRUE(shared_dictionary_segments);
+
+  // A chunk that is appended after the segments were pinned is not covered by the shared dictionary and is ignored.
+  table->append({pmr_string{"d"}});
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  auto histograms = std::vector<std::vector<size_t>>{};
+  auto bloom_filter = BloomFilter{};
+  const auto radix_container = materialize_input<SharedDictionaryValueID, SharedDictionaryValueID, false>(
+      table, ColumnID{0}, histograms, 0, bloom_filter, ALL_TRUE_BLOOM_FILTER, shared_dictionary_segments.get());
+
+  ASSERT_EQ(radix_container.size(), 2);
+  EXPECT_EQ(radix_container[0].elements.size(), 2);
+  EXPECT_EQ(radix_container[0].elements[0].value, 1);
+  EXPECT_EQ(radix_container[0].elements[1].value, 0);
+  EXPECT_EQ(radix_container[1].elements.size(), 1);
+  EXPECT_EQ(radix_container[1].elements[0].value, 2);
+}
+
 }  // namespace hyrise
@@ -2,6 +2,7 @@
 #include "operators/join_sort_merge.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace hyrise {
 
@@ -116,4 +117,37 @@ TEST_F(OperatorsJoinSortMergeTest, SetSortedFlagOnJoinColumns) {
   }
 }
 
+TEST_F(OperatorsJoinSortMergeTest, LongStrings) {
+  // Strings that share their prefix and exceed the inline size of PrefixedStringViews. The right table is LZ4-encoded,
+  // so that its iterators return temporary strings whose characters are copied into the join's string heaps.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2});
+  for (const auto* value : {"prefix_value_1", "prefix_value_2", "prefix_value_3", "short"}) {
+    left_table->append({pmr_string{value}});
+    right_table->append({pmr_string{value}});
+  }
+  left_table->append({NULL_VALUE});
+  right_table->append({pmr_string{"prefix_value_2"}});
+  ChunkEncoder::encode_all_chunks(right_table, SegmentEncodingSpec{EncodingType::LZ4});
+
+  const auto left_input = std::make_shared<TableWrapper>(left_table);
+  const auto right_input = std::make_shared<TableWrapper>(right_table);
+  left_input->execute();
+  right_input->execute();
+
+  const auto join_row_count = [&](const PredicateCondition predicate_condition, const JoinMode mode) {
+    const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+    const auto join_operator = std::make_shared<JoinSortMerge>(left_input, right_input, mode, primary_predicate);
+    join_operator->execute();
+    return join_operator->get_output()->row_count();
+  };
+
+  EXPECT_EQ(join_row_count(PredicateCondition::Equals, JoinMode::Inner), 5);
+  EXPECT_EQ(join_row_count(PredicateCondition::Equals, JoinMode::Left), 6);
+  // "prefix_value_1" < {"prefix_value_2" (twice), "prefix_value_3", "short"}, "prefix_value_2" < {"prefix_value_3",
+  // "short"}, "prefix_value_3" < "short".
+  EXPECT_EQ(join_row_count(PredicateCondition::LessThan, JoinMode::Inner), 7);
+}
+
 }  // namespace hyrise
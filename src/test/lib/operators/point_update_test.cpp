@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/point_update.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class OperatorsPointUpdateTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions =
+        TableColumnDefinitions{{"id", DataType::Int, false}, {"value", DataType::Float, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    _table->append({1, 1.0f});
+    _table->append({2, 2.0f});
+    _table->append({3, 3.0f});
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+ protected:
+  std::shared_ptr<PointUpdate> _update(const int32_t id, const AllTypeVariant& value,
+                                       const std::shared_ptr<TransactionContext>& transaction_context) const {
+    const auto point_update =
+        std::make_shared<PointUpdate>(_table_name, PointLookupKey{{ColumnID{0}, id}},
+                                      std::vector<std::pair<ColumnID, AllTypeVariant>>{{ColumnID{1}, value}});
+    point_update->set_transaction_context(transaction_context);
+    point_update->execute();
+    return point_update;
+  }
+
+  std::shared_ptr<const Table> _validated_table(
+      std::shared_ptr<TransactionContext> transaction_context = nullptr) const {
+    if (!transaction_context) {
+      transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    }
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows) const {
+    auto table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  const std::string _table_name{"pointUpdateTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsPointUpdateTest, UpdateRow) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto point_update = _update(2, 4.0f, transaction_context);
+  EXPECT_FALSE(point_update->execute_failed());
+  EXPECT_EQ(point_update->updated_row_count(), 1);
+
+  // The old version is locked, the new version is appended to the last chunk. Other transactions do not see it yet.
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{1}), transaction_context->transaction_id());
+  EXPECT_EQ(_table->row_count(), 4);
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 1.0f}, {2, 2.0f}, {3, 3.0f}}));
+
+  transaction_context->commit();
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 1.0f}, {2, 4.0f}, {3, 3.0f}}));
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->invalid_row_count(), 1);
+
+  // The last chunk reached its target size and became immutable.
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->is_mutable());
+}
+
+TEST_F(OperatorsPointUpdateTest, ReadOwnUpdate) {
+  // The old version is part of an immutable chunk, which Validate must not forward as a whole.
+  ASSERT_FALSE(_table->get_chunk(ChunkID{0})->is_mutable());
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _update(1, 4.0f, transaction_context);
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(transaction_context),
+                            _expected_table({{1, 4.0f}, {2, 2.0f}, {3, 3.0f}}));
+  transaction_context->commit();
+}
+
+TEST_F(OperatorsPointUpdateTest, UpdateRowTwiceInTransaction) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(_update(3, 4.0f, transaction_context)->updated_row_count(), 1);
+  EXPECT_EQ(_update(3, NULL_VALUE, transaction_context)->updated_row_count(), 1);
+  transaction_context->commit();
+
+  EXPECT_EQ(_table->row_count(), 5);
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 1.0f}, {2, 2.0f}, {3, NULL_VALUE}}));
+}
+
+TEST_F(OperatorsPointUpdateTest, MissingRow) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto point_update = _update(4, 4.0f, transaction_context);
+  EXPECT_FALSE(point_update->execute_failed());
+  EXPECT_EQ(point_update->updated_row_count(), 0);
+  transaction_context->commit();
+
+  EXPECT_EQ(_table->row_count(), 3);
+}
+
+TEST_F(OperatorsPointUpdateTest, Conflict) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _update(1, 4.0f, transaction_context);
+
+  const auto other_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto point_update = _update(1, 5.0f, other_transaction_context);
+  EXPECT_TRUE(point_update->execute_failed());
+  other_transaction_context->rollback(RollbackReason::Conflict);
+
+  transaction_context->commit();
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 4.0f}, {2, 2.0f}, {3, 3.0f}}));
+}
+
+TEST_F(OperatorsPointUpdateTest, Rollback) {
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _update(1, 4.0f, transaction_context);
+  transaction_context->rollback(RollbackReason::User);
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{0}), TransactionID{0});
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->invalid_row_count(), 1);
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 1.0f}, {2, 2.0f}, {3, 3.0f}}));
+
+  // The row can be updated again.
+  const auto other_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(_update(1, 5.0f, other_transaction_context)->updated_row_count(), 1);
+  other_transaction_context->commit();
+  EXPECT_TABLE_EQ_UNORDERED(_validated_table(), _expected_table({{1, 5.0f}, {2, 2.0f}, {3, 3.0f}}));
+}
+
+}  // namespace hyrise
@@ -25,6 +25,7 @@
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -721,6 +722,56 @@ TEST_P(OperatorsTableScanTest, ScanForNullValuesOnValueSegmentWithoutNulls) {
   scan_for_null_values(table_wrapper, tests);
 }
 
+TEST_P(OperatorsTableScanTest, ScanForNullValuesOnNullableValueSegmentWithoutNulls) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4});
+  table->append({12345, 458.7f});
+  table->append({123, 456.7f});
+  table->append({1234, 457.7f});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto tests = std::map<PredicateCondition, std::vector<AllTypeVariant>>{
+      {PredicateCondition::IsNull, {}}, {PredicateCondition::IsNotNull, {12345, 123, 1234}}};
+
+  scan_for_null_values(table_wrapper, tests);
+
+  // The IS NULL scan does not need to look at the NULL values of the nullable segment without NULL values.
+  const auto scan = create_table_scan(table_wrapper, ColumnID{1}, PredicateCondition::IsNull, NULL_VALUE);
+  scan->execute();
+  const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*scan->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_with_early_out, 1);
+}
+
+TEST_P(OperatorsTableScanTest, ScanValueSegmentWithNullValuesAcrossWords) {
+  // The NULL values of value segments are combined with the matches in words of 64 positions (see ValidityBitmap).
+  // Every third of the 200 values is NULL, and the last word is only partially used.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  for (auto value = int32_t{0}; value < 200; ++value) {
+    table->append({value % 3 == 0 ? NULL_VALUE : AllTypeVariant{value}});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+  const auto expected_row_counts = std::vector<std::pair<std::shared_ptr<AbstractExpression>, size_t>>{
+      {greater_than_equals_(column, 100), 67},
+      {not_equals_(column, 5), 132},
+      {less_than_(column, 0), 0},
+      {is_null_(column), 67},
+      {is_not_null_(column), 133}};
+
+  for (const auto& [predicate, expected_row_count] : expected_row_counts) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, ScanForNullValuesOnReferencedValueSegmentWithoutNulls) {
   auto table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{4});
 
@@ -1140,6 +1191,58 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnMultipleBlocksAndRuns) {
+  // Run-length and frame-of-reference segments are scanned on their compressed representation (i.e., per run and per
+  // block). The data spans multiple frame-of-reference blocks (2048 rows each) with differing minima, runs of equal
+  // values, and NULL runs.
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{5'000});
+
+  auto values = std::vector<std::optional<int32_t>>{};
+  for (auto index = 0; index < 5'000; ++index) {
+    if (index % 500 >= 490) {
+      values.emplace_back(std::nullopt);
+      data_table->append({NullValue{}});
+      continue;
+    }
+
+    const auto value = (index >= 2'048 ? 1'000'000 : 0) + index / 7;
+    values.emplace_back(value);
+    data_table->append({value});
+  }
+
+  data_table->last_chunk()->set_immutable();
+  ChunkEncoder::encode_all_chunks(data_table, SegmentEncodingSpec{_encoding_type});
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->never_clear_output();
+  data_table_wrapper->execute();
+
+  const auto predicate_conditions =
+      std::vector<PredicateCondition>{PredicateCondition::Equals,   PredicateCondition::NotEquals,
+                                      PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                      PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+  const auto search_values = std::vector<int32_t>{-1, 0, 100, 292, 1'000'292, 1'000'500, 1'000'714, 2'000'000};
+
+  for (const auto predicate_condition : predicate_conditions) {
+    for (const auto search_value : search_values) {
+      auto expected_row_count = size_t{0};
+      with_comparator(predicate_condition, [&](auto comparator) {
+        for (const auto& value : values) {
+          if (value && comparator(*value, search_value)) {
+            ++expected_row_count;
+          }
+        }
+      });
+
+      const auto scan = create_table_scan(data_table_wrapper, ColumnID{0}, predicate_condition, search_value);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count)
+          << "for " << predicate_condition << " " << search_value;
+    }
+  }
+}
+
 /**
  * Tests for sorted_by flag forwarding.
  */
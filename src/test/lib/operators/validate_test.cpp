@@ -14,6 +14,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -186,6 +188,7 @@ TEST_F(OperatorsValidateTest, ChunkNotEntirelyVisibleWithInvalidRows) {
   vs_int->append(4);
 
   auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, begin_cid));
+  chunk->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{1});
   chunk->increase_invalid_row_count(ChunkOffset{1});
   chunk->set_immutable();
 
@@ -194,6 +197,22 @@ TEST_F(OperatorsValidateTest, ChunkNotEntirelyVisibleWithInvalidRows) {
   EXPECT_FALSE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleWithRowsInvalidatedAfterSnapshot) {
+  auto snapshot_cid = CommitID{1};
+  auto begin_cid = CommitID{0};
+  auto vs_int = std::make_shared<ValueSegment<int32_t>>();
+  vs_int->append(4);
+
+  auto chunk = std::make_shared<Chunk>(Segments{vs_int}, std::make_shared<MvccData>(1, begin_cid));
+  chunk->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{2});
+  chunk->increase_invalid_row_count(ChunkOffset{1});
+  chunk->set_immutable();
+
+  auto validate = std::make_shared<Validate>(nullptr);
+
+  EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
+}
+
 TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   auto snapshot_cid = CommitID{1};
   auto begin_cid = CommitID{0};
@@ -207,6 +226,57 @@ TEST_F(OperatorsValidateTest, ChunkEntirelyVisible) {
   EXPECT_TRUE(forward_is_entire_chunk_visible(validate, chunk, snapshot_cid));
 }
 
+TEST_F(OperatorsValidateTest, ValidateImmutableChunkWithInvalidRows) {
+  // Row 1 is deleted with commit ID 3, row 2 is inserted with commit ID 4.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{4}, UseMvcc::Yes);
+  table->append({1});
+  table->append({2});
+  table->append({3});
+  table->append({4});
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto mvcc_data = chunk->mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ChunkOffset{4}; ++chunk_offset) {
+    mvcc_data->set_begin_cid(chunk_offset, chunk_offset == ChunkOffset{2} ? CommitID{4} : CommitID{0});
+  }
+  mvcc_data->set_end_cid(ChunkOffset{1}, CommitID{3});
+  chunk->increase_invalid_row_count(ChunkOffset{1});
+  chunk->set_immutable();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto validate = [&](const CommitID snapshot_cid) {
+    const auto context = std::make_shared<TransactionContext>(TransactionID{1}, snapshot_cid, AutoCommit::No);
+    const auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(context);
+    validate->execute();
+
+    const auto& output = validate->get_output();
+    EXPECT_EQ(output->chunk_count(), 1);
+    return std::static_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+        ->pos_list();
+  };
+
+  // The snapshot is older than the deletion and newer than all inserts except for row 2.
+  const auto pos_list_before_delete = validate(CommitID{2});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(pos_list_before_delete));
+  EXPECT_EQ(*pos_list_before_delete, RowIDPosList({RowID{ChunkID{0}, ChunkOffset{0}},
+                                                   RowID{ChunkID{0}, ChunkOffset{1}},
+                                                   RowID{ChunkID{0}, ChunkOffset{3}}}));
+
+  const auto pos_list_after_delete = validate(CommitID{4});
+  EXPECT_EQ(*pos_list_after_delete, RowIDPosList({RowID{ChunkID{0}, ChunkOffset{0}},
+                                                  RowID{ChunkID{0}, ChunkOffset{2}},
+                                                  RowID{ChunkID{0}, ChunkOffset{3}}}));
+
+  // If all rows are inserted before the snapshot and deleted after it, the chunk is forwarded entirely.
+  mvcc_data->set_begin_cid(ChunkOffset{2}, CommitID{0});
+  mvcc_data->max_begin_cid = CommitID{0};
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(validate(CommitID{2})));
+}
+
 TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   // If Validate has a reference table as input, it can usually optimize the evaluation of the MVCC data.
   // This optimization is possible if a PosList of a reference segment references only one chunk.
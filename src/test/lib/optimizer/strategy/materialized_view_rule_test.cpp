@@ -0,0 +1,111 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/materialized_view.hpp"
+#include "strategy_base_test.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int3.tbl",
+                                                                  ChunkOffset{3}));
+    stored_table_node = StoredTableNode::make("table_a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+
+    materialized_view = std::make_shared<MaterializedView>(
+        "view_a", AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+                                      ValidateNode::make(stored_table_node)));
+    Hyrise::get().storage_manager.add_materialized_view(materialized_view);
+    rule = std::make_shared<MaterializedViewRule>(Hyrise::get().transaction_manager.last_commit_id());
+  }
+
+  std::shared_ptr<MaterializedViewRule> rule;
+  std::shared_ptr<MaterializedView> materialized_view;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<LQPColumnExpression> a;
+  std::shared_ptr<LQPColumnExpression> b;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplaceMatchingAggregate) {
+  // clang-format off
+  _lqp =
+  PredicateNode::make(greater_than_(sum_(b), 10),
+    ProjectionNode::make(expression_vector(a, sum_(b)),
+      AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+        ValidateNode::make(stored_table_node))));
+
+  const auto view_lqp = materialized_view->make_lqp();
+  const auto view_expressions = view_lqp->output_expressions();
+  const auto expected_lqp =
+  AliasNode::make(view_expressions, std::vector<std::string>{"a", "SUM(b)"},
+    PredicateNode::make(greater_than_(view_expressions[1], 10),
+      ProjectionNode::make(view_expressions,
+        view_lqp)));
+  // clang-format on
+
+  _apply_rule(rule, _lqp);
+
+  EXPECT_LQP_EQ(_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRuleTest, KeepDifferentAggregates) {
+  // The view does not match if the aggregates, the grouping, or the input differ.
+  for (const auto& lqp : std::vector<std::shared_ptr<AbstractLQPNode>>{
+           AggregateNode::make(expression_vector(a), expression_vector(sum_(a)), ValidateNode::make(stored_table_node)),
+           AggregateNode::make(expression_vector(b), expression_vector(sum_(b)), ValidateNode::make(stored_table_node)),
+           AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+                               PredicateNode::make(greater_than_(a, 2), ValidateNode::make(stored_table_node))),
+           AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), stored_table_node)}) {
+    _lqp = lqp->deep_copy();
+    const auto expected_lqp = _lqp->deep_copy();
+    _apply_rule(rule, _lqp);
+    EXPECT_LQP_EQ(_lqp, expected_lqp);
+  }
+}
+
+TEST_F(MaterializedViewRuleTest, KeepAggregatesOfOlderSnapshots) {
+  // Snapshots taken before the view was populated do not see its rows.
+  const auto snapshot_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  auto sql_pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (1, 2)"}.create_pipeline();
+  EXPECT_EQ(sql_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.drop_materialized_view("view_a");
+  storage_manager.add_materialized_view(std::make_shared<MaterializedView>(
+      "view_b", AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+                                    ValidateNode::make(stored_table_node))));
+
+  _lqp = AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), ValidateNode::make(stored_table_node));
+  const auto expected_lqp = _lqp->deep_copy();
+  _apply_rule(std::make_shared<MaterializedViewRule>(snapshot_commit_id), _lqp);
+  EXPECT_LQP_EQ(_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRuleTest, NoViews) {
+  Hyrise::get().storage_manager.drop_materialized_view("view_a");
+
+  _lqp = AggregateNode::make(expression_vector(a), expression_vector(sum_(b)), ValidateNode::make(stored_table_node));
+  const auto expected_lqp = _lqp->deep_copy();
+  _apply_rule(rule, _lqp);
+  EXPECT_LQP_EQ(_lqp, expected_lqp);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,107 @@
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/coroutine_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+namespace hyrise {
+
+class CoroutineTaskTest : public BaseTest {
+ protected:
+  // Returns a CoroutineTask that awaits JOB_COUNT JobTasks, each incrementing the counter, and afterwards checks that
+  // all jobs are done.
+  static std::shared_ptr<CoroutineTask> create_coroutine_task(std::atomic_uint32_t& counter,
+                                                              std::atomic_uint32_t& counter_after_await) {
+    return std::make_shared<CoroutineTask>([&]() -> TaskCoroutine {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto job_id = uint32_t{0}; job_id < JOB_COUNT; ++job_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          ++counter;
+        }));
+      }
+
+      co_await Hyrise::get().scheduler()->schedule_and_await_tasks(jobs);
+      for (const auto& job : jobs) {
+        EXPECT_TRUE(job->is_done());
+      }
+      counter_after_await += counter;
+    });
+  }
+
+  static constexpr auto JOB_COUNT = uint32_t{10};
+};
+
+TEST_F(CoroutineTaskTest, AwaitTasksWithoutScheduler) {
+  auto counter = std::atomic_uint32_t{0};
+  auto counter_after_await = std::atomic_uint32_t{0};
+  const auto task = create_coroutine_task(counter, counter_after_await);
+
+  task->schedule();
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(counter, JOB_COUNT);
+  EXPECT_EQ(counter_after_await, JOB_COUNT);
+}
+
+TEST_F(CoroutineTaskTest, AwaitTasksWithScheduler) {
+  // With a single worker, the jobs can only be executed if the worker does not block while the coroutine awaits them.
+  Hyrise::get().topology.use_fake_numa_topology(1, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto counter = std::atomic_uint32_t{0};
+  auto counter_after_await = std::atomic_uint32_t{0};
+  const auto task = create_coroutine_task(counter, counter_after_await);
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(counter, JOB_COUNT);
+  EXPECT_EQ(counter_after_await, JOB_COUNT);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(CoroutineTaskTest, ManyCoroutineTasks) {
+  constexpr auto TASK_COUNT = uint32_t{100};
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto counter = std::atomic_uint32_t{0};
+  auto counters_after_await = std::vector<std::atomic_uint32_t>(TASK_COUNT);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = uint32_t{0}; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(create_coroutine_task(counter, counters_after_await[task_id]));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter, TASK_COUNT * JOB_COUNT);
+  for (const auto& counter_after_await : counters_after_await) {
+    EXPECT_GE(counter_after_await, JOB_COUNT);
+  }
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(CoroutineTaskTest, SuccessorsWaitForCoroutine) {
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto counter = std::atomic_uint32_t{0};
+  auto counter_after_await = std::atomic_uint32_t{0};
+  const auto task = create_coroutine_task(counter, counter_after_await);
+
+  auto counter_in_successor = uint32_t{0};
+  const auto successor = std::make_shared<JobTask>([&]() {
+    counter_in_successor = counter_after_await;
+  });
+  task->set_as_predecessor_of(successor);
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task, successor});
+  EXPECT_EQ(counter_in_successor, JOB_COUNT);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+}  // namespace hyrise
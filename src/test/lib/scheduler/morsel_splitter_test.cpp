@@ -0,0 +1,83 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/morsel_splitter.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class MorselSplitterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                     ChunkOffset{100});
+    for (auto value = int32_t{0}; value < 10'000; ++value) {
+      _table->append({value});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MorselSplitterTest, NoJobsWithoutMultiThreading) {
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+
+  const auto morsel_splitter = MorselSplitter{};
+  EXPECT_FALSE(morsel_splitter.should_spawn_job(100'000));
+
+  const auto chunk_ranges = morsel_splitter.split_chunks(*_table);
+  ASSERT_EQ(chunk_ranges.size(), 1);
+  EXPECT_EQ(chunk_ranges[0].begin_chunk_id, ChunkID{0});
+  EXPECT_EQ(chunk_ranges[0].end_chunk_id, _table->chunk_count());
+}
+
+TEST_F(MorselSplitterTest, RowCost) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // The scheduler is idle, so the minimum morsel size is not increased.
+  EXPECT_EQ(MorselSplitter{}.min_morsel_row_count(), MorselSplitter::BASE_MIN_MORSEL_ROW_COUNT);
+  EXPECT_EQ(MorselSplitter{2.0f}.min_morsel_row_count(), MorselSplitter::BASE_MIN_MORSEL_ROW_COUNT / 2);
+  EXPECT_EQ(MorselSplitter{0.5f}.min_morsel_row_count(), MorselSplitter::BASE_MIN_MORSEL_ROW_COUNT * 2);
+
+  const auto morsel_splitter = MorselSplitter{2.0f};
+  EXPECT_FALSE(morsel_splitter.should_spawn_job(MorselSplitter::BASE_MIN_MORSEL_ROW_COUNT / 2 - 1));
+  EXPECT_TRUE(morsel_splitter.should_spawn_job(MorselSplitter::BASE_MIN_MORSEL_ROW_COUNT / 2));
+}
+
+TEST_F(MorselSplitterTest, SplitChunks) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto morsel_splitter = MorselSplitter{};
+  const auto chunk_ranges = morsel_splitter.split_chunks(*_table);
+  EXPECT_GT(chunk_ranges.size(), 1);
+
+  // The ranges cover all chunks in order and each range is worth a task.
+  auto expected_begin_chunk_id = ChunkID{0};
+  for (const auto& [begin_chunk_id, end_chunk_id] : chunk_ranges) {
+    EXPECT_EQ(begin_chunk_id, expected_begin_chunk_id);
+    EXPECT_GT(end_chunk_id, begin_chunk_id);
+
+    auto row_count = size_t{0};
+    for (auto chunk_id = begin_chunk_id; chunk_id < end_chunk_id; ++chunk_id) {
+      row_count += _table->get_chunk(chunk_id)->size();
+    }
+    EXPECT_GE(row_count, morsel_splitter.min_morsel_row_count());
+    expected_begin_chunk_id = end_chunk_id;
+  }
+  EXPECT_EQ(expected_begin_chunk_id, _table->chunk_count());
+
+  // A table that is too small is not split.
+  const auto small_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                   TableType::Data, ChunkOffset{10});
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    small_table->append({value});
+  }
+  EXPECT_EQ(morsel_splitter.split_chunks(*small_table).size(), 1);
+}
+
+}  // namespace hyrise
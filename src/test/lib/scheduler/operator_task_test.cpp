@@ -8,6 +8,7 @@
 #include "expression/expression_functional.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
@@ -15,6 +16,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
 
@@ -317,6 +319,87 @@ TEST_F(OperatorTaskTest, PrunableSubqueriesWithCycles) {
   }
 }
 
+TEST_F(OperatorTaskTest, OperatorsAwaitJobs) {
+  // TableScan and Projection spawn one job per chunk and await them. With a single worker, the jobs can only be
+  // executed while the operators' coroutines are suspended.
+  Hyrise::get().topology.use_fake_numa_topology(1, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, ChunkOffset{1'000});
+  for (auto value = int32_t{0}; value < 4'000; ++value) {
+    table->append({value});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, less_than_(a, 3'000));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(add_(a, 1)));
+  projection->never_clear_output();
+
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(projection);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  EXPECT_TRUE(root_operator_task->is_done());
+
+  const auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a + 1", DataType::Int, false}}, TableType::Data);
+  for (auto value = int32_t{1}; value <= 3'000; ++value) {
+    expected_table->append({value});
+  }
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected_table);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(OperatorTaskTest, OperatorThrowsInCoroutine) {
+  // An operator that fails after its jobs are done. The OperatorTask must be finished nevertheless, so that neither its
+  // successors nor whoever waits for it wait forever. The exception is rethrown afterwards.
+  class FailingOperator : public AbstractReadOnlyOperator {
+   public:
+    FailingOperator() : AbstractReadOnlyOperator{OperatorType::Mock} {}
+
+    const std::string& name() const override {
+      static const auto name = std::string{"FailingOperator"};
+      return name;
+    }
+
+   protected:
+    TaskCoroutine _on_execute_coroutine(std::shared_ptr<TransactionContext> /*context*/) override {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+      co_await Hyrise::get().scheduler()->schedule_and_await_tasks(jobs);
+      Fail("Operator failed.");
+    }
+
+    std::shared_ptr<AbstractOperator> _on_deep_copy(
+        const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+        const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+        std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override {
+      return std::make_shared<FailingOperator>();
+    }
+
+    void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& /*parameters*/) override {}
+  };
+
+  // Executed without a task, the coroutine is run synchronously.
+  EXPECT_THROW(std::make_shared<FailingOperator>()->execute(), std::logic_error);
+
+  const auto task = std::make_shared<OperatorTask>(std::make_shared<FailingOperator>());
+  auto successor_executed = false;
+  const auto successor = std::make_shared<JobTask>([&]() {
+    successor_executed = true;
+  });
+  task->set_as_predecessor_of(successor);
+
+  EXPECT_THROW(Hyrise::get().scheduler()->schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task}),
+               std::logic_error);
+  EXPECT_TRUE(task->is_done());
+  EXPECT_TRUE(successor->is_ready());
+
+  successor->schedule();
+  EXPECT_TRUE(successor_executed);
+}
+
 TEST_F(OperatorTaskTest, SkipOperatorTask) {
   const auto table = std::make_shared<GetTable>("table_a");
   table->execute();
@@ -1,5 +1,7 @@
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -13,6 +15,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_context.hpp"
 #include "scheduler/shutdown_task.hpp"
 #include "scheduler/task_queue.hpp"
 
@@ -311,6 +314,33 @@ TEST_F(SchedulerTest, TaskToNodeAssignment) {
   EXPECT_EQ(node_queue_scheduler->workers()[1]->num_finished_tasks(), 1);
 }
 
+TEST_F(SchedulerTest, PreferredNodeOfTask) {
+  if (std::thread::hardware_concurrency() < 2) {
+    GTEST_SKIP();
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  const auto task_1 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+  const auto task_2 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+  const auto task_3 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+  task_1->set_preferred_node_id(NodeID{1});
+  task_2->set_preferred_node_id(NodeID{1});
+  // Tasks preferring nodes without workers are scheduled as if they had no preference.
+  task_3->set_preferred_node_id(INVALID_NODE_ID);
+
+  task_1->schedule();
+  task_2->schedule();
+  task_3->schedule();
+
+  node_queue_scheduler->wait_for_all_tasks();
+
+  EXPECT_EQ(node_queue_scheduler->workers()[0]->num_finished_tasks(), 1);
+  EXPECT_EQ(node_queue_scheduler->workers()[1]->num_finished_tasks(), 2);
+}
+
 TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().topology.use_default_topology(1);
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
@@ -332,6 +362,101 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, StealTasksFromWorkerDeques) {
+  if (std::thread::hardware_concurrency() < 2) {
+    GTEST_SKIP();
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  // The subtask is pushed to the deque of the worker executing the task. As the task does not wait for the subtask
+  // using wait_for_tasks(), but blocks its worker, only the other (sleeping) worker can execute the subtask. To do so,
+  // it has to be woken up and steal the subtask.
+  auto subtask_done = std::atomic_bool{false};
+  const auto task = std::make_shared<JobTask>([&]() {
+    const auto subtask = std::make_shared<JobTask>([&]() {
+      subtask_done = true;
+    });
+    subtask->schedule();
+    while (!subtask_done) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+  });
+
+  task->schedule();
+  node_queue_scheduler->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(subtask_done);
+  EXPECT_TRUE(node_queue_scheduler->queues()[0]->worker_deques_empty());
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, MaxParallelismOfQuery) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto TASK_COUNT = size_t{16};
+  auto& workload_manager = Hyrise::get().workload_manager;
+  const auto query_context = workload_manager.begin_query("query", QuerySchedulingOptions{1, 1});
+
+  auto concurrent_task_count = std::atomic_uint32_t{0};
+  auto max_concurrent_task_count = std::atomic_uint32_t{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      const auto current_count = ++concurrent_task_count;
+      auto max_count = max_concurrent_task_count.load();
+      while (max_count < current_count && !max_concurrent_task_count.compare_exchange_weak(max_count, current_count)) {}
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      --concurrent_task_count;
+    }));
+    tasks.back()->set_query_context(query_context);
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+  workload_manager.end_query(query_context);
+
+  EXPECT_EQ(max_concurrent_task_count.load(), 1);
+  EXPECT_EQ(query_context->scheduled_task_count(), TASK_COUNT);
+  EXPECT_EQ(query_context->finished_task_count(), TASK_COUNT);
+  EXPECT_EQ(query_context->running_task_count(), 0);
+  EXPECT_EQ(query_context->deferred_task_count(), 0);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, SubtasksInheritQueryContext) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto& workload_manager = Hyrise::get().workload_manager;
+  const auto query_context = workload_manager.begin_query("query", QuerySchedulingOptions{});
+
+  auto subtask_query_context = std::shared_ptr<QueryContext>{};
+  const auto task = std::make_shared<JobTask>([&]() {
+    EXPECT_EQ(QueryContext::current(), query_context.get());
+    const auto subtask = std::make_shared<JobTask>([&]() {
+      EXPECT_EQ(QueryContext::current(), query_context.get());
+    });
+    subtask->schedule();
+    subtask_query_context = subtask->query_context();
+    Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+  task->set_query_context(query_context);
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  workload_manager.end_query(query_context);
+
+  EXPECT_EQ(subtask_query_context, query_context);
+  EXPECT_EQ(QueryContext::current(), nullptr);
+  EXPECT_EQ(query_context->scheduled_task_count(), 2);
+  EXPECT_EQ(query_context->finished_task_count(), 2);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 TEST_F(SchedulerTest, DetermineQueueIDForTask) {
   if (std::thread::hardware_concurrency() < 2) {
     GTEST_SKIP();
@@ -0,0 +1,125 @@
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_tracer.hpp"
+
+namespace hyrise {
+
+class TaskTracerTest : public BaseTest {
+ protected:
+  // Executes JOB_COUNT JobTasks and returns their IDs. The scheduler is finished afterwards, so that all workers have
+  // recorded their events.
+  static std::unordered_set<TaskID::base_type> execute_jobs() {
+    Hyrise::get().topology.use_fake_numa_topology(4, 2);
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = uint32_t{0}; job_id < JOB_COUNT; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    Hyrise::get().scheduler()->finish();
+
+    auto job_ids = std::unordered_set<TaskID::base_type>{};
+    for (const auto& job : jobs) {
+      job_ids.emplace(job->id());
+    }
+    return job_ids;
+  }
+
+  static std::vector<nlohmann::json> execution_events(const nlohmann::json& trace) {
+    auto events = std::vector<nlohmann::json>{};
+    for (const auto& event : trace["traceEvents"]) {
+      if (event["ph"] == "X" && event["cat"] == "Execution") {
+        events.emplace_back(event);
+      }
+    }
+    return events;
+  }
+
+  static constexpr auto JOB_COUNT = uint32_t{20};
+};
+
+TEST_F(TaskTracerTest, DisabledByDefault) {
+  EXPECT_FALSE(Hyrise::get().task_tracer.is_enabled());
+
+  execute_jobs();
+  EXPECT_TRUE(execution_events(Hyrise::get().task_tracer.to_chrome_trace()).empty());
+}
+
+TEST_F(TaskTracerTest, RecordExecutedTasks) {
+  auto& task_tracer = Hyrise::get().task_tracer;
+  task_tracer.set_enabled(true);
+
+  const auto job_ids = execute_jobs();
+  const auto trace = task_tracer.to_chrome_trace();
+
+  // Each worker is named.
+  auto thread_names = size_t{0};
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "M" && event["name"] == "thread_name") {
+      ++thread_names;
+    }
+  }
+  EXPECT_EQ(thread_names, 4);
+
+  // All jobs are recorded.
+  auto traced_job_count = size_t{0};
+  for (const auto& event : execution_events(trace)) {
+    EXPECT_GE(event["dur"].get<double>(), 0.0);
+    EXPECT_GE(event["args"]["queue_wait_us"].get<double>(), 0.0);
+    if (job_ids.contains(event["args"]["task_id"].get<TaskID::base_type>())) {
+      ++traced_job_count;
+    }
+  }
+  EXPECT_EQ(traced_job_count, JOB_COUNT);
+
+  task_tracer.clear();
+  EXPECT_TRUE(execution_events(task_tracer.to_chrome_trace()).empty());
+}
+
+TEST_F(TaskTracerTest, TraceBufferKeepsMostRecentEvents) {
+  auto buffer = TaskTraceBuffer{WorkerID{0}, CpuID{0}, 3};
+  for (auto task_id = uint32_t{0}; task_id < 5; ++task_id) {
+    auto event = TaskTraceEvent{};
+    event.task_id = TaskID{task_id};
+    buffer.add(std::move(event));
+  }
+
+  const auto events = buffer.events();
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events[0].task_id, TaskID{2});
+  EXPECT_EQ(events[1].task_id, TaskID{3});
+  EXPECT_EQ(events[2].task_id, TaskID{4});
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.events().empty());
+}
+
+TEST_F(TaskTracerTest, Setting) {
+  auto& settings_manager = Hyrise::get().settings_manager;
+  EXPECT_FALSE(settings_manager.has_setting("Scheduler.task_tracing"));
+
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  ASSERT_TRUE(settings_manager.has_setting("Scheduler.task_tracing"));
+
+  const auto setting = settings_manager.get_setting("Scheduler.task_tracing");
+  EXPECT_EQ(setting->get(), "false");
+  setting->set("true");
+  EXPECT_TRUE(Hyrise::get().task_tracer.is_enabled());
+  EXPECT_EQ(setting->get(), "true");
+  EXPECT_THROW(setting->set("maybe"), std::logic_error);
+
+  Hyrise::get().scheduler()->finish();
+  EXPECT_FALSE(settings_manager.has_setting("Scheduler.task_tracing"));
+}
+
+}  // namespace hyrise
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base_test.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace hyrise {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    tasks.reserve(task_count);
+    for (auto task_id = size_t{0}; task_id < task_count; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopAndSteal) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+
+  const auto tasks = create_tasks(3);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size_approx(), 3);
+
+  // The owner pops the task pushed last, thieves steal the task pushed first.
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop());
+  EXPECT_FALSE(deque.steal());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{4};
+  const auto tasks = create_tasks(10);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size_approx(), 10);
+
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  for (auto task_id = size_t{9}; task_id > 0; --task_id) {
+    EXPECT_EQ(deque.pop(), tasks[task_id]);
+  }
+  EXPECT_TRUE(deque.empty());
+
+  EXPECT_THROW(WorkStealingDeque{3}, std::logic_error);
+}
+
+TEST_F(WorkStealingDequeTest, ReleaseRemainingTasks) {
+  const auto task = std::make_shared<JobTask>([]() {});
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+// The owner pushes and pops tasks while thieves concurrently steal tasks. Every task must be taken exactly once.
+TEST_F(WorkStealingDequeTest, ConcurrentSteal) {
+  constexpr auto TASK_COUNT = size_t{20'000};
+  constexpr auto THIEF_COUNT = size_t{4};
+
+  auto deque = WorkStealingDeque{16};
+  const auto tasks = create_tasks(TASK_COUNT);
+  auto taken_counts = std::vector<std::atomic_uint32_t>(TASK_COUNT);
+  auto task_ids = std::unordered_map<const AbstractTask*, size_t>{};
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    task_ids.emplace(&*tasks[task_id], task_id);
+  }
+
+  auto owner_done = std::atomic_bool{false};
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        const auto task = deque.steal();
+        if (task) {
+          ++taken_counts[task_ids.at(&*task)];
+        }
+      }
+    });
+  }
+
+  for (auto task_id = size_t{0}; task_id < TASK_COUNT; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) {
+      const auto task = deque.pop();
+      if (task) {
+        ++taken_counts[task_ids.at(&*task)];
+      }
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  for (const auto& taken_count : taken_counts) {
+    EXPECT_EQ(taken_count, 1);
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,127 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/query_context.hpp"
+#include "scheduler/workload_manager.hpp"
+
+namespace hyrise {
+
+class WorkloadManagerTest : public BaseTest {};
+
+TEST_F(WorkloadManagerTest, RunningQueries) {
+  auto& workload_manager = Hyrise::get().workload_manager;
+  EXPECT_TRUE(workload_manager.running_queries().empty());
+
+  const auto query_context_1 = workload_manager.begin_query("query 1", QuerySchedulingOptions{});
+  const auto query_context_2 = workload_manager.begin_query("query 2", QuerySchedulingOptions{2, 4}, 100);
+  EXPECT_EQ(workload_manager.running_queries().size(), 2);
+  EXPECT_NE(query_context_1->id(), query_context_2->id());
+  EXPECT_EQ(query_context_2->description(), "query 2");
+  EXPECT_EQ(query_context_2->options().weight, 2);
+  EXPECT_EQ(query_context_2->options().max_parallelism, 4);
+  EXPECT_EQ(query_context_2->estimated_memory_usage(), 100);
+  EXPECT_EQ(workload_manager.admitted_memory_usage(), 100);
+
+  workload_manager.end_query(query_context_1);
+  EXPECT_EQ(workload_manager.running_queries().size(), 1);
+  EXPECT_EQ(workload_manager.running_queries().front(), query_context_2);
+
+  workload_manager.end_query(query_context_2);
+  EXPECT_TRUE(workload_manager.running_queries().empty());
+  EXPECT_EQ(workload_manager.admitted_memory_usage(), 0);
+  EXPECT_THROW(workload_manager.end_query(query_context_2), std::logic_error);
+}
+
+TEST_F(WorkloadManagerTest, FairShare) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  auto& workload_manager = Hyrise::get().workload_manager;
+
+  const auto query_context_1 = workload_manager.begin_query("query 1", QuerySchedulingOptions{1, 0});
+  EXPECT_EQ(workload_manager.fair_share(1), 8);
+
+  const auto query_context_2 = workload_manager.begin_query("query 2", QuerySchedulingOptions{3, 0});
+  EXPECT_EQ(workload_manager.fair_share(1), 2);
+  EXPECT_EQ(workload_manager.fair_share(3), 6);
+
+  // Every query gets at least one worker.
+  const auto query_context_3 = workload_manager.begin_query("query 3", QuerySchedulingOptions{100, 0});
+  EXPECT_EQ(workload_manager.fair_share(1), 1);
+
+  workload_manager.end_query(query_context_1);
+  workload_manager.end_query(query_context_2);
+  workload_manager.end_query(query_context_3);
+}
+
+TEST_F(WorkloadManagerTest, DeferTasksOfQueriesAtTheirLimit) {
+  Hyrise::get().topology.use_fake_numa_topology(1, 1);
+  auto& workload_manager = Hyrise::get().workload_manager;
+  const auto query_context = workload_manager.begin_query("query", QuerySchedulingOptions{});
+
+  const auto task_1 = std::make_shared<JobTask>([]() {});
+  const auto task_2 = std::make_shared<JobTask>([]() {});
+
+  // The fair share of the query is the only worker.
+  EXPECT_TRUE(query_context->try_acquire_worker(task_1));
+  EXPECT_FALSE(query_context->try_acquire_worker(task_2));
+  EXPECT_EQ(query_context->deferred_task_count(), 1);
+
+  // Idle workers take deferred tasks as long as the query does not reach its hard limit (i.e., max_parallelism).
+  EXPECT_EQ(workload_manager.take_deferred_task(), task_2);
+  EXPECT_EQ(query_context->deferred_task_count(), 0);
+  EXPECT_FALSE(workload_manager.take_deferred_task());
+
+  query_context->release_worker();
+  query_context->release_worker();
+  workload_manager.end_query(query_context);
+}
+
+TEST_F(WorkloadManagerTest, DoNotTakeDeferredTasksBeyondMaxParallelism) {
+  auto& workload_manager = Hyrise::get().workload_manager;
+  const auto query_context = workload_manager.begin_query("query", QuerySchedulingOptions{1, 1});
+
+  const auto task_1 = std::make_shared<JobTask>([]() {});
+  const auto task_2 = std::make_shared<JobTask>([]() {});
+
+  EXPECT_TRUE(query_context->try_acquire_worker(task_1));
+  EXPECT_FALSE(query_context->try_acquire_worker(task_2));
+  EXPECT_FALSE(workload_manager.take_deferred_task());
+
+  // Ending the query drops tasks that are still deferred.
+  workload_manager.end_query(query_context);
+  EXPECT_EQ(query_context->deferred_task_count(), 0);
+}
+
+TEST_F(WorkloadManagerTest, AdmissionControl) {
+  auto& workload_manager = Hyrise::get().workload_manager;
+  workload_manager.set_memory_budget(100);
+  EXPECT_EQ(workload_manager.memory_budget(), 100);
+
+  // A query that exceeds the budget on its own is admitted if no other query runs.
+  const auto large_query_context = workload_manager.begin_query("large query", QuerySchedulingOptions{}, 1'000);
+  workload_manager.end_query(large_query_context);
+
+  const auto query_context_1 = workload_manager.begin_query("query 1", QuerySchedulingOptions{}, 80);
+
+  auto query_2_admitted = std::atomic_bool{false};
+  auto thread = std::thread([&]() {
+    const auto query_context_2 = workload_manager.begin_query("query 2", QuerySchedulingOptions{}, 50);
+    query_2_admitted = true;
+    workload_manager.end_query(query_context_2);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  EXPECT_FALSE(query_2_admitted);
+  EXPECT_EQ(workload_manager.admitted_memory_usage(), 80);
+
+  workload_manager.end_query(query_context_1);
+  thread.join();
+  EXPECT_TRUE(query_2_admitted);
+  EXPECT_EQ(workload_manager.admitted_memory_usage(), 0);
+}
+
+}  // namespace hyrise
@@ -337,6 +337,23 @@ TEST_F(StorageChunkTest, MemoryUsageEstimation) {
   EXPECT_GT(chunk->memory_usage(MemoryUsageCalculationMode::Sampled), segment_sizes + mvcc_size);
 }
 
+TEST_F(StorageChunkTest, MigrateToNumaNode) {
+  chunk = std::make_shared<Chunk>(Segments{vs_int, ds_str});
+  EXPECT_EQ(chunk->node_id(), INVALID_NODE_ID);
+
+  chunk->migrate(Hyrise::get().topology.get_memory_resource(NodeID{0}));
+  EXPECT_EQ(chunk->node_id(), NodeID{0});
+  EXPECT_NE(chunk->get_segment(ColumnID{0}), vs_int);
+  EXPECT_EQ(chunk->size(), 3);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[ChunkOffset{1}], AllTypeVariant{6});
+  EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[ChunkOffset{2}], AllTypeVariant{"!"});
+
+  // Chunks with indexes cannot be migrated.
+  chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_TRUE(chunk->has_indexes());
+  EXPECT_THROW(chunk->migrate(Hyrise::get().topology.get_memory_resource(NodeID{0})), std::logic_error);
+}
+
 // A concurrency stress test can be found at `stress_test.cpp` (ConcurrentInsertsSetChunksImmutable).
 TEST_F(StorageChunkTest, TrySetImmutable) {
   if constexpr (HYRISE_DEBUG) {
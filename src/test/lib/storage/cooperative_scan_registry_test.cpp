@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/cooperative_scan_registry.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class CooperativeScanRegistryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               ChunkOffset{2});
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      table->append({value});
+    }
+    Hyrise::get().storage_manager.add_table("table_a", table);
+  }
+
+  // Returns the ChunkIDs of GetTable's output that the output chunks of a scan reference, in the order of the output
+  // chunks.
+  static std::vector<ChunkID> scanned_chunk_ids(const std::shared_ptr<GetTable>& get_table) {
+    get_table->execute();
+    const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_equals_(column, 0));
+    table_scan->execute();
+
+    const auto& output_table = table_scan->get_output();
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+      const auto segment = output_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      chunk_ids.emplace_back(std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list()->common_chunk_id());
+    }
+    return chunk_ids;
+  }
+};
+
+TEST_F(CooperativeScanRegistryTest, AttachToOngoingScan) {
+  auto& registry = Hyrise::get().cooperative_scan_registry;
+  auto cursor = registry.attach("table_a");
+  EXPECT_EQ(cursor->position(), ChunkID{0});
+  cursor->advance(ChunkID{3});
+
+  // Scans of the same table share the cursor, scans of other tables do not.
+  EXPECT_EQ(registry.attach("table_a"), cursor);
+  EXPECT_EQ(registry.attach("table_a")->position(), ChunkID{3});
+  EXPECT_NE(registry.attach("table_b"), cursor);
+
+  // Once all scans are done, the next scan starts a new circular scan.
+  cursor = nullptr;
+  EXPECT_EQ(registry.attach("table_a")->position(), ChunkID{0});
+}
+
+TEST_F(CooperativeScanRegistryTest, TableScanStartsAtCursor) {
+  // Without a concurrent scan, the chunks are scanned in order.
+  EXPECT_EQ(scanned_chunk_ids(std::make_shared<GetTable>("table_a")),
+            std::vector<ChunkID>({ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}, ChunkID{4}}));
+
+  const auto cursor = Hyrise::get().cooperative_scan_registry.attach("table_a");
+  cursor->advance(ChunkID{3});
+  EXPECT_EQ(scanned_chunk_ids(std::make_shared<GetTable>("table_a")),
+            std::vector<ChunkID>({ChunkID{3}, ChunkID{4}, ChunkID{0}, ChunkID{1}, ChunkID{2}}));
+
+  // The scan advanced the cursor to the chunk it scanned last.
+  EXPECT_EQ(cursor->position(), ChunkID{2});
+
+  // Pruned chunks are skipped. The ChunkIDs of GetTable's output are mapped to the ChunkIDs of the stored table, so the
+  // scan starts at stored chunk 4, which is the third chunk of GetTable's output.
+  cursor->advance(ChunkID{3});
+  const auto get_table = std::make_shared<GetTable>("table_a", std::vector<ChunkID>{ChunkID{1}, ChunkID{3}},
+                                                    std::vector<ColumnID>{});
+  EXPECT_EQ(scanned_chunk_ids(get_table), std::vector<ChunkID>({ChunkID{2}, ChunkID{0}, ChunkID{1}}));
+  EXPECT_EQ(get_table->stored_chunk_ids(), std::vector<ChunkID>({ChunkID{0}, ChunkID{2}, ChunkID{4}}));
+}
+
+TEST_F(CooperativeScanRegistryTest, TableScanHandsOutChunksWithScheduler) {
+  // Chunks that are large enough to be scanned by jobs (see MorselSplitter).
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1'000});
+  for (auto value = int32_t{0}; value < 5'000; ++value) {
+    table->append({value});
+  }
+  Hyrise::get().storage_manager.add_table("table_b", table);
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto cursor = Hyrise::get().cooperative_scan_registry.attach("table_b");
+  cursor->advance(ChunkID{3});
+  auto chunk_ids = scanned_chunk_ids(std::make_shared<GetTable>("table_b"));
+  Hyrise::get().scheduler()->finish();
+
+  // The jobs scan every chunk exactly once.
+  std::sort(chunk_ids.begin(), chunk_ids.end());
+  EXPECT_EQ(chunk_ids, std::vector<ChunkID>({ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}, ChunkID{4}}));
+  EXPECT_LT(cursor->position(), ChunkID{5});
+}
+
+}  // namespace hyrise
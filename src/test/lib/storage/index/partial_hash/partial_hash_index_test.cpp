@@ -1,5 +1,6 @@
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "base_test.hpp"
@@ -74,6 +75,10 @@ class PartialHashIndexTest : public BaseTest {
                                                        const AllTypeVariant& value) const {
     return index->_range_not_equals(value);
   }
+
+  size_t merge(std::shared_ptr<PartialHashIndex> index, BasePartialHashIndexImpl&& other) const {
+    return index->_impl->merge(std::move(other));
+  }
 };
 
 TEST_F(PartialHashIndexTest, IndexCoverage) {
@@ -308,6 +313,30 @@ TEST_F(PartialHashIndexTest, Add) {
   EXPECT_EQ(index->insert(chunks_to_add), 0);
 }
 
+TEST_F(PartialHashIndexTest, MergeSkipsIndexedChunks) {
+  pmr_vector<pmr_string> values = {"new1", "delta", "nullptr"};
+  pmr_vector<bool> null_values = {false, false, true};
+  auto segment = std::make_shared<ValueSegment<pmr_string>>(std::move(values), std::move(null_values));
+  table->append_chunk(Segments{segment});
+
+  // Chunk 1 is already indexed, e.g., because another thread indexed it concurrently. Only chunk 2 is added.
+  auto other_impl = PartialHashIndexImpl<pmr_string>{{std::make_pair(ChunkID{1}, table->get_chunk(ChunkID{1})),
+                                                       std::make_pair(ChunkID{2}, table->get_chunk(ChunkID{2}))},
+                                                      ColumnID{0}};
+  EXPECT_EQ(merge(index, std::move(other_impl)), 1);
+
+  EXPECT_EQ(index->get_indexed_chunk_ids(), (tsl::sparse_set<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{2}}));
+  EXPECT_EQ(std::distance(cbegin(index), cend(index)), 16);
+  EXPECT_EQ(std::distance(null_cbegin(index), null_cend(index)), 3);
+  EXPECT_EQ(std::distance(range_equals(index, "delta").first, range_equals(index, "delta").second), 4);
+  EXPECT_EQ(*range_equals(index, "new1").first, (RowID{ChunkID{2}, ChunkOffset{0}}));
+
+  auto indexed_impl =
+      PartialHashIndexImpl<pmr_string>{{std::make_pair(ChunkID{2}, table->get_chunk(ChunkID{2}))}, ColumnID{0}};
+  EXPECT_EQ(merge(index, std::move(indexed_impl)), 0);
+  EXPECT_EQ(std::distance(cbegin(index), cend(index)), 16);
+}
+
 TEST_F(PartialHashIndexTest, Remove) {
   EXPECT_EQ(index->remove(std::vector<ChunkID>{ChunkID{0}}), 1);
 
@@ -0,0 +1,316 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/table.hpp"
+#include "utils/check_table_equal.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{3}));
+    storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_int4.tbl", ChunkOffset{3}));
+  }
+
+  static std::shared_ptr<MaterializedView> add_materialized_view(const std::string& name, const std::string& query) {
+    auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    const auto materialized_view =
+        std::make_shared<MaterializedView>(name, sql_pipeline.get_unoptimized_logical_plans().at(0));
+    Hyrise::get().storage_manager.add_materialized_view(materialized_view);
+    return materialized_view;
+  }
+
+  static std::shared_ptr<const Table> execute(
+      const std::string& query, const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{query};
+    if (transaction_context) {
+      builder.with_transaction_context(transaction_context);
+    }
+
+    auto sql_pipeline = builder.create_pipeline();
+    const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return result_table;
+  }
+
+  // Compares the result of the query with its result when it does not read from the materialized views, i.e., when it
+  // is not auto-committed (see MaterializedViewRule). Aggregates of the views are nullable, which is why the
+  // nullability is not compared.
+  static void expect_view_result(const std::string& query) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto expected_table = execute(query, transaction_context);
+    transaction_context->commit();
+
+    const auto table = execute(query);
+    if (const auto table_difference_message =
+            check_table_equal(table, expected_table, OrderSensitivity::No, TypeCmpMode::Strict,
+                              FloatComparisonMode::AbsoluteDifference, IgnoreNullable::Yes)) {
+      FAIL() << *table_difference_message;
+    }
+  }
+
+  // Returns the names of the tables that the optimized plan of the query reads.
+  static std::vector<std::string> read_table_names(const std::string& query,
+                                                   const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto builder = SQLPipelineBuilder{query};
+    if (transaction_context) {
+      builder.with_transaction_context(transaction_context);
+    }
+
+    auto sql_pipeline = builder.create_pipeline();
+    const auto [pipeline_status, result_table] = sql_pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+
+    auto table_names = std::vector<std::string>{};
+    visit_lqp(sql_pipeline.get_optimized_logical_plans().at(0), [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        table_names.emplace_back(static_cast<const StoredTableNode&>(*node).table_name);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    return table_names;
+  }
+};
+
+TEST_F(MaterializedViewTest, Populate) {
+  const auto materialized_view =
+      add_materialized_view("sums", "SELECT a, SUM(b) AS s, COUNT(*) AS c FROM table_a GROUP BY a");
+  EXPECT_TRUE(materialized_view->is_populated());
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  EXPECT_TRUE(storage_manager.has_materialized_view("sums"));
+  EXPECT_TRUE(storage_manager.has_view("sums"));
+  EXPECT_EQ(storage_manager.get_table(materialized_view->table_name()), materialized_view->table());
+  EXPECT_EQ(materialized_view->table()->row_count(), 7);
+  EXPECT_TRUE(materialized_view->reads_table(storage_manager.get_table("table_a")));
+  EXPECT_FALSE(materialized_view->reads_table(storage_manager.get_table("table_b")));
+
+  expect_view_result("SELECT * FROM sums");
+  expect_view_result("SELECT a, SUM(b), COUNT(*) FROM table_a GROUP BY a");
+
+  // The query reads the view's table instead of table_a.
+  EXPECT_EQ(read_table_names("SELECT a, SUM(b) AS s, COUNT(*) AS c FROM table_a GROUP BY a", nullptr),
+            std::vector<std::string>{materialized_view->table_name()});
+}
+
+TEST_F(MaterializedViewTest, IncrementalMaintenance) {
+  add_materialized_view("sums", "SELECT a, SUM(b) AS s, COUNT(b) AS c FROM table_a WHERE b > 1 GROUP BY a");
+
+  execute("INSERT INTO table_a VALUES (4, 5), (100, 1), (100, 2)");
+  expect_view_result("SELECT * FROM sums");
+
+  // All rows of group 13 are deleted.
+  execute("DELETE FROM table_a WHERE a = 13");
+  expect_view_result("SELECT * FROM sums");
+  EXPECT_TRUE(execute("SELECT * FROM sums WHERE a = 13")->empty());
+
+  execute("UPDATE table_a SET b = b + 1 WHERE a = 4");
+  expect_view_result("SELECT * FROM sums");
+
+  // Rolled back modifications do not change the view.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (4, 1000)", transaction_context);
+  transaction_context->rollback(RollbackReason::User);
+  expect_view_result("SELECT * FROM sums");
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4")->get_value<int64_t>(ColumnID{0}, 0), 35);
+}
+
+TEST_F(MaterializedViewTest, SnapshotIsolation) {
+  add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+
+  // Transactions see the view as of their snapshot.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (4, 100)");
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4", transaction_context)->get_value<int64_t>(ColumnID{0}, 0), 27);
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4")->get_value<int64_t>(ColumnID{0}, 0), 127);
+  transaction_context->commit();
+
+  // The group disappears once the deleting transaction commits.
+  const auto deleting_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("DELETE FROM table_a WHERE a = 4", deleting_transaction_context);
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4")->get_value<int64_t>(ColumnID{0}, 0), 127);
+  deleting_transaction_context->commit();
+  EXPECT_TRUE(execute("SELECT s FROM sums WHERE a = 4")->empty());
+}
+
+TEST_F(MaterializedViewTest, Transactions) {
+  const auto materialized_view = add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+  const auto query = std::string{"SELECT a, SUM(b) AS s FROM table_a GROUP BY a"};
+
+  // Transactions that are not auto-committed read the base tables, as they see their own uncommitted modifications.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (4, 100)", transaction_context);
+  EXPECT_EQ(read_table_names(query, transaction_context), std::vector<std::string>{"table_a"});
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4", transaction_context)->get_value<int64_t>(ColumnID{0}, 0), 127);
+  transaction_context->commit();
+
+  EXPECT_EQ(read_table_names(query, nullptr), std::vector<std::string>{materialized_view->table_name()});
+  EXPECT_EQ(execute("SELECT s FROM sums WHERE a = 4")->get_value<int64_t>(ColumnID{0}, 0), 127);
+}
+
+TEST_F(MaterializedViewTest, NoGroupBy) {
+  add_materialized_view("totals", "SELECT SUM(b) AS s, COUNT(*) AS c, COUNT(b) AS d FROM table_a WHERE a > 5");
+  expect_view_result("SELECT * FROM totals");
+
+  execute("INSERT INTO table_a VALUES (6, 1)");
+  expect_view_result("SELECT * FROM totals");
+
+  // SUM is NULL, COUNT is zero if no rows are left.
+  execute("DELETE FROM table_a");
+  expect_view_result("SELECT * FROM totals");
+  const auto result_table = execute("SELECT * FROM totals");
+  ASSERT_EQ(result_table->row_count(), 1);
+  EXPECT_FALSE(result_table->get_value<int64_t>(ColumnID{0}, 0));
+  EXPECT_EQ(result_table->get_value<int64_t>(ColumnID{1}, 0), 0);
+}
+
+TEST_F(MaterializedViewTest, Join) {
+  add_materialized_view("join_sums",
+                        "SELECT table_a.a, SUM(table_b.b) AS s, COUNT(*) AS c FROM table_a, table_b WHERE table_a.a = "
+                        "table_b.a GROUP BY table_a.a");
+  expect_view_result("SELECT * FROM join_sums");
+
+  execute("INSERT INTO table_a VALUES (7, 3)");
+  expect_view_result("SELECT * FROM join_sums");
+
+  execute("DELETE FROM table_b WHERE b > 10");
+  expect_view_result("SELECT * FROM join_sums");
+
+  // A transaction that modifies both tables.
+  execute("BEGIN; INSERT INTO table_a VALUES (20, 1); INSERT INTO table_b VALUES (20, 5), (20, 6); DELETE FROM table_a "
+          "WHERE a = 8; COMMIT;");
+  expect_view_result("SELECT * FROM join_sums");
+  EXPECT_EQ(execute("SELECT s FROM join_sums WHERE a = 20")->get_value<int64_t>(ColumnID{0}, 0), 11);
+}
+
+TEST_F(MaterializedViewTest, Compaction) {
+  const auto materialized_view = add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+
+  // Each insert appends a chunk to the view's table. Chunks that were compacted are removed by the next compaction.
+  for (auto insert_id = uint32_t{0}; insert_id < 2 * MaterializedView::COMPACTION_INTERVAL; ++insert_id) {
+    execute("INSERT INTO table_a VALUES (" + std::to_string(insert_id % 3) + ", 1)");
+  }
+  expect_view_result("SELECT * FROM sums");
+
+  const auto& table = materialized_view->table();
+  auto removed_chunk_count = uint32_t{0};
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!table->get_chunk(chunk_id)) {
+      ++removed_chunk_count;
+    }
+  }
+  EXPECT_GE(removed_chunk_count, MaterializedView::COMPACTION_INTERVAL);
+}
+
+TEST_F(MaterializedViewTest, Drop) {
+  const auto materialized_view = add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+  execute("SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.drop_materialized_view("sums");
+  EXPECT_FALSE(storage_manager.has_materialized_view("sums"));
+  EXPECT_FALSE(storage_manager.has_view("sums"));
+  EXPECT_FALSE(storage_manager.has_table(materialized_view->table_name()));
+
+  // Modifications and queries do not use the view anymore.
+  execute("INSERT INTO table_a VALUES (4, 5)");
+  expect_view_result("SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+  EXPECT_THROW(storage_manager.drop_materialized_view("sums"), std::logic_error);
+}
+
+TEST_F(MaterializedViewTest, DropBaseTable) {
+  const auto materialized_view = add_materialized_view(
+      "join_sums", "SELECT table_a.a, SUM(table_b.b) AS s FROM table_a, table_b WHERE table_a.a = table_b.a GROUP BY "
+                   "table_a.a");
+  add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_b GROUP BY a");
+
+  // Views that read the dropped table are dropped as well.
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.drop_table("table_a");
+  EXPECT_FALSE(storage_manager.has_materialized_view("join_sums"));
+  EXPECT_FALSE(storage_manager.has_view("join_sums"));
+  EXPECT_FALSE(storage_manager.has_table(materialized_view->table_name()));
+  EXPECT_TRUE(storage_manager.has_materialized_view("sums"));
+
+  execute("INSERT INTO table_b VALUES (4, 5)");
+  expect_view_result("SELECT * FROM sums");
+}
+
+TEST_F(MaterializedViewTest, ConcurrentModifications) {
+  // Commits neither execute queries nor wait for preceding commits, so that concurrent transactions whose operators
+  // run on the same workers do not block each other.
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto materialized_view = add_materialized_view("sums", "SELECT a, SUM(b) AS s FROM table_a GROUP BY a");
+  const auto join_materialized_view = add_materialized_view(
+      "join_sums", "SELECT table_a.a, SUM(table_b.b) AS s, COUNT(*) AS c FROM table_a, table_b WHERE table_a.a = "
+                   "table_b.a GROUP BY table_a.a");
+
+  const auto thread_count = uint32_t{8};
+  const auto iterations_per_thread = uint32_t{10};
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count);
+  for (auto thread_id = uint32_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = uint32_t{0}; iteration < iterations_per_thread; ++iteration) {
+        // Each row has a unique value of b, so that the deletes do not conflict.
+        const auto a = std::to_string(thread_id % 4);
+        const auto b = std::to_string(1000 + (thread_id * iterations_per_thread) + iteration);
+        execute("INSERT INTO table_a VALUES (" + a + ", " + b + ")");
+        execute("INSERT INTO table_b VALUES (" + a + ", " + b + ")");
+        if (iteration % 2 == 1) {
+          execute("DELETE FROM table_a WHERE b = " + b);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto last_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  EXPECT_TRUE(materialized_view->covers_snapshot(last_commit_id));
+  EXPECT_TRUE(join_materialized_view->covers_snapshot(last_commit_id));
+  expect_view_result("SELECT * FROM sums");
+  expect_view_result("SELECT * FROM join_sums");
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(MaterializedViewTest, UnsupportedQueries) {
+  const auto create = [](const std::string& query) {
+    auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    return std::make_shared<MaterializedView>("view", sql_pipeline.get_unoptimized_logical_plans().at(0));
+  };
+
+  EXPECT_THROW(create("SELECT a, b FROM table_a"), InvalidInputException);
+  EXPECT_THROW(create("SELECT a, MIN(b) FROM table_a GROUP BY a"), InvalidInputException);
+  EXPECT_THROW(create("SELECT a, AVG(b) FROM table_a GROUP BY a"), InvalidInputException);
+  EXPECT_THROW(create("SELECT a, COUNT(DISTINCT b) FROM table_a GROUP BY a"), InvalidInputException);
+  EXPECT_THROW(create("SELECT table_a.a, COUNT(*) FROM table_a LEFT JOIN table_b ON table_a.a = table_b.a GROUP BY "
+                      "table_a.a"),
+               InvalidInputException);
+  EXPECT_THROW(create("SELECT t1.a, COUNT(*) FROM table_a t1, table_a t2 WHERE t1.a = t2.b GROUP BY t1.a"),
+               InvalidInputException);
+  EXPECT_THROW(create("SELECT a, COUNT(*) FROM table_a WHERE b IN (SELECT b FROM table_b) GROUP BY a"),
+               InvalidInputException);
+}
+
+}  // namespace hyrise
@@ -111,6 +111,53 @@ TEST_F(MvccDataTest, MaxBeginAndEndCID) {
   EXPECT_EQ(_mvcc_data->max_end_cid.load(), CommitID{2});
 }
 
+TEST_F(MvccDataTest, MinEndCID) {
+  // The end_cid of row 0 is set to 2 in SetUp().
+  EXPECT_EQ(_mvcc_data->min_end_cid.load(), CommitID{2});
+
+  _mvcc_data->set_end_cid(ChunkOffset{2}, CommitID{5});
+  EXPECT_EQ(_mvcc_data->min_end_cid.load(), CommitID{2});
+
+  _mvcc_data->set_end_cid(ChunkOffset{2}, CommitID{0});
+  EXPECT_EQ(_mvcc_data->min_end_cid.load(), CommitID{0});
+}
+
+TEST_F(MvccDataTest, MinBeginCID) {
+  // Initialized with the begin_cid passed to the constructor.
+  EXPECT_EQ(_mvcc_data->min_begin_cid.load(), CommitID{1});
+
+  auto mvcc_data = MvccData{ChunkOffset{3}, MvccData::MAX_COMMIT_ID};
+  EXPECT_EQ(mvcc_data.min_begin_cid.load(), MvccData::MAX_COMMIT_ID);
+
+  mvcc_data.set_begin_cid(ChunkOffset{0}, CommitID{5});
+  EXPECT_EQ(mvcc_data.min_begin_cid.load(), CommitID{5});
+
+  mvcc_data.set_begin_cids(ChunkOffset{1}, ChunkOffset{3}, CommitID{4});
+  EXPECT_EQ(mvcc_data.min_begin_cid.load(), CommitID{4});
+
+  // Empty ranges are ignored.
+  mvcc_data.set_begin_cids(ChunkOffset{1}, ChunkOffset{1}, CommitID{2});
+  EXPECT_EQ(mvcc_data.min_begin_cid.load(), CommitID{4});
+
+  mvcc_data.set_begin_cid(ChunkOffset{2}, CommitID{6});
+  EXPECT_EQ(mvcc_data.min_begin_cid.load(), CommitID{4});
+}
+
+TEST_F(MvccDataTest, CommittedVisibility) {
+  // Row 0 is inserted and deleted with commit ID 2, row 1 is inserted with commit ID 3 and deleted with commit ID 4,
+  // row 2 is inserted with commit ID 1. TIDs are ignored.
+  auto visible_rows = std::vector<uint8_t>{};
+
+  _mvcc_data->get_committed_visibility(ChunkOffset{3}, CommitID{1}, visible_rows);
+  EXPECT_EQ(visible_rows, std::vector<uint8_t>({0, 0, 1}));
+
+  _mvcc_data->get_committed_visibility(ChunkOffset{3}, CommitID{3}, visible_rows);
+  EXPECT_EQ(visible_rows, std::vector<uint8_t>({0, 1, 1}));
+
+  _mvcc_data->get_committed_visibility(ChunkOffset{2}, CommitID{4}, visible_rows);
+  EXPECT_EQ(visible_rows, std::vector<uint8_t>({0, 0}));
+}
+
 TEST_F(MvccDataTest, PendingInserts) {
   EXPECT_EQ(_mvcc_data->pending_inserts(), 0);
 
@@ -0,0 +1,251 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/shared_dictionary_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class SharedDictionaryEncoderTest : public BaseTest {
+ public:
+  static std::shared_ptr<Table> create_table(const std::vector<AllTypeVariant>& values) {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    for (const auto& value : values) {
+      table->append({value});
+    }
+
+    return table;
+  }
+
+  static std::shared_ptr<TableWrapper> wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static void finalize(const std::shared_ptr<Table>& table) {
+    const auto last_chunk = table->last_chunk();
+    if (last_chunk->is_mutable()) {
+      last_chunk->set_immutable();
+    }
+  }
+};
+
+TEST_F(SharedDictionaryEncoderTest, EncodeColumn) {
+  const auto table = create_table({"b", "a", "c", NULL_VALUE, "a", "d", "b"});
+  const auto expected_table = create_table({"b", "a", "c", NULL_VALUE, "a", "d", "b"});
+  finalize(table);
+
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+
+  const auto dictionary = get_shared_dictionary<pmr_string>(*table, ColumnID{0});
+  ASSERT_TRUE(dictionary);
+  EXPECT_EQ(*dictionary, pmr_vector<pmr_string>({"a", "b", "c", "d"}));
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+        table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->dictionary(), dictionary);
+    EXPECT_TRUE(table->get_chunk(chunk_id)->pruning_statistics());
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(SharedDictionaryEncoderTest, SkipMutableChunks) {
+  const auto table = create_table({"b", "a", "c", "d"});
+
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+
+  EXPECT_FALSE(get_shared_dictionary<pmr_string>(*table, ColumnID{0}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<pmr_string>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+}
+
+TEST_F(SharedDictionaryEncoderTest, EncodeIncrementally) {
+  const auto table = create_table({"b", "d", NULL_VALUE, "d", "b", "b"});
+  finalize(table);
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+
+  const auto previous_dictionary = get_shared_dictionary<pmr_string>(*table, ColumnID{0});
+  ASSERT_TRUE(previous_dictionary);
+  EXPECT_EQ(*previous_dictionary, pmr_vector<pmr_string>({"b", "d"}));
+
+  // Chunks without unknown values do not change the dictionary.
+  table->append({"d"});
+  table->append({NULL_VALUE});
+  table->append({"b"});
+  finalize(table);
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+  EXPECT_EQ(get_shared_dictionary<pmr_string>(*table, ColumnID{0}), previous_dictionary);
+
+  // Unknown values are merged into the dictionary and previously encoded segments are remapped.
+  table->append({"a"});
+  table->append({"c"});
+  table->append({"e"});
+  finalize(table);
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+
+  const auto dictionary = get_shared_dictionary<pmr_string>(*table, ColumnID{0});
+  ASSERT_TRUE(dictionary);
+  EXPECT_NE(dictionary, previous_dictionary);
+  EXPECT_EQ(*dictionary, pmr_vector<pmr_string>({"a", "b", "c", "d", "e"}));
+
+  const auto expected_table = create_table({"b", "d", NULL_VALUE, "d", "b", "b", "d", NULL_VALUE, "b", "a", "c", "e"});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(SharedDictionaryEncoderTest, EncodeMultipleColumns) {
+  const auto table_a = create_table({"x", "y", "z"});
+  const auto table_b = create_table({"v", "w", "x"});
+  finalize(table_a);
+  finalize(table_b);
+  SharedDictionaryEncoder::encode_columns({{table_a, ColumnID{0}}, {table_b, ColumnID{0}}});
+
+  const auto dictionary = get_shared_dictionary<pmr_string>(*table_a, ColumnID{0});
+  ASSERT_TRUE(dictionary);
+  EXPECT_EQ(dictionary, get_shared_dictionary<pmr_string>(*table_b, ColumnID{0}));
+  EXPECT_EQ(*dictionary, pmr_vector<pmr_string>({"v", "w", "x", "y", "z"}));
+}
+
+TEST_F(SharedDictionaryEncoderTest, GetSharedDictionary) {
+  const auto table = create_table({"b", "a", "c", "d", "e", "f"});
+  finalize(table);
+
+  // Chunk-local dictionaries are not shared.
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FALSE(get_shared_dictionary<pmr_string>(*table, ColumnID{0}));
+
+  SharedDictionaryEncoder::encode_column(table, ColumnID{0});
+  const auto dictionary = get_shared_dictionary<pmr_string>(*table, ColumnID{0});
+  EXPECT_TRUE(dictionary);
+
+  // Reference tables are checked via their referenced tables.
+  const auto table_scan = std::make_shared<TableScan>(
+      wrap(table), greater_than_(pqp_column_(ColumnID{0}, DataType::String, true, "a"), value_("a")));
+  table_scan->execute();
+  EXPECT_EQ(get_shared_dictionary<pmr_string>(*table_scan->get_output(), ColumnID{0}), dictionary);
+}
+
+TEST_F(SharedDictionaryEncoderTest, AggregateAndJoinOnValueIDs) {
+  const auto values = std::vector<AllTypeVariant>{"b", "a", NULL_VALUE, "c", "a", "b", "d", NULL_VALUE, "a"};
+  const auto shared_table = create_table(values);
+  const auto unshared_table = create_table(values);
+  finalize(shared_table);
+  finalize(unshared_table);
+
+  SharedDictionaryEncoder::encode_column(shared_table, ColumnID{0});
+  ChunkEncoder::encode_all_chunks(unshared_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  ASSERT_TRUE(get_shared_dictionary<pmr_string>(*shared_table, ColumnID{0}));
+
+  const auto shared_input = wrap(shared_table);
+  const auto unshared_input = wrap(unshared_table);
+
+  const auto aggregate = [](const auto& input) {
+    const auto column = pqp_column_(ColumnID{0}, DataType::String, true, "a");
+    auto aggregate_hash = std::make_shared<AggregateHash>(
+        input, std::vector<std::shared_ptr<WindowFunctionExpression>>{count_(column)},
+        std::vector<ColumnID>{ColumnID{0}});
+    aggregate_hash->execute();
+    return aggregate_hash->get_output();
+  };
+  EXPECT_TABLE_EQ_UNORDERED(aggregate(shared_input), aggregate(unshared_input));
+
+  // Join the referencing output of a scan with the data table.
+  const auto scan = [](const auto& input) {
+    auto table_scan = std::make_shared<TableScan>(
+        input, not_equals_(pqp_column_(ColumnID{0}, DataType::String, true, "a"), value_("c")));
+    table_scan->never_clear_output();
+    table_scan->execute();
+    return table_scan;
+  };
+  const auto shared_scan = scan(shared_input);
+  const auto unshared_scan = scan(unshared_input);
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse}) {
+    const auto join = [&](const auto& left, const auto& right) {
+      auto join_hash = std::make_shared<JoinHash>(
+          left, right, join_mode, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+      join_hash->execute();
+      return join_hash->get_output();
+    };
+    EXPECT_TABLE_EQ_UNORDERED(join(shared_input, shared_scan), join(unshared_input, unshared_scan));
+  }
+}
+
+TEST_F(SharedDictionaryEncoderTest, ConcurrentReencoding) {
+  // Adding values to the shared dictionary remaps the value IDs of all segments. Operators that run concurrently must
+  // not mix value IDs of different dictionary versions.
+  const auto values = std::vector<AllTypeVariant>{"b", "a", NULL_VALUE, "c", "a", "b", "d", "c", "a"};
+  const auto shared_table = create_table(values);
+  const auto unshared_table = create_table(values);
+  const auto other_table = create_table({});
+  finalize(shared_table);
+  finalize(unshared_table);
+
+  SharedDictionaryEncoder::encode_columns({{shared_table, ColumnID{0}}, {other_table, ColumnID{0}}});
+  ChunkEncoder::encode_all_chunks(unshared_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::String, true, "a");
+  const auto aggregate = [&](const auto& input) {
+    auto aggregate_hash = std::make_shared<AggregateHash>(
+        input, std::vector<std::shared_ptr<WindowFunctionExpression>>{count_(column)},
+        std::vector<ColumnID>{ColumnID{0}});
+    aggregate_hash->execute();
+    return aggregate_hash->get_output();
+  };
+  const auto join = [](const auto& left, const auto& right) {
+    auto join_hash = std::make_shared<JoinHash>(
+        left, right, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+    join_hash->execute();
+    return join_hash->get_output();
+  };
+
+  const auto unshared_input = wrap(unshared_table);
+  const auto expected_aggregate = aggregate(unshared_input);
+  const auto expected_join = join(unshared_input, unshared_input);
+
+  // The encoder adds values that are sorted between the existing values, so that the value IDs of "c" and "d" change.
+  auto encoding_done = std::atomic_bool{false};
+  auto encoder = std::thread{[&]() {
+    for (auto iteration = uint32_t{0}; iteration < 50; ++iteration) {
+      for (auto value_id = uint32_t{0}; value_id < 3; ++value_id) {
+        other_table->append({pmr_string{"b" + std::to_string(iteration * 3 + value_id)}});
+      }
+      finalize(other_table);
+      SharedDictionaryEncoder::encode_columns({{shared_table, ColumnID{0}}, {other_table, ColumnID{0}}});
+    }
+    encoding_done = true;
+  }};
+
+  do {
+    const auto shared_input = wrap(shared_table);
+    EXPECT_TABLE_EQ_UNORDERED(aggregate(shared_input), expected_aggregate);
+    EXPECT_TABLE_EQ_UNORDERED(join(shared_input, shared_input), expected_join);
+  } while (!encoding_done);
+
+  encoder.join();
+}
+
+}  // namespace hyrise
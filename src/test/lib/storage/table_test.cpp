@@ -1,3 +1,4 @@
+#include <array>
 #include <limits>
 #include <memory>
 #include <string>
@@ -7,6 +8,7 @@
 #include "base_test.hpp"
 #include "memory/zero_allocator.hpp"
 #include "resolve_type.hpp"
+#include "storage/column_span.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -161,6 +163,41 @@ TEST_F(StorageTableTest, AppendsMutableChunkIfLastChunkImmutableOnAppend) {
   EXPECT_EQ(table->chunk_count(), 3);
 }
 
+TEST_F(StorageTableTest, AppendColumns) {
+  table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({4, "Hello,"});
+
+  const auto int_values = std::vector<int32_t>{6, 3, 8};
+  const auto string_values = std::vector<pmr_string>{"world", "", "!"};
+  const auto null_values = std::array<bool, 3>{false, true, false};
+  table->append_columns({ColumnSpan{int_values}, ColumnSpan{string_values, null_values}});
+
+  // The first chunk was filled up and marked as immutable before the second chunk was appended.
+  ASSERT_EQ(table->chunk_count(), 2);
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->mvcc_data()->get_begin_cid(ChunkOffset{1}), CommitID{0});
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({4, "Hello,"});
+  expected_table->append({6, "world"});
+  expected_table->append({3, NULL_VALUE});
+  expected_table->append({8, "!"});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Data types and sizes have to match the table's columns.
+  EXPECT_THROW(table->append_columns({ColumnSpan{int_values}}), std::exception);
+  EXPECT_THROW(table->append_columns({ColumnSpan{int_values}, ColumnSpan{int_values}}), std::exception);
+  EXPECT_THROW(table->append_columns({ColumnSpan{int_values}, ColumnSpan{std::vector<pmr_string>{"a"}}}),
+               std::exception);
+
+  // Inserting nothing does not add a chunk.
+  const auto no_int_values = std::vector<int32_t>{};
+  const auto no_string_values = std::vector<pmr_string>{};
+  table->append_columns({ColumnSpan{no_int_values}, ColumnSpan{no_string_values}});
+  EXPECT_EQ(table->chunk_count(), 2);
+}
+
 TEST_F(StorageTableTest, EmplaceChunk) {
   EXPECT_EQ(table->chunk_count(), 0);
 
@@ -339,4 +376,66 @@ TEST_F(StorageTableTest, CreatePartialHashIndexOnEmptyChunks) {
   EXPECT_THROW(table->create_partial_hash_index(ColumnID{0}, {}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, InsertChunks) {
+  const auto mvcc_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  mvcc_table->append({1, "a"});
+
+  // With a single insert chunk, Inserts write to the last chunk.
+  EXPECT_EQ(mvcc_table->insert_chunk_count(), 1);
+  EXPECT_EQ(mvcc_table->insert_chunk_slot(), 0);
+  {
+    const auto lock = mvcc_table->acquire_insert_chunk_mutex(0);
+    EXPECT_EQ(mvcc_table->get_or_append_insert_chunk(0), ChunkID{0});
+    EXPECT_FALSE(mvcc_table->is_insert_chunk(ChunkID{0}));
+  }
+
+  // Multiple insert chunks do not adopt the former last chunk, but each slot gets its own chunk.
+  mvcc_table->set_insert_chunk_count(2);
+  EXPECT_EQ(mvcc_table->insert_chunk_count(), 2);
+  EXPECT_LT(mvcc_table->insert_chunk_slot(), 2);
+  EXPECT_TRUE(mvcc_table->get_chunk(ChunkID{0})->is_marked_as_full());
+  EXPECT_FALSE(mvcc_table->get_chunk(ChunkID{0})->is_mutable());
+  {
+    const auto lock = mvcc_table->acquire_insert_chunk_mutex(1);
+    EXPECT_EQ(mvcc_table->get_or_append_insert_chunk(1), ChunkID{1});
+    EXPECT_EQ(mvcc_table->get_or_append_insert_chunk(1), ChunkID{1});
+  }
+  {
+    const auto lock = mvcc_table->acquire_insert_chunk_mutex(0);
+    EXPECT_EQ(mvcc_table->get_or_append_insert_chunk(0), ChunkID{2});
+  }
+  EXPECT_FALSE(mvcc_table->is_insert_chunk(ChunkID{0}));
+  EXPECT_TRUE(mvcc_table->is_insert_chunk(ChunkID{1}));
+  EXPECT_TRUE(mvcc_table->is_insert_chunk(ChunkID{2}));
+
+  // append() does not write to insert chunks.
+  mvcc_table->append({2, "b"});
+  EXPECT_EQ(mvcc_table->chunk_count(), 4);
+  EXPECT_EQ(mvcc_table->get_chunk(ChunkID{2})->size(), 0);
+  EXPECT_EQ(mvcc_table->get_chunk(ChunkID{3})->size(), 1);
+
+  // Slots whose insert chunk is marked as full get a new one.
+  mvcc_table->get_chunk(ChunkID{1})->mark_as_full();
+  {
+    const auto lock = mvcc_table->acquire_insert_chunk_mutex(1);
+    EXPECT_EQ(mvcc_table->get_or_append_insert_chunk(1), ChunkID{4});
+  }
+  EXPECT_FALSE(mvcc_table->is_insert_chunk(ChunkID{1}));
+
+  EXPECT_THROW(mvcc_table->set_insert_chunk_count(0), std::logic_error);
+  EXPECT_THROW(table->set_insert_chunk_count(2), std::logic_error);
+}
+
+TEST_F(StorageTableTest, LastCommitID) {
+  const auto mvcc_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  EXPECT_EQ(mvcc_table->last_commit_id(), CommitID{0});
+
+  mvcc_table->update_last_commit_id(CommitID{5});
+  EXPECT_EQ(mvcc_table->last_commit_id(), CommitID{5});
+
+  // Commits might update the table out of order.
+  mvcc_table->update_last_commit_id(CommitID{3});
+  EXPECT_EQ(mvcc_table->last_commit_id(), CommitID{5});
+}
+
 }  // namespace hyrise
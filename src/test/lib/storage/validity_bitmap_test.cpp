@@ -0,0 +1,75 @@
+#include <cstddef>
+
+#include "base_test.hpp"
+#include "storage/validity_bitmap.hpp"
+
+namespace hyrise {
+
+class ValidityBitmapTest : public BaseTest {
+ protected:
+  // NULL values of 130 positions, i.e., three words, where every third position is NULL.
+  static pmr_vector<bool> create_null_values() {
+    auto null_values = pmr_vector<bool>(130);
+    for (auto offset = size_t{0}; offset < null_values.size(); offset += 3) {
+      null_values[offset] = true;
+    }
+    return null_values;
+  }
+};
+
+TEST_F(ValidityBitmapTest, FromNullValues) {
+  const auto null_values = create_null_values();
+  const auto bitmap = ValidityBitmap::from_null_values(null_values);
+
+  EXPECT_EQ(bitmap.size(), 130);
+  EXPECT_EQ(bitmap.words().size(), 3);
+  for (auto offset = ChunkOffset{0}; offset < ChunkOffset{130}; ++offset) {
+    EXPECT_EQ(bitmap.is_valid(offset), !null_values[offset]);
+  }
+  EXPECT_EQ(bitmap.count(), 86);
+
+  // Bits beyond the last position are unset.
+  EXPECT_EQ(bitmap.words().back() >> 2, 0);
+}
+
+TEST_F(ValidityBitmapTest, Constant) {
+  EXPECT_EQ(ValidityBitmap(0, true).words().size(), 0);
+  EXPECT_EQ(ValidityBitmap(64, true).words().size(), 1);
+  EXPECT_EQ(ValidityBitmap(65, true).count(), 65);
+  EXPECT_EQ(ValidityBitmap(65, false).count(), 0);
+}
+
+TEST_F(ValidityBitmapTest, Invert) {
+  auto bitmap = ValidityBitmap::from_null_values(create_null_values());
+  bitmap.invert();
+
+  EXPECT_EQ(bitmap.count(), 44);
+  EXPECT_TRUE(bitmap.is_valid(ChunkOffset{0}));
+  EXPECT_FALSE(bitmap.is_valid(ChunkOffset{1}));
+  EXPECT_TRUE(bitmap.is_valid(ChunkOffset{129}));
+}
+
+TEST_F(ValidityBitmapTest, AndOr) {
+  auto null_values = pmr_vector<bool>(100);
+  null_values[1] = true;
+  null_values[2] = true;
+  auto other_null_values = pmr_vector<bool>(100);
+  other_null_values[2] = true;
+  other_null_values[3] = true;
+  const auto other_bitmap = ValidityBitmap::from_null_values(other_null_values);
+
+  auto intersection = ValidityBitmap::from_null_values(null_values);
+  intersection &= other_bitmap;
+  EXPECT_EQ(intersection.count(), 97);
+  EXPECT_FALSE(intersection.is_valid(ChunkOffset{1}));
+  EXPECT_FALSE(intersection.is_valid(ChunkOffset{3}));
+
+  auto union_bitmap = ValidityBitmap::from_null_values(null_values);
+  union_bitmap |= other_bitmap;
+  EXPECT_EQ(union_bitmap.count(), 99);
+  EXPECT_FALSE(union_bitmap.is_valid(ChunkOffset{2}));
+
+  EXPECT_THROW(union_bitmap &= ValidityBitmap(99, true), std::logic_error);
+}
+
+}  // namespace hyrise
@@ -1,3 +1,4 @@
+#include <array>
 #include <limits>
 #include <string>
 #include <vector>
@@ -66,6 +67,44 @@ TEST_F(StorageValueSegmentTest, AppendNullValueWhenNullable) {
   EXPECT_NO_THROW(vs_double.append(NULL_VALUE));
 }
 
+TEST_F(StorageValueSegmentTest, ContainsNullValues) {
+  EXPECT_FALSE(vs_int.contains_null_values());
+
+  auto nullable_segment = ValueSegment<int>{true, ChunkOffset{3}};
+  nullable_segment.append(1);
+  EXPECT_FALSE(nullable_segment.contains_null_values());
+  nullable_segment.append(NULL_VALUE);
+  EXPECT_TRUE(nullable_segment.contains_null_values());
+
+  auto resized_segment = ValueSegment<int>{true, ChunkOffset{3}};
+  resized_segment.resize(2);
+  EXPECT_FALSE(resized_segment.contains_null_values());
+  resized_segment.set_null_value(ChunkOffset{1});
+  EXPECT_TRUE(resized_segment.contains_null_values());
+
+  EXPECT_FALSE((ValueSegment<int>{pmr_vector<int>{1, 2}, pmr_vector<bool>{false, false}}.contains_null_values()));
+  EXPECT_TRUE((ValueSegment<int>{pmr_vector<int>{1, 2}, pmr_vector<bool>{false, true}}.contains_null_values()));
+}
+
+TEST_F(StorageValueSegmentTest, AppendValues) {
+  const auto values = std::vector<int>{1, 2, 3};
+  vs_int.append_values(values);
+  EXPECT_EQ(vs_int.values(), pmr_vector<int>({1, 2, 3}));
+
+  const auto null_values = std::array<bool, 3>{false, true, false};
+  EXPECT_THROW(vs_int.append_values(values, null_values), std::exception);
+
+  auto nullable_segment = ValueSegment<int>{true, ChunkOffset{6}};
+  nullable_segment.append_values(values);
+  EXPECT_FALSE(nullable_segment.contains_null_values());
+  nullable_segment.append_values(values, null_values);
+  EXPECT_TRUE(nullable_segment.contains_null_values());
+  EXPECT_EQ(nullable_segment.null_values(), pmr_vector<bool>({false, false, false, false, true, false}));
+
+  // The segment cannot grow beyond its capacity.
+  EXPECT_THROW(nullable_segment.append_values(values), std::exception);
+}
+
 TEST_F(StorageValueSegmentTest, ArraySubscriptOperatorReturnsNullValue) {
   auto vs_int = ValueSegment<int>{true};
   auto vs_str = ValueSegment<pmr_string>{true};
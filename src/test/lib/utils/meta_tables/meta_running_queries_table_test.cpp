@@ -0,0 +1,55 @@
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/query_context.hpp"
+#include "utils/meta_tables/meta_running_queries_table.hpp"
+
+namespace hyrise {
+
+class MetaRunningQueriesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    meta_running_queries_table = std::make_shared<MetaRunningQueriesTable>();
+  }
+
+  const std::shared_ptr<Table> generate_meta_table() const {
+    return meta_running_queries_table->_on_generate();
+  }
+
+  std::shared_ptr<MetaRunningQueriesTable> meta_running_queries_table;
+};
+
+TEST_F(MetaRunningQueriesTest, IsImmutable) {
+  EXPECT_FALSE(meta_running_queries_table->can_insert());
+  EXPECT_FALSE(meta_running_queries_table->can_update());
+  EXPECT_FALSE(meta_running_queries_table->can_delete());
+}
+
+TEST_F(MetaRunningQueriesTest, TableGeneration) {
+  auto& workload_manager = Hyrise::get().workload_manager;
+  EXPECT_EQ(generate_meta_table()->row_count(), 0);
+
+  const auto query_context = workload_manager.begin_query("SELECT 1", QuerySchedulingOptions{2, 3}, 42);
+  query_context->register_scheduled_task();
+
+  const auto meta_table = generate_meta_table();
+  ASSERT_EQ(meta_table->row_count(), 1);
+
+  const auto values = meta_table->get_row(0);
+  EXPECT_EQ(values[0], AllTypeVariant{static_cast<int64_t>(query_context->id())});
+  EXPECT_EQ(values[1], AllTypeVariant{pmr_string{"SELECT 1"}});
+  EXPECT_EQ(values[2], AllTypeVariant{int32_t{2}});
+  EXPECT_EQ(values[3], AllTypeVariant{int32_t{3}});
+  EXPECT_GE(boost::get<int64_t>(values[4]), 0);
+  EXPECT_EQ(values[5], AllTypeVariant{int64_t{42}});
+  EXPECT_EQ(values[6], AllTypeVariant{int64_t{1}});
+  EXPECT_EQ(values[7], AllTypeVariant{int64_t{0}});
+  EXPECT_EQ(values[8], AllTypeVariant{int64_t{1}});
+  EXPECT_EQ(values[9], AllTypeVariant{int64_t{0}});
+  EXPECT_EQ(values[10], AllTypeVariant{int64_t{0}});
+  EXPECT_EQ(values[11], AllTypeVariant{int64_t{0}});
+
+  workload_manager.end_query(query_context);
+  EXPECT_EQ(generate_meta_table()->row_count(), 0);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,66 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "utils/meta_tables/meta_task_queues_table.hpp"
+
+namespace hyrise {
+
+class MetaTaskQueuesTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    meta_task_queues_table = std::make_shared<MetaTaskQueuesTable>();
+  }
+
+  const std::shared_ptr<Table> generate_meta_table() const {
+    return meta_task_queues_table->_on_generate();
+  }
+
+  std::shared_ptr<MetaTaskQueuesTable> meta_task_queues_table;
+};
+
+TEST_F(MetaTaskQueuesTableTest, IsImmutable) {
+  EXPECT_FALSE(meta_task_queues_table->can_insert());
+  EXPECT_FALSE(meta_task_queues_table->can_update());
+  EXPECT_FALSE(meta_task_queues_table->can_delete());
+}
+
+TEST_F(MetaTaskQueuesTableTest, EmptyWithoutNodeQueueScheduler) {
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  EXPECT_EQ(generate_meta_table()->row_count(), 0);
+}
+
+TEST_F(MetaTaskQueuesTableTest, TableGeneration) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = size_t{0}; job_id < 20; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  const auto meta_table = generate_meta_table();
+  ASSERT_EQ(meta_table->row_count(), 2);
+
+  for (auto row_id = uint64_t{0}; row_id < meta_table->row_count(); ++row_id) {
+    const auto values = meta_table->get_row(row_id);
+    EXPECT_EQ(values[0], AllTypeVariant{static_cast<int32_t>(row_id)});
+    EXPECT_EQ(values[1], AllTypeVariant{int32_t{2}});
+    EXPECT_GE(boost::get<int32_t>(values[2]), 0);
+    EXPECT_LE(boost::get<int32_t>(values[2]), 2);
+
+    // All tasks have been processed.
+    EXPECT_EQ(values[3], AllTypeVariant{int64_t{0}});
+    EXPECT_EQ(values[4], AllTypeVariant{int64_t{0}});
+    EXPECT_EQ(values[5], AllTypeVariant{int64_t{0}});
+    EXPECT_EQ(values[6], AllTypeVariant{int64_t{0}});
+  }
+}
+
+}  // namespace hyrise
@@ -0,0 +1,101 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "utils/meta_tables/meta_workers_table.hpp"
+
+namespace hyrise {
+
+class MetaWorkersTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    meta_workers_table = std::make_shared<MetaWorkersTable>();
+  }
+
+  const std::shared_ptr<Table> generate_meta_table() const {
+    return meta_workers_table->_on_generate();
+  }
+
+  std::shared_ptr<MetaWorkersTable> meta_workers_table;
+};
+
+TEST_F(MetaWorkersTableTest, IsImmutable) {
+  EXPECT_FALSE(meta_workers_table->can_insert());
+  EXPECT_FALSE(meta_workers_table->can_update());
+  EXPECT_FALSE(meta_workers_table->can_delete());
+}
+
+TEST_F(MetaWorkersTableTest, EmptyWithoutNodeQueueScheduler) {
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  EXPECT_EQ(generate_meta_table()->row_count(), 0);
+}
+
+TEST_F(MetaWorkersTableTest, TableGeneration) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto JOB_COUNT = int64_t{20};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto job_id = int64_t{0}; job_id < JOB_COUNT; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+
+  const auto meta_table = generate_meta_table();
+  ASSERT_EQ(meta_table->row_count(), 4);
+
+  auto finished_task_count = int64_t{0};
+  for (auto row_id = uint64_t{0}; row_id < meta_table->row_count(); ++row_id) {
+    const auto values = meta_table->get_row(row_id);
+    EXPECT_EQ(values[0], AllTypeVariant{static_cast<int32_t>(row_id)});
+    EXPECT_EQ(values[1], AllTypeVariant{static_cast<int32_t>(row_id / 2)});
+    finished_task_count += boost::get<int64_t>(values[3]);
+    EXPECT_GE(boost::get<int64_t>(values[4]), 0);
+    EXPECT_GE(boost::get<int64_t>(values[5]), 0);
+    // No worker executes a task.
+    EXPECT_TRUE(variant_is_null(values[6]));
+  }
+  EXPECT_GE(finished_task_count, JOB_COUNT);
+}
+
+TEST_F(MetaWorkersTableTest, CurrentTask) {
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto started = std::atomic_bool{false};
+  auto done = std::atomic_bool{false};
+  const auto job = std::make_shared<JobTask>([&]() {
+    started = true;
+    while (!done) {
+      std::this_thread::yield();
+    }
+  });
+  job->schedule();
+
+  while (!started) {
+    std::this_thread::yield();
+  }
+
+  const auto meta_table = generate_meta_table();
+  auto current_task_count = size_t{0};
+  for (auto row_id = uint64_t{0}; row_id < meta_table->row_count(); ++row_id) {
+    const auto current_task_id = meta_table->get_row(row_id)[6];
+    if (!variant_is_null(current_task_id)) {
+      EXPECT_EQ(current_task_id, AllTypeVariant{static_cast<int64_t>(job->id())});
+      ++current_task_count;
+    }
+  }
+  EXPECT_EQ(current_task_count, 1);
+
+  done = true;
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+}
+
+}  // namespace hyrise
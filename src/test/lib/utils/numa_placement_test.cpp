@@ -0,0 +1,88 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/numa_placement.hpp"
+
+namespace hyrise {
+
+class NumaPlacementTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Two nodes with one worker each, independent of the number of cores of the machine.
+    Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{1, 1});
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+    _table = _create_table();
+    _expected_table = _create_table();
+  }
+
+ protected:
+  // Creates a table with four immutable chunks and a mutable one.
+  static std::shared_ptr<Table> _create_table() {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 9; ++value) {
+      table->append({value, value % 3 == 0 ? NULL_VALUE : AllTypeVariant{pmr_string{"v" + std::to_string(value)}}});
+    }
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    return table;
+  }
+
+  std::vector<NodeID> _node_ids() const {
+    auto node_ids = std::vector<NodeID>{};
+    const auto chunk_count = _table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      node_ids.emplace_back(_table->get_chunk(chunk_id)->node_id());
+    }
+    return node_ids;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(NumaPlacementTest, RoundRobin) {
+  EXPECT_EQ(place_table_on_numa_nodes(*_table, NumaPlacement::RoundRobin), 4);
+
+  // The mutable chunk is not placed.
+  EXPECT_EQ(_node_ids(), std::vector<NodeID>({NodeID{0}, NodeID{1}, NodeID{0}, NodeID{1}, INVALID_NODE_ID}));
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // Chunks that are already placed on their node are not migrated again.
+  EXPECT_EQ(place_table_on_numa_nodes(*_table, NumaPlacement::RoundRobin), 0);
+}
+
+TEST_F(NumaPlacementTest, Contiguous) {
+  EXPECT_EQ(place_table_on_numa_nodes(*_table, NumaPlacement::Contiguous), 4);
+
+  EXPECT_EQ(_node_ids(), std::vector<NodeID>({NodeID{0}, NodeID{0}, NodeID{0}, NodeID{1}, INVALID_NODE_ID}));
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // Chunks are moved when the placement changes.
+  EXPECT_EQ(place_table_on_numa_nodes(*_table, NumaPlacement::RoundRobin), 2);
+  EXPECT_EQ(_node_ids(), std::vector<NodeID>({NodeID{0}, NodeID{1}, NodeID{0}, NodeID{1}, INVALID_NODE_ID}));
+}
+
+TEST_F(NumaPlacementTest, SkipChunksWithIndexes) {
+  _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+
+  EXPECT_EQ(place_table_on_numa_nodes(*_table), 3);
+  EXPECT_EQ(_node_ids(), std::vector<NodeID>({NodeID{0}, INVALID_NODE_ID, NodeID{0}, NodeID{1}, INVALID_NODE_ID}));
+}
+
+TEST_F(NumaPlacementTest, SingleNode) {
+  Hyrise::get().topology.use_fake_numa_topology(std::vector<uint32_t>{2, 0});
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  EXPECT_EQ(place_table_on_numa_nodes(*_table), 0);
+  EXPECT_EQ(_node_ids(), std::vector<NodeID>(5, INVALID_NODE_ID));
+}
+
+}  // namespace hyrise
@@ -0,0 +1,78 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "utils/point_lookup.hpp"
+
+namespace hyrise {
+
+class PointLookupTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    _table->append({1, 1});
+    _table->append({1, 2});
+    _table->append({2, 1});
+    _table->append({2, 2});
+    _table->append({3, 1});
+
+    _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  }
+
+ protected:
+  std::optional<RowID> _find_visible_row(const PointLookupKey& key) const {
+    return find_visible_row(*_table, key, *_transaction_context);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+TEST_F(PointLookupTest, FindRowWithoutIndex) {
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 2}, {ColumnID{1}, 2}}), RowID(ChunkID{1}, ChunkOffset{1}));
+  EXPECT_EQ(_find_visible_row({{ColumnID{1}, 2}, {ColumnID{0}, 1}}), RowID(ChunkID{0}, ChunkOffset{1}));
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 3}}), RowID(ChunkID{2}, ChunkOffset{0}));
+  EXPECT_FALSE(_find_visible_row({{ColumnID{0}, 3}, {ColumnID{1}, 2}}));
+  EXPECT_FALSE(_find_visible_row({{ColumnID{0}, 4}}));
+}
+
+TEST_F(PointLookupTest, FindRowWithIndex) {
+  // Chunk 2 is not indexed and has to be scanned.
+  _table->create_partial_hash_index(ColumnID{0}, {ChunkID{0}, ChunkID{1}});
+
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 2}, {ColumnID{1}, 2}}), RowID(ChunkID{1}, ChunkOffset{1}));
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 1}, {ColumnID{1}, 1}}), RowID(ChunkID{0}, ChunkOffset{0}));
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 3}, {ColumnID{1}, 1}}), RowID(ChunkID{2}, ChunkOffset{0}));
+  EXPECT_FALSE(_find_visible_row({{ColumnID{0}, 2}, {ColumnID{1}, 3}}));
+}
+
+TEST_F(PointLookupTest, SkipInvisibleRows) {
+  _table->create_partial_hash_index(ColumnID{0}, {ChunkID{0}, ChunkID{1}});
+
+  // Row (2, 2) was deleted before the transaction started.
+  _table->get_chunk(ChunkID{1})->mvcc_data()->set_end_cid(ChunkOffset{1}, CommitID{0});
+  EXPECT_FALSE(_find_visible_row({{ColumnID{0}, 2}, {ColumnID{1}, 2}}));
+
+  // Another transaction inserted a row (3, 2), which is not committed yet.
+  _table->append({3, 2});
+  const auto& mvcc_data = _table->get_chunk(ChunkID{2})->mvcc_data();
+  mvcc_data->set_begin_cid(ChunkOffset{1}, MvccData::MAX_COMMIT_ID);
+  mvcc_data->set_tid(ChunkOffset{1}, TransactionID{_transaction_context->transaction_id() + 1});
+  EXPECT_FALSE(_find_visible_row({{ColumnID{0}, 3}, {ColumnID{1}, 2}}));
+
+  // Rows inserted by the transaction itself are visible.
+  mvcc_data->set_tid(ChunkOffset{1}, _transaction_context->transaction_id());
+  EXPECT_EQ(_find_visible_row({{ColumnID{0}, 3}, {ColumnID{1}, 2}}), RowID(ChunkID{2}, ChunkOffset{1}));
+}
+
+TEST_F(PointLookupTest, MaterializeRow) {
+  EXPECT_EQ(materialize_row(*_table, RowID{ChunkID{1}, ChunkOffset{1}}), std::vector<AllTypeVariant>({2, 2}));
+}
+
+}  // namespace hyrise
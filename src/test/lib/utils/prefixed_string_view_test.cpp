@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base_test.hpp"
+#include "utils/prefixed_string_view.hpp"
+
+namespace hyrise {
+
+class PrefixedStringViewTest : public BaseTest {
+ protected:
+  // Strings of different lengths around the prefix and inline sizes, including embedded zero bytes.
+  const std::vector<std::string> _strings{"",
+                                          std::string{"\0", 1},
+                                          "a",
+                                          std::string{"a\0", 2},
+                                          "ab",
+                                          "abc",
+                                          "abcd",
+                                          "abcde",
+                                          "abcdefghijkl",
+                                          "abcdefghijklm",
+                                          "abcdefghijklmn",
+                                          "abcdefghijklmo",
+                                          "abce",
+                                          "b",
+                                          "bcdefghijklmnopqrstuvwxyz",
+                                          "\xff"};
+};
+
+TEST_F(PrefixedStringViewTest, Size) {
+  EXPECT_EQ(sizeof(PrefixedStringView), 16);
+}
+
+TEST_F(PrefixedStringViewTest, View) {
+  for (const auto& string : _strings) {
+    const auto view = PrefixedStringView{string};
+    EXPECT_EQ(view.size(), string.size());
+    EXPECT_EQ(view.view(), std::string_view{string});
+  }
+
+  // Long strings are referenced, short strings are copied.
+  const auto long_string = std::string{"abcdefghijklmnopqrstuvwxyz"};
+  EXPECT_EQ(PrefixedStringView{long_string}.data(), long_string.data());
+
+  const auto short_string = std::string{"abcdefghijkl"};
+  EXPECT_NE(PrefixedStringView{short_string}.data(), short_string.data());
+}
+
+TEST_F(PrefixedStringViewTest, Comparison) {
+  for (const auto& lhs : _strings) {
+    for (const auto& rhs : _strings) {
+      const auto lhs_view = PrefixedStringView{lhs};
+      const auto rhs_view = PrefixedStringView{rhs};
+      EXPECT_EQ(lhs_view == rhs_view, lhs == rhs) << lhs << " vs. " << rhs;
+      EXPECT_EQ(lhs_view < rhs_view, lhs < rhs) << lhs << " vs. " << rhs;
+      EXPECT_EQ(lhs_view > rhs_view, lhs > rhs) << lhs << " vs. " << rhs;
+    }
+  }
+}
+
+TEST_F(PrefixedStringViewTest, Sort) {
+  auto views = std::vector<PrefixedStringView>{};
+  for (auto iter = _strings.rbegin(); iter != _strings.rend(); ++iter) {
+    views.emplace_back(*iter);
+  }
+
+  std::sort(views.begin(), views.end());
+
+  auto sorted_strings = _strings;
+  std::sort(sorted_strings.begin(), sorted_strings.end());
+  for (auto index = size_t{0}; index < views.size(); ++index) {
+    EXPECT_EQ(views[index].view(), std::string_view{sorted_strings[index]});
+  }
+}
+
+TEST_F(PrefixedStringViewTest, Hash) {
+  for (const auto& string : _strings) {
+    const auto copy = string;
+    EXPECT_EQ(std::hash<PrefixedStringView>{}(PrefixedStringView{string}),
+              std::hash<PrefixedStringView>{}(PrefixedStringView{copy}));
+  }
+}
+
+TEST_F(PrefixedStringViewTest, Heap) {
+  auto heap = PrefixedStringHeap{};
+  auto views = std::vector<PrefixedStringView>{};
+  for (const auto& string : _strings) {
+    // Pass a temporary copy: The view must not reference the original string.
+    views.emplace_back(heap.add(std::string{string}));
+  }
+
+  // Short strings are inlined and do not use the heap.
+  EXPECT_EQ(heap.block_count(), 1);
+
+  // Strings that exceed the remaining space of a block are stored in a new block. Moving the heap does not invalidate
+  // the views.
+  const auto long_string = std::string(PrefixedStringHeap::BLOCK_SIZE, 'x');
+  const auto long_view = heap.add(long_string);
+  EXPECT_EQ(heap.block_count(), 2);
+  EXPECT_NE(long_view.data(), long_string.data());
+
+  const auto moved_heap = std::move(heap);
+  for (auto index = size_t{0}; index < views.size(); ++index) {
+    EXPECT_EQ(views[index].view(), std::string_view{_strings[index]});
+  }
+  EXPECT_EQ(long_view.view(), std::string_view{long_string});
+  EXPECT_EQ(moved_heap.block_count(), 2);
+}
+
+}  // namespace hyrise
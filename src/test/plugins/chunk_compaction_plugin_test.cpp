@@ -0,0 +1,226 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../plugins/chunk_compaction_plugin.hpp"
+#include "base_test.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class ChunkCompactionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    // Chunks 0, 1, and 2 are full and immutable. Chunk 3 is mutable and contains a single row.
+    for (auto value = int32_t{0}; value < 13; ++value) {
+      _table->append({value});
+    }
+
+    _expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto value : {0, 4, 8, 12}) {
+      _expected_table->append({value});
+    }
+  }
+
+ protected:
+  // Deletes all rows of chunks 0 to 2 except for the first one. Thus, each of these chunks has a single valid row.
+  void _delete_rows() {
+    const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto validate = _validate_table(transaction_context);
+    const auto table_scan =
+        std::make_shared<TableScan>(validate, and_(less_than_(column_a, 12), not_equals_(mod_(column_a, 4), 0)));
+    table_scan->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+    ASSERT_FALSE(delete_operator->execute_failed());
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<Validate> _validate_table(const std::shared_ptr<TransactionContext>& transaction_context) const {
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    validate->never_clear_output();
+    validate->execute();
+    return validate;
+  }
+
+  static void _compaction_loop(ChunkCompactionPlugin& plugin) {
+    plugin._compaction_loop();
+  }
+
+  static std::vector<std::vector<ChunkID>> _select_chunks(const Table& table) {
+    return ChunkCompactionPlugin::_select_chunks(table);
+  }
+
+  const std::string _table_name{"chunkCompactionTestTable"};
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(ChunkCompactionPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseChunkCompactionPlugin")));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseChunkCompactionPlugin"));
+}
+
+TEST_F(ChunkCompactionPluginTest, Description) {
+  EXPECT_EQ(ChunkCompactionPlugin{}.description(), "Chunk compaction plugin");
+}
+
+TEST_F(ChunkCompactionPluginTest, SelectChunks) {
+  // All chunks are full.
+  EXPECT_TRUE(_select_chunks(*_table).empty());
+
+  _delete_rows();
+  EXPECT_EQ(_select_chunks(*_table), std::vector<std::vector<ChunkID>>({{ChunkID{0}, ChunkID{1}, ChunkID{2}}}));
+
+  // Logically deleted chunks are skipped. A single remaining chunk is not compacted.
+  _table->get_chunk(ChunkID{1})->set_cleanup_commit_id(CommitID{2});
+  _table->get_chunk(ChunkID{2})->set_cleanup_commit_id(CommitID{2});
+  EXPECT_TRUE(_select_chunks(*_table).empty());
+}
+
+TEST_F(ChunkCompactionPluginTest, CompactChunks) {
+  _table->create_partial_hash_index(ColumnID{0}, {ChunkID{0}, ChunkID{1}, ChunkID{2}});
+  const auto table_index = _table->get_table_indexes().front();
+  _delete_rows();
+
+  // Transactions that started before the compaction still see the compacted chunks.
+  const auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  auto plugin = ChunkCompactionPlugin{};
+  _compaction_loop(plugin);
+
+  // The last chunk was marked as full, and the valid rows of chunks 0 to 2 were inserted into the new chunk 4.
+  ASSERT_EQ(_table->chunk_count(), 5);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_TRUE(_table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+  EXPECT_FALSE(_table->get_chunk(ChunkID{3})->is_mutable());
+
+  const auto new_chunk = _table->get_chunk(ChunkID{4});
+  EXPECT_FALSE(new_chunk->is_mutable());
+  EXPECT_EQ(new_chunk->size(), 3);
+  EXPECT_TRUE(new_chunk->pruning_statistics());
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(new_chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(table_index->get_indexed_chunk_ids().contains(ChunkID{4}));
+
+  const auto new_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(_validate_table(old_transaction_context)->get_output(), _expected_table);
+  EXPECT_TABLE_EQ_UNORDERED(_validate_table(new_transaction_context)->get_output(), _expected_table);
+
+  // The compacted chunks are only removed when no active transaction can see them anymore.
+  _compaction_loop(plugin);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0}));
+
+  old_transaction_context->commit();
+  new_transaction_context->commit();
+  _compaction_loop(plugin);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id));
+    EXPECT_FALSE(table_index->get_indexed_chunk_ids().contains(chunk_id));
+  }
+  EXPECT_EQ(_table->chunk_count(), 5);
+}
+
+TEST_F(ChunkCompactionPluginTest, KeepSortOrder) {
+  const auto sort_definition = SortColumnDefinition{ColumnID{0}, SortMode::Ascending};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    _table->get_chunk(chunk_id)->set_individually_sorted_by(sort_definition);
+  }
+  _delete_rows();
+
+  auto plugin = ChunkCompactionPlugin{};
+  _compaction_loop(plugin);
+
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->individually_sorted_by(),
+            std::vector<SortColumnDefinition>{sort_definition});
+}
+
+TEST_F(ChunkCompactionPluginTest, NoRepeatedCompaction) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto delete_rows = [&](const auto& predicate) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto table_scan = std::make_shared<TableScan>(_validate_table(transaction_context), predicate);
+    table_scan->execute();
+    const auto delete_operator = std::make_shared<Delete>(table_scan);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+    ASSERT_FALSE(delete_operator->execute_failed());
+    transaction_context->commit();
+  };
+
+  // Delete all rows of chunks 0 to 2 but the first one, so that the new chunk is sparse as well.
+  delete_rows(and_(less_than_(column_a, 12), greater_than_(column_a, 0)));
+
+  auto plugin = ChunkCompactionPlugin{};
+  _compaction_loop(plugin);
+
+  // Chunk 3 was marked as full and chunk 4 holds the single valid row of chunks 0 to 2. A new row is appended to chunk
+  // 5, so that both chunks are sparse and not the last chunk.
+  ASSERT_EQ(_table->chunk_count(), 5);
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->size(), 1);
+  _table->append({13});
+  ASSERT_EQ(_table->chunk_count(), 6);
+
+  // The chunks written by the first compaction are not compacted again.
+  _compaction_loop(plugin);
+  EXPECT_EQ(_table->chunk_count(), 6);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{4})->get_cleanup_commit_id());
+
+  // Once rows of them are deleted, they are compacted again.
+  delete_rows(less_than_(column_a, 13));
+  _compaction_loop(plugin);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{3})->get_cleanup_commit_id());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{4})->get_cleanup_commit_id());
+}
+
+TEST_F(ChunkCompactionPluginTest, RollbackOnConflict) {
+  _delete_rows();
+
+  // A concurrent transaction deletes a valid row of chunk 1 without committing.
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto table_scan =
+      std::make_shared<TableScan>(_validate_table(transaction_context), equals_(column_a, 4));
+  table_scan->execute();
+  const auto delete_operator = std::make_shared<Delete>(table_scan);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+
+  auto plugin = ChunkCompactionPlugin{};
+  _compaction_loop(plugin);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_FALSE(_table->get_chunk(chunk_id)->get_cleanup_commit_id());
+  }
+  transaction_context->rollback(RollbackReason::User);
+}
+
+}  // namespace hyrise
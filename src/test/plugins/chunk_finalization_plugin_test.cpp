@@ -0,0 +1,117 @@
+#include <memory>
+#include <string>
+
+#include "../../plugins/chunk_finalization_plugin.hpp"
+#include "base_test.hpp"
+#include "hyrise.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace hyrise {
+
+class ChunkFinalizationPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+ protected:
+  void _append_rows(const int32_t row_count) {
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      _table->append({value});
+    }
+  }
+
+  bool _is_finalized(const ChunkID chunk_id) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    return chunk->pruning_statistics() &&
+           std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+  }
+
+  static void _finalization_loop(ChunkFinalizationPlugin& plugin) {
+    plugin._finalization_loop();
+  }
+
+  static bool _try_refresh_table_statistics(const std::shared_ptr<Table>& table) {
+    return ChunkFinalizationPlugin::_try_refresh_table_statistics(table);
+  }
+
+  const std::string _table_name{"chunkFinalizationTestTable"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkFinalizationPluginTest, LoadUnloadPlugin) {
+  auto& plugin_manager = Hyrise::get().plugin_manager;
+  EXPECT_NO_THROW(plugin_manager.load_plugin(build_dylib_path("libhyriseChunkFinalizationPlugin")));
+  EXPECT_NO_THROW(plugin_manager.unload_plugin("hyriseChunkFinalizationPlugin"));
+}
+
+TEST_F(ChunkFinalizationPluginTest, Description) {
+  EXPECT_EQ(ChunkFinalizationPlugin{}.description(), "Chunk finalization plugin");
+}
+
+TEST_F(ChunkFinalizationPluginTest, FinalizeImmutableChunks) {
+  // Chunks 0 and 1 are full and were marked as immutable when the next row was appended. Chunk 2 is still mutable.
+  _append_rows(5);
+  ASSERT_EQ(_table->chunk_count(), 3);
+  EXPECT_EQ(_table->table_statistics()->row_count, 0);
+
+  // Logically deleted chunks are not finalized.
+  _table->get_chunk(ChunkID{1})->set_cleanup_commit_id(CommitID{1});
+
+  auto plugin = ChunkFinalizationPlugin{};
+  _finalization_loop(plugin);
+
+  EXPECT_TRUE(_is_finalized(ChunkID{0}));
+  EXPECT_FALSE(_is_finalized(ChunkID{1}));
+  EXPECT_FALSE(_is_finalized(ChunkID{2}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(_table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})));
+
+  // The table grew from zero to five rows, so its statistics were refreshed.
+  EXPECT_EQ(_table->table_statistics()->row_count, 5);
+}
+
+TEST_F(ChunkFinalizationPluginTest, RateLimit) {
+  const auto finalized_chunk_count = ChunkFinalizationPlugin::MAX_CHUNKS_PER_ITERATION + 2;
+  _append_rows(static_cast<int32_t>(finalized_chunk_count * 2 + 1));
+
+  auto plugin = ChunkFinalizationPlugin{};
+  _finalization_loop(plugin);
+  EXPECT_TRUE(_is_finalized(ChunkID{ChunkFinalizationPlugin::MAX_CHUNKS_PER_ITERATION - 1}));
+  EXPECT_FALSE(_is_finalized(ChunkID{ChunkFinalizationPlugin::MAX_CHUNKS_PER_ITERATION}));
+
+  // The remaining chunks are finalized in the next iteration.
+  _finalization_loop(plugin);
+  for (auto chunk_id = ChunkID{0}; chunk_id < finalized_chunk_count; ++chunk_id) {
+    EXPECT_TRUE(_is_finalized(chunk_id));
+  }
+}
+
+TEST_F(ChunkFinalizationPluginTest, RefreshTableStatistics) {
+  _append_rows(10);
+  EXPECT_TRUE(_try_refresh_table_statistics(_table));
+  const auto table_statistics = _table->table_statistics();
+  EXPECT_EQ(table_statistics->row_count, 10);
+
+  // The table did not grow by more than STATISTICS_REFRESH_THRESHOLD.
+  _append_rows(1);
+  EXPECT_FALSE(_try_refresh_table_statistics(_table));
+  EXPECT_EQ(_table->table_statistics(), table_statistics);
+
+  _append_rows(1);
+  EXPECT_TRUE(_try_refresh_table_statistics(_table));
+  EXPECT_EQ(_table->table_statistics()->row_count, 12);
+
+  // Missing statistics are always created.
+  _table->set_table_statistics(nullptr);
+  EXPECT_TRUE(_try_refresh_table_statistics(_table));
+  EXPECT_EQ(_table->table_statistics()->row_count, 12);
+}
+
+}  // namespace hyrise